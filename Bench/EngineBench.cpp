@@ -0,0 +1,562 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <CuEngine/Vulkan/BufferBuilder.hpp>
+#include <CuEngine/Vulkan/CommandPoolSetBuilder.hpp>
+#include <CuEngine/Vulkan/DeviceBuilder.hpp>
+#include <CuEngine/Vulkan/DeviceSelection.hpp>
+#include <CuEngine/Vulkan/GpuProfilerBuilder.hpp>
+#include <CuEngine/Vulkan/InstanceBuilder.hpp>
+#include <CuEngine/Vulkan/PhysicalDevice.hpp>
+#include <CuEngine/Vulkan/Queue.hpp>
+#include <CuEngine/Vulkan/QueueFamily.hpp>
+#include <CuEngine/Vulkan/RenderGraphBuilder.hpp>
+#include <CuEngine/Vulkan/TimelineSemaphore.hpp>
+#include <CuEngine/Vulkan/UploadQueueBuilder.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace
+{
+namespace Vulkan = CuEngine::Vulkan;
+
+using Clock = std::chrono::steady_clock;
+
+constexpr auto framesInFlight   = 2u;
+constexpr auto renderWidth      = 1280u;
+constexpr auto renderHeight     = 720u;
+constexpr auto uploadSize       = std::uint64_t(4 * 1024 * 1024);
+constexpr auto uploadSliceCount = 4u;
+
+struct Options
+{
+    std::uint32_t frameCount;
+    std::uint32_t warmupFrameCount;
+    std::string   outputPath;
+    std::string   baselinePath;
+    double        tolerance;
+    std::string   preferredDevice;
+};
+
+struct Percentiles
+{
+    double p50;
+    double p95;
+    double p99;
+    double max;
+};
+
+struct SceneResult
+{
+    std::string name;
+    Percentiles cpuMilliseconds;
+    Percentiles gpuMilliseconds;
+    Percentiles memoryBytes;
+};
+
+struct Context
+{
+    Vulkan::PhysicalDevice & physicalDevice;
+    Vulkan::Device &         device;
+    Vulkan::QueueFamily &    graphicsQueueFamily;
+    Vulkan::QueueFamily &    transferQueueFamily;
+    Vulkan::Queue &          graphicsQueue;
+    Vulkan::Queue &          transferQueue;
+};
+
+// Records the scene into a frame, resources indexed by the frame slot are no longer in use by the GPU
+using RecordFrame = std::function<void(Vulkan::CommandBuffer &, std::uint32_t frameIndex, std::uint32_t frame,
+                                       std::vector<Vulkan::TimelineWait> & waits)>;
+
+struct Scene
+{
+    std::string                           name;
+    std::function<RecordFrame(Context &)> create;
+};
+
+std::optional<Options> ParseOptions(int argc, char ** argv)
+{
+    auto options = Options{ .frameCount       = 600,
+                            .warmupFrameCount = 60,
+                            .outputPath       = "CuEngineBench.json",
+                            .baselinePath     = "",
+                            .tolerance        = 0.1,
+                            .preferredDevice  = "" };
+
+    auto parseCount = [](std::string_view value, std::uint32_t & count)
+    {
+        auto result = std::from_chars(value.data(), value.data() + value.size(), count);
+        return result.ec == std::errc() && result.ptr == value.data() + value.size();
+    };
+
+    for (auto index = 1; index < argc; ++index)
+    {
+        auto argument = std::string_view(argv[index]);
+        if (index + 1 >= argc)
+        {
+            return std::nullopt;
+        }
+
+        auto value = std::string_view(argv[++index]);
+        if (argument == "--frames")
+        {
+            if (!parseCount(value, options.frameCount) || options.frameCount == 0)
+            {
+                return std::nullopt;
+            }
+        }
+        else if (argument == "--warmup")
+        {
+            if (!parseCount(value, options.warmupFrameCount))
+            {
+                return std::nullopt;
+            }
+        }
+        else if (argument == "--output")
+        {
+            options.outputPath = value;
+        }
+        else if (argument == "--baseline")
+        {
+            options.baselinePath = value;
+        }
+        else if (argument == "--device")
+        {
+            options.preferredDevice = value;
+        }
+        else if (argument == "--tolerance")
+        {
+            auto end          = static_cast<char *>(nullptr);
+            options.tolerance = std::strtod(argv[index], &end);
+            if (*end != '\0' || options.tolerance < 0.0)
+            {
+                return std::nullopt;
+            }
+        }
+        else
+        {
+            return std::nullopt;
+        }
+    }
+
+    return options;
+}
+
+// Nearest-rank percentiles
+Percentiles ComputePercentiles(std::vector<double> samples)
+{
+    if (samples.empty())
+    {
+        return { .p50 = 0.0, .p95 = 0.0, .p99 = 0.0, .max = 0.0 };
+    }
+
+    std::ranges::sort(samples);
+    auto percentile = [&samples](double fraction)
+    {
+        auto rank = static_cast<std::size_t>(std::ceil(fraction * static_cast<double>(samples.size())));
+        return samples[std::clamp<std::size_t>(rank, 1, samples.size()) - 1];
+    };
+
+    return { .p50 = percentile(0.5), .p95 = percentile(0.95), .p99 = percentile(0.99), .max = samples.back() };
+}
+
+RecordFrame CreateEmptyScene(Context &)
+{
+    return [](Vulkan::CommandBuffer &, std::uint32_t, std::uint32_t, std::vector<Vulkan::TimelineWait> &) {};
+}
+
+// A deferred-style frame rebuilt every frame, exercising graph compilation, barriers and transient aliasing
+RecordFrame CreateRenderGraphScene(Context & context)
+{
+    auto renderGraphs = std::make_shared<std::vector<std::optional<Vulkan::RenderGraph>>>(framesInFlight);
+
+    return [&context, renderGraphs](Vulkan::CommandBuffer & commandBuffer, std::uint32_t frameIndex, std::uint32_t,
+                                    std::vector<Vulkan::TimelineWait> &)
+    {
+        using enum Vulkan::ImageAccess;
+
+        auto builder = Vulkan::RenderGraphBuilder();
+        builder.SetDevice(context.device);
+
+        auto image = [&builder](Vulkan::Format format)
+        {
+            return builder.CreateImage({ .format = format, .width = renderWidth, .height = renderHeight });
+        };
+        auto depth  = image(Vulkan::Format::D32Sfloat);
+        auto albedo = image(Vulkan::Format::R8G8B8A8Unorm);
+        auto normal = image(Vulkan::Format::R16G16B16A16Sfloat);
+        auto hdr    = image(Vulkan::Format::R16G16B16A16Sfloat);
+        auto bloom  = image(Vulkan::Format::R16G16B16A16Sfloat);
+        auto ldr    = image(Vulkan::Format::R8G8B8A8Unorm);
+
+        auto pass = [&builder](std::string name, std::vector<Vulkan::ImageUse> images, bool hasSideEffects = false)
+        {
+            builder.AddPass({ .name           = std::move(name),
+                              .images         = std::move(images),
+                              .buffers        = {},
+                              .hasSideEffects = hasSideEffects,
+                              .execute        = [](Vulkan::CommandBuffer &, const Vulkan::RenderGraph &) {} });
+        };
+        pass("DepthPrepass", { { depth, DepthAttachmentWrite } });
+        pass("GBuffer", { { depth, DepthAttachmentRead }, { albedo, ColorAttachmentWrite },
+                          { normal, ColorAttachmentWrite } });
+        pass("Lighting", { { albedo, FragmentShaderRead }, { normal, FragmentShaderRead },
+                           { hdr, ColorAttachmentWrite } });
+        pass("Bloom", { { hdr, ComputeShaderRead }, { bloom, ComputeShaderWrite } });
+        pass("Tonemap", { { hdr, FragmentShaderRead }, { bloom, FragmentShaderRead }, { ldr, ColorAttachmentWrite } });
+        pass("Readback", { { ldr, TransferRead } }, true);
+
+        // The graph that used this slot has finished on the GPU, so its transient images can go
+        auto & renderGraph = (*renderGraphs)[frameIndex];
+        renderGraph.reset();
+        renderGraph = builder.Build();
+        renderGraph->Execute(commandBuffer);
+    };
+}
+
+// Streams a deterministic payload through the transfer queue every frame and makes the frame wait for it
+RecordFrame CreateUploadScene(Context & context)
+{
+    struct State
+    {
+        Vulkan::UploadQueue       uploadQueue;
+        Vulkan::Buffer            buffer;
+        std::vector<std::uint8_t> data;
+    };
+
+    auto state = std::make_shared<State>(State{
+        .uploadQueue = Vulkan::UploadQueueBuilder()
+                           .SetDevice(context.device)
+                           .SetQueue(context.transferQueue, context.transferQueueFamily)
+                           .SetStagingSize(uploadSize * framesInFlight)
+                           .Build(),
+        .buffer      = Vulkan::BufferBuilder()
+                      .SetDevice(context.device)
+                      .SetSize(uploadSize * uploadSliceCount)
+                      .SetUsage(Vulkan::BufferUsage::TransferDestination)
+                      .SetMemoryUsage(Vulkan::MemoryUsage::GpuOnly)
+                      .Build(),
+        .data        = std::vector<std::uint8_t>(uploadSize) });
+
+    // Fixed seed linear congruential generator
+    auto seed = std::uint32_t(0x12345678);
+    std::ranges::generate(state->data,
+                          [&seed]()
+                          {
+                              seed = seed * 1664525u + 1013904223u;
+                              return static_cast<std::uint8_t>(seed >> 24);
+                          });
+
+    return [state](Vulkan::CommandBuffer &, std::uint32_t, std::uint32_t frame,
+                   std::vector<Vulkan::TimelineWait> & waits)
+    {
+        auto offset = (frame % uploadSliceCount) * uploadSize;
+        auto value  = state->uploadQueue.Upload(state->buffer, offset, state->data.data(), state->data.size());
+        state->uploadQueue.Flush();
+
+        waits.push_back({ .semaphore = &state->uploadQueue.GetSemaphore(),
+                          .value     = value,
+                          .stage     = Vulkan::PipelineStage::Transfer });
+    };
+}
+
+std::uint64_t GetUsedMemory(Vulkan::Device & device)
+{
+    auto usedBytes = std::uint64_t(0);
+    for (auto && heapStatistics : device.GetMemoryAllocator().GetStatistics())
+    {
+        usedBytes += heapStatistics.usedBytes;
+    }
+
+    return usedBytes;
+}
+
+SceneResult RunScene(Context & context, const Scene & scene, const Options & options)
+{
+    auto semaphore      = Vulkan::TimelineSemaphore::Create(context.device);
+    auto commandPoolSet = Vulkan::CommandPoolSetBuilder()
+                              .SetDevice(context.device)
+                              .SetQueueFamily(context.graphicsQueueFamily)
+                              .SetFramesInFlight(framesInFlight)
+                              .SetWorkerCount(1)
+                              .Build();
+    auto gpuProfiler    = Vulkan::GpuProfilerBuilder()
+                           .SetPhysicalDevice(context.physicalDevice)
+                           .SetDevice(context.device)
+                           .SetQueueFamily(context.graphicsQueueFamily)
+                           .SetFramesInFlight(framesInFlight)
+                           .SetHistorySize(options.frameCount)
+                           .Build();
+    auto recordFrame    = scene.create(context);
+
+    auto cpuMilliseconds = std::vector<double>();
+    auto memoryBytes     = std::vector<double>();
+    cpuMilliseconds.reserve(options.frameCount);
+    memoryBytes.reserve(options.frameCount);
+
+    // The trailing frames only collect the GPU timestamps of the last measured frames
+    auto measuredEnd = options.warmupFrameCount + options.frameCount;
+    auto frameEnd    = measuredEnd + framesInFlight;
+    for (auto frame = 0u; frame < frameEnd; ++frame)
+    {
+        auto beginTime  = Clock::now();
+        auto frameIndex = frame % framesInFlight;
+        auto isMeasured = frame >= options.warmupFrameCount && frame < measuredEnd;
+
+        if (frame >= framesInFlight)
+        {
+            semaphore.Wait(frame + 1 - framesInFlight);
+        }
+
+        commandPoolSet.BeginFrame(frameIndex);
+        auto commandBuffer = commandPoolSet.BeginPrimary();
+        gpuProfiler.BeginFrame(commandBuffer, frameIndex);
+
+        auto waits = std::vector<Vulkan::TimelineWait>();
+        if (isMeasured)
+        {
+            gpuProfiler.BeginScope(commandBuffer, scene.name);
+            recordFrame(commandBuffer, frameIndex, frame, waits);
+            gpuProfiler.EndScope(commandBuffer);
+        }
+        else
+        {
+            recordFrame(commandBuffer, frameIndex, frame, waits);
+        }
+        commandBuffer.End();
+
+        auto commandBuffers = std::vector<Vulkan::CommandBuffer>();
+        commandBuffers.push_back(std::move(commandBuffer));
+        context.graphicsQueue.Submit(commandBuffers, waits, { { .semaphore = &semaphore, .value = frame + 1 } });
+
+        if (isMeasured)
+        {
+            cpuMilliseconds.push_back(std::chrono::duration<double, std::milli>(Clock::now() - beginTime).count());
+            memoryBytes.push_back(static_cast<double>(GetUsedMemory(context.device)));
+        }
+    }
+    semaphore.Wait(frameEnd);
+
+    auto gpuMilliseconds = Percentiles{ .p50 = 0.0, .p95 = 0.0, .p99 = 0.0, .max = 0.0 };
+    for (auto && scopeStatistics : gpuProfiler.GetStatistics())
+    {
+        if (scopeStatistics.name == scene.name)
+        {
+            gpuMilliseconds = { .p50 = scopeStatistics.p50Milliseconds,
+                                .p95 = scopeStatistics.p95Milliseconds,
+                                .p99 = scopeStatistics.p99Milliseconds,
+                                .max = scopeStatistics.maxMilliseconds };
+        }
+    }
+
+    return { .name            = scene.name,
+             .cpuMilliseconds = ComputePercentiles(std::move(cpuMilliseconds)),
+             .gpuMilliseconds = gpuMilliseconds,
+             .memoryBytes     = ComputePercentiles(std::move(memoryBytes)) };
+}
+
+// Flat "scene/metric/percentile" keys, one per line, so a baseline can be read back without a JSON parser
+std::map<std::string, double> Flatten(const std::vector<SceneResult> & results)
+{
+    auto values = std::map<std::string, double>();
+    for (auto && result : results)
+    {
+        for (auto && [metric, percentiles] : { std::pair{ "cpuMilliseconds", result.cpuMilliseconds },
+                                               std::pair{ "gpuMilliseconds", result.gpuMilliseconds },
+                                               std::pair{ "memoryBytes", result.memoryBytes } })
+        {
+            auto prefix            = result.name + "/" + metric + "/";
+            values[prefix + "p50"] = percentiles.p50;
+            values[prefix + "p95"] = percentiles.p95;
+            values[prefix + "p99"] = percentiles.p99;
+            values[prefix + "max"] = percentiles.max;
+        }
+    }
+
+    return values;
+}
+
+void WriteResults(const std::string & path, const std::map<std::string, double> & values)
+{
+    auto file = std::ofstream(path);
+    if (!file)
+    {
+        throw std::runtime_error("Failed to open " + path);
+    }
+
+    file << "{\n" << std::setprecision(9);
+    for (auto it = std::begin(values); it != std::end(values); ++it)
+    {
+        file << "    \"" << it->first << "\": " << it->second << (std::next(it) == std::end(values) ? "\n" : ",\n");
+    }
+    file << "}\n";
+}
+
+std::map<std::string, double> ReadResults(const std::string & path)
+{
+    auto file = std::ifstream(path);
+    if (!file)
+    {
+        throw std::runtime_error("Failed to open " + path);
+    }
+
+    auto values = std::map<std::string, double>();
+    for (auto line = std::string(); std::getline(file, line);)
+    {
+        auto keyBegin = line.find('"');
+        auto keyEnd   = line.find('"', keyBegin + 1);
+        auto colon    = line.find(':', keyEnd + 1);
+        if (keyBegin == std::string::npos || keyEnd == std::string::npos || colon == std::string::npos)
+        {
+            continue;
+        }
+        values[line.substr(keyBegin + 1, keyEnd - keyBegin - 1)] = std::strtod(line.c_str() + colon + 1, nullptr);
+    }
+
+    return values;
+}
+
+// Max is reported but not compared, a single preempted frame would fail the run
+bool CompareResults(const std::map<std::string, double> & values, const std::map<std::string, double> & baseline,
+                    double tolerance)
+{
+    auto hasRegression = false;
+    for (auto && [key, value] : values)
+    {
+        auto baselineIt = baseline.find(key);
+        if (baselineIt == std::end(baseline) || key.ends_with("/max"))
+        {
+            continue;
+        }
+
+        auto baselineValue  = baselineIt->second;
+        auto isRegression   = baselineValue > 0.0 && value > baselineValue * (1.0 + tolerance);
+        auto relativeChange = baselineValue > 0.0 ? (value / baselineValue - 1.0) * 100.0 : 0.0;
+        hasRegression       = hasRegression || isRegression;
+
+        std::cout << std::left << std::setw(40) << key << std::right << std::setw(14) << baselineValue
+                  << std::setw(14) << value << std::setw(9) << std::showpos << relativeChange << std::noshowpos
+                  << "%" << (isRegression ? "  REGRESSION" : "") << std::endl;
+    }
+
+    return !hasRegression;
+}
+} // namespace
+
+int main(int argc, char ** argv)
+{
+    auto options = ParseOptions(argc, argv);
+    if (!options)
+    {
+        std::cerr << "Usage: " << argv[0]
+                  << " [--frames <count>] [--warmup <count>] [--output <path>] [--baseline <path>]"
+                     " [--tolerance <fraction>] [--device <name|uuid>]"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    try
+    {
+        auto instance = Vulkan::InstanceBuilder().SetHeadless(true).Build();
+
+        // The same policy as the engine, so the numbers describe the device it would run on
+        auto   suitableDevice      = Vulkan::SelectDevice(instance, nullptr, options->preferredDevice);
+        auto & physicalDevice      = suitableDevice.physicalDevice;
+        auto & graphicsQueueFamily = suitableDevice.graphicsQueueFamily;
+        auto & transferQueueFamily = suitableDevice.transferQueueFamily;
+
+        auto deviceBuilder = Vulkan::DeviceBuilder().SetPhysicalDevice(physicalDevice).SetHeadless(true);
+        for (auto && queueFamily : std::set<Vulkan::QueueFamily>{ graphicsQueueFamily, transferQueueFamily })
+        {
+            deviceBuilder.AddQueues(queueFamily, std::vector<float>{ 1.0 });
+        }
+        auto device        = deviceBuilder.Build();
+        auto graphicsQueue = Vulkan::Queue::Get(device, graphicsQueueFamily, 0);
+        auto transferQueue = Vulkan::Queue::Get(device, transferQueueFamily, 0);
+
+        auto context = Context{ .physicalDevice      = physicalDevice,
+                                .device              = device,
+                                .graphicsQueueFamily = graphicsQueueFamily,
+                                .transferQueueFamily = transferQueueFamily,
+                                .graphicsQueue       = graphicsQueue,
+                                .transferQueue       = transferQueue };
+
+        auto scenes = std::vector<Scene>{ { .name = "Empty", .create = CreateEmptyScene },
+                                          { .name = "RenderGraph", .create = CreateRenderGraphScene },
+                                          { .name = "Upload", .create = CreateUploadScene } };
+
+        std::cout << "Device: " << physicalDevice.GetName() << ", " << options->frameCount << " frames after "
+                  << options->warmupFrameCount << " warm-up frames" << std::endl;
+
+        auto results = std::vector<SceneResult>();
+        for (auto && scene : scenes)
+        {
+            auto & result = results.emplace_back(RunScene(context, scene, *options));
+
+            std::cout << std::fixed << std::setprecision(3) << scene.name << ": CPU "
+                      << result.cpuMilliseconds.p50 << "/" << result.cpuMilliseconds.p95 << "/"
+                      << result.cpuMilliseconds.p99 << "/" << result.cpuMilliseconds.max << " ms, GPU "
+                      << result.gpuMilliseconds.p50 << "/" << result.gpuMilliseconds.p95 << "/"
+                      << result.gpuMilliseconds.p99 << "/" << result.gpuMilliseconds.max << " ms, memory max "
+                      << static_cast<std::uint64_t>(result.memoryBytes.max) << " bytes (p50/p95/p99/max)"
+                      << std::defaultfloat << std::endl;
+        }
+
+        auto values = Flatten(results);
+        WriteResults(options->outputPath, values);
+        std::cout << "Results written to " << options->outputPath << std::endl;
+
+        if (!options->baselinePath.empty()
+            && !CompareResults(values, ReadResults(options->baselinePath), options->tolerance))
+        {
+            std::cerr << "Performance regressed beyond " << options->tolerance * 100.0 << "% of "
+                      << options->baselinePath << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    catch (const std::exception & e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
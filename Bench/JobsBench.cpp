@@ -0,0 +1,112 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <CuEngine/Jobs/SchedulerBuilder.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+constexpr auto emptyJobCount   = 1u << 20;
+constexpr auto workJobCount    = 4096u;
+constexpr auto workIterations  = 20000u;
+constexpr auto repetitionCount = 5u;
+
+double Measure(CuEngine::Jobs::Scheduler & scheduler, std::uint32_t jobCount,
+               const std::function<void(std::uint32_t)> & job)
+{
+    auto best = std::chrono::duration<double>::max();
+    for (auto repetition = 0u; repetition < repetitionCount; ++repetition)
+    {
+        auto start   = Clock::now();
+        auto counter = scheduler.Schedule(jobCount, job);
+        scheduler.Wait(counter);
+        best = std::min<std::chrono::duration<double>>(best, Clock::now() - start);
+    }
+
+    return best.count();
+}
+
+void MeasureOverhead(std::uint32_t workerCount)
+{
+    auto scheduler = CuEngine::Jobs::SchedulerBuilder().SetWorkerCount(workerCount).Build();
+    auto seconds   = Measure(scheduler, emptyJobCount, [](std::uint32_t) {});
+
+    std::cout << "Empty jobs, " << std::setw(2) << workerCount << " workers: " << std::fixed << std::setprecision(1)
+              << seconds * 1e9 / emptyJobCount << " ns/job" << std::endl;
+}
+
+void MeasureScaling(std::uint32_t maxWorkerCount)
+{
+    auto sink = std::atomic<double>(0.0);
+    auto work = [&sink](std::uint32_t index)
+    {
+        auto value = static_cast<double>(index);
+        for (auto iteration = 0u; iteration < workIterations; ++iteration)
+        {
+            value = std::sqrt(value + iteration);
+        }
+        sink.fetch_add(value, std::memory_order_relaxed);
+    };
+
+    auto workerCounts = std::vector<std::uint32_t>();
+    for (auto workerCount = 1u; workerCount < maxWorkerCount; workerCount *= 2)
+    {
+        workerCounts.push_back(workerCount);
+    }
+    workerCounts.push_back(maxWorkerCount);
+
+    auto baseline = 0.0;
+    for (auto workerCount : workerCounts)
+    {
+        auto scheduler = CuEngine::Jobs::SchedulerBuilder().SetWorkerCount(workerCount).SetPinWorkers(true).Build();
+        auto seconds   = Measure(scheduler, workJobCount, work);
+        baseline       = workerCount == 1 ? seconds : baseline;
+
+        std::cout << "Compute jobs, " << std::setw(2) << workerCount << " workers: " << std::fixed
+                  << std::setprecision(2) << seconds * 1e3 << " ms, " << baseline / seconds << "x" << std::endl;
+    }
+}
+} // namespace
+
+int main()
+{
+    auto hardwareThreadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+    MeasureOverhead(1);
+    MeasureOverhead(hardwareThreadCount);
+    MeasureScaling(hardwareThreadCount);
+
+    return EXIT_SUCCESS;
+}
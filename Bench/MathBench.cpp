@@ -0,0 +1,147 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <CuEngine/Math/Batch.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+// Small enough to stay in cache so the kernels are measured rather than memory bandwidth
+constexpr auto pointCount      = 1u << 14;
+constexpr auto matrixCount     = 1u << 12;
+constexpr auto passCount       = 64u;
+constexpr auto repetitionCount = 5u;
+
+double Measure(const std::function<void()> & work)
+{
+    auto best = std::chrono::duration<double>::max();
+    for (auto repetition = 0u; repetition < repetitionCount; ++repetition)
+    {
+        auto start = Clock::now();
+        for (auto pass = 0u; pass < passCount; ++pass)
+        {
+            work();
+        }
+        best = std::min<std::chrono::duration<double>>(best, (Clock::now() - start) / passCount);
+    }
+
+    return best.count();
+}
+
+void Report(const char * name, const char * unit, std::uint32_t count, double scalarSeconds, double seconds)
+{
+    std::cout << name << ": scalar " << std::fixed << std::setprecision(2) << scalarSeconds * 1e9 / count << " ns/"
+              << unit << ", " << CuEngine::Math::GetInstructionSetName() << " " << seconds * 1e9 / count << " ns/"
+              << unit << ", " << scalarSeconds / seconds << "x" << std::endl;
+}
+
+CuEngine::Math::Mat4 RandomTransform(std::minstd_rand & random)
+{
+    auto value = std::uniform_real_distribution<float>(-1.0f, 1.0f);
+
+    auto axis  = CuEngine::Math::Normalize(CuEngine::Math::Vec3 { value(random), value(random), 1.0f });
+    auto angle = value(random) * 3.14159265f;
+
+    return CuEngine::Math::Compose({ value(random), value(random), value(random) },
+                                   CuEngine::Math::FromAxisAngle(axis, angle), { 1.0f, 1.0f, 1.0f });
+}
+
+void MeasurePoints(std::minstd_rand & random)
+{
+    auto value  = std::uniform_real_distribution<float>(-100.0f, 100.0f);
+    auto matrix = RandomTransform(random);
+
+    auto x = std::vector<float>(pointCount);
+    auto y = std::vector<float>(pointCount);
+    auto z = std::vector<float>(pointCount);
+    std::ranges::generate(x, [&]() { return value(random); });
+    std::ranges::generate(y, [&]() { return value(random); });
+    std::ranges::generate(z, [&]() { return value(random); });
+
+    auto resultX = std::vector<float>(pointCount);
+    auto resultY = std::vector<float>(pointCount);
+    auto resultZ = std::vector<float>(pointCount);
+
+    auto points = CuEngine::Math::ConstPointArrays { x, y, z };
+    auto result = CuEngine::Math::PointArrays { resultX, resultY, resultZ };
+
+    auto scalarSeconds = Measure([&]() { CuEngine::Math::Scalar::TransformPoints(matrix, points, result); });
+    auto seconds       = Measure([&]() { CuEngine::Math::TransformPoints(matrix, points, result); });
+    Report("Transform points", "point", pointCount, scalarSeconds, seconds);
+}
+
+void MeasureMatrices(std::minstd_rand & random)
+{
+    auto left   = std::vector<CuEngine::Math::Mat4>(matrixCount);
+    auto right  = std::vector<CuEngine::Math::Mat4>(matrixCount);
+    auto result = std::vector<CuEngine::Math::Mat4>(matrixCount);
+    std::ranges::generate(left, [&]() { return RandomTransform(random); });
+    std::ranges::generate(right, [&]() { return RandomTransform(random); });
+
+    auto scalarSeconds = Measure([&]() { CuEngine::Math::Scalar::MultiplyMatrices(left, right, result); });
+    auto seconds       = Measure([&]() { CuEngine::Math::MultiplyMatrices(left, right, result); });
+    Report("Multiply matrices", "matrix", matrixCount, scalarSeconds, seconds);
+}
+
+void MeasureMatrixBlocks(std::minstd_rand & random)
+{
+    auto left   = std::vector<CuEngine::Math::Mat4>(matrixCount);
+    auto right  = std::vector<CuEngine::Math::Mat4>(matrixCount);
+    auto result = std::vector<CuEngine::Math::Mat4>(matrixCount);
+    std::ranges::generate(left, [&]() { return RandomTransform(random); });
+    std::ranges::generate(right, [&]() { return RandomTransform(random); });
+
+    auto blockCount   = CuEngine::Math::GetBlockCount(matrixCount);
+    auto leftBlocks   = std::vector<CuEngine::Math::Mat4Block>(blockCount);
+    auto rightBlocks  = std::vector<CuEngine::Math::Mat4Block>(blockCount);
+    auto resultBlocks = std::vector<CuEngine::Math::Mat4Block>(blockCount);
+    CuEngine::Math::PackMatrices(left, leftBlocks);
+    CuEngine::Math::PackMatrices(right, rightBlocks);
+
+    // Against the scalar array of structures loop, which is what callers would otherwise write
+    auto scalarSeconds = Measure([&]() { CuEngine::Math::Scalar::MultiplyMatrices(left, right, result); });
+    auto seconds = Measure([&]() { CuEngine::Math::MultiplyMatrices(leftBlocks, rightBlocks, resultBlocks); });
+    Report("Multiply matrix blocks", "matrix", matrixCount, scalarSeconds, seconds);
+}
+} // namespace
+
+int main()
+{
+    auto random = std::minstd_rand();
+
+    MeasurePoints(random);
+    MeasureMatrices(random);
+    MeasureMatrixBlocks(random);
+
+    return EXIT_SUCCESS;
+}
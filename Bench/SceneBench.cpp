@@ -0,0 +1,262 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <CuEngine/Jobs/SchedulerBuilder.hpp>
+#include <CuEngine/Scene/EntityCommandBuffer.hpp>
+#include <CuEngine/Scene/TransformHierarchy.hpp>
+#include <CuEngine/Scene/World.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+constexpr auto entityCount     = 1u << 20;
+constexpr auto rootCount       = 256u;
+constexpr auto childrenPerNode = 4u;
+constexpr auto repetitionCount = 5u;
+
+struct Position
+{
+    float x = 0.0f;
+    float y = 0.0f;
+    float z = 0.0f;
+};
+
+struct Velocity
+{
+    float x = 0.0f;
+    float y = 0.0f;
+    float z = 0.0f;
+};
+
+// Stands in for a pointer-based scene graph, every node allocated on its own and visited in no particular order
+struct Node
+{
+    Position position;
+    Velocity velocity;
+    Node *   next = nullptr;
+};
+
+double Measure(const std::function<void()> & work)
+{
+    auto best = std::chrono::duration<double>::max();
+    for (auto repetition = 0u; repetition < repetitionCount; ++repetition)
+    {
+        auto start = Clock::now();
+        work();
+        best = std::min<std::chrono::duration<double>>(best, Clock::now() - start);
+    }
+
+    return best.count();
+}
+
+void Report(const char * name, double seconds)
+{
+    std::cout << name << ": " << std::fixed << std::setprecision(2) << seconds * 1e3 << " ms, "
+              << std::setprecision(2) << seconds * 1e9 / entityCount << " ns/entity" << std::endl;
+}
+
+void Integrate(Position & position, const Velocity & velocity) noexcept
+{
+    constexpr auto seconds = 1.0f / 60.0f;
+
+    position.x += velocity.x * seconds;
+    position.y += velocity.y * seconds;
+    position.z += velocity.z * seconds;
+}
+
+void MeasureScene(std::uint32_t workerCount)
+{
+    auto world   = CuEngine::Scene::World();
+    auto seconds = Measure(
+        [&world]()
+        {
+            world = CuEngine::Scene::World();
+            for (auto index = 0u; index < entityCount; ++index)
+            {
+                static_cast<void>(world.CreateEntity(Position(), Velocity{ .x = 1.0f, .y = 2.0f, .z = 3.0f }));
+            }
+        });
+    Report("Create entities", seconds);
+
+    seconds = Measure(
+        [&world]()
+        {
+            world.ForEach<Position, Velocity>(
+                [](CuEngine::Scene::Entity, Position & position, const Velocity & velocity)
+                {
+                    Integrate(position, velocity);
+                });
+        });
+    Report("Iterate chunks", seconds);
+
+    auto scheduler = CuEngine::Jobs::SchedulerBuilder().SetWorkerCount(workerCount).Build();
+    seconds        = Measure(
+        [&world, &scheduler]()
+        {
+            world.ParallelForEach<Position, Velocity>(
+                scheduler,
+                [](CuEngine::Scene::Entity, Position & position, const Velocity & velocity)
+                {
+                    Integrate(position, velocity);
+                });
+        });
+    Report("Iterate chunks in parallel", seconds);
+
+    // Half the entities lose a component, which moves them between archetypes on playback
+    seconds = Measure(
+        [&world, &scheduler]()
+        {
+            auto commands = CuEngine::Scene::EntityCommandBuffer();
+            world.ParallelForEach<Position, Velocity>(
+                scheduler,
+                [&commands](CuEngine::Scene::Entity entity, Position &, const Velocity &)
+                {
+                    if (entity.index % 2 == 0)
+                    {
+                        commands.RemoveComponent<Velocity>(entity);
+                    }
+                });
+            commands.Playback(world);
+            world.ForEach<Position>(
+                [&commands](CuEngine::Scene::Entity entity, Position &)
+                {
+                    if (entity.index % 2 == 0)
+                    {
+                        commands.AddComponent(entity, Velocity{ .x = 1.0f, .y = 2.0f, .z = 3.0f });
+                    }
+                });
+            commands.Playback(world);
+        });
+    Report("Remove and add a component on half", seconds);
+}
+
+void MeasureNodes()
+{
+    auto nodes = std::vector<std::unique_ptr<Node>>();
+    for (auto index = 0u; index < entityCount; ++index)
+    {
+        nodes.push_back(std::make_unique<Node>(Node{ .position = Position(), .velocity = { 1.0f, 2.0f, 3.0f } }));
+    }
+    std::ranges::shuffle(nodes, std::minstd_rand());
+    for (auto index = std::size_t(1); index < nodes.size(); ++index)
+    {
+        nodes[index - 1]->next = nodes[index].get();
+    }
+
+    auto seconds = Measure(
+        [&nodes]()
+        {
+            for (auto * node = nodes.front().get(); node != nullptr; node = node->next)
+            {
+                Integrate(node->position, node->velocity);
+            }
+        });
+    Report("Iterate linked nodes", seconds);
+}
+CuEngine::Scene::LocalTransform RandomLocalTransform(std::minstd_rand & random)
+{
+    auto value = std::uniform_real_distribution<float>(-1.0f, 1.0f);
+    auto axis  = CuEngine::Math::Normalize(CuEngine::Math::Vec3{ value(random), value(random), 1.0f });
+
+    return { .translation = { value(random), value(random), value(random) },
+             .rotation    = CuEngine::Math::FromAxisAngle(axis, value(random)),
+             .scale       = { 1.0f, 1.0f, 1.0f } };
+}
+
+void MeasureTransforms(std::uint32_t workerCount)
+{
+    auto random    = std::minstd_rand();
+    auto hierarchy = CuEngine::Scene::TransformHierarchy();
+    auto nodes     = std::vector<CuEngine::Scene::TransformNode>();
+    nodes.reserve(entityCount);
+    for (auto index = 0u; index < entityCount; ++index)
+    {
+        auto parent = index < rootCount ? CuEngine::Scene::nullTransformNode
+                                        : nodes[(index - rootCount) / childrenPerNode];
+        nodes.push_back(hierarchy.CreateNode(parent, RandomLocalTransform(random)));
+    }
+    hierarchy.Update();
+
+    // Moving every root dirties the whole hierarchy
+    auto scheduler = CuEngine::Jobs::SchedulerBuilder().SetWorkerCount(workerCount).Build();
+    auto moveRoots = [&hierarchy, &nodes, &random]()
+    {
+        for (auto index = 0u; index < rootCount; ++index)
+        {
+            hierarchy.SetLocalTransform(nodes[index], RandomLocalTransform(random));
+        }
+    };
+    auto seconds = Measure(
+        [&hierarchy, &moveRoots]()
+        {
+            moveRoots();
+            hierarchy.Update();
+        });
+    Report("Update all transforms", seconds);
+
+    seconds = Measure(
+        [&hierarchy, &scheduler, &moveRoots]()
+        {
+            moveRoots();
+            hierarchy.Update(scheduler);
+        });
+    Report("Update all transforms in parallel", seconds);
+
+    // Random nodes are mostly leaves, so this recomputes little more than the nodes that moved
+    seconds = Measure(
+        [&hierarchy, &scheduler, &nodes, &random]()
+        {
+            for (auto index = 0u; index < entityCount / 100; ++index)
+            {
+                hierarchy.SetLocalTransform(nodes[random() % entityCount], RandomLocalTransform(random));
+            }
+            hierarchy.Update(scheduler);
+        });
+    Report("Update 1% of the transforms", seconds);
+    std::cout << "Recomputed " << hierarchy.GetUpdatedCount() << " of " << hierarchy.GetNodeCount()
+              << " world matrices on " << hierarchy.GetLevelCount() << " levels" << std::endl;
+}
+} // namespace
+
+int main()
+{
+    auto hardwareThreadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+    MeasureScene(hardwareThreadCount);
+    MeasureNodes();
+    MeasureTransforms(hardwareThreadCount);
+
+    return EXIT_SUCCESS;
+}
@@ -22,11 +22,35 @@
 
 #pragma once
 
+#include <CuEngine/Platform/FramePacer.hpp>
+
+#include <cstdint>
+#include <string>
+
 namespace CuEngine
 {
+struct ApplicationOptions
+{
+    // Renders into offscreen images without a window, for servers and CI without a display
+    bool isHeadless;
+
+    // Zero runs until the window is closed
+    std::uint32_t frameCount;
+
+    // Part of the device name or its UUID, empty picks the highest scoring device
+    std::string preferredDevice;
+
+    // Headless runs only use the frame rate, a zero rate leaves the fixed rate mode at its default
+    Platform::FramePacingMode framePacing;
+    double                    targetFrameRate;
+
+    // Ticks per second of the simulation, independent of the frame rate, zero keeps the default
+    double simulationTickRate;
+};
+
 class Application
 {
 public:
-    [[nodiscard]] static int Run() noexcept;
+    [[nodiscard]] static int Run(const ApplicationOptions & options) noexcept;
 };
 } // namespace CuEngine
@@ -0,0 +1,75 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Jobs/Counter.hpp>
+#include <CuEngine/Utility/OptimizedPimpl.hpp>
+
+#include <cstdint>
+#include <functional>
+
+namespace CuEngine::Jobs
+{
+namespace Impl
+{
+class Scheduler;
+}
+
+class Scheduler
+{
+public:
+    explicit Scheduler(Impl::Scheduler && scheduler) noexcept;
+
+    Scheduler(const Scheduler &) noexcept = delete;
+
+    Scheduler(Scheduler && other) noexcept;
+
+    Scheduler & operator=(const Scheduler &) noexcept = delete;
+
+    Scheduler & operator=(Scheduler && other) noexcept;
+
+    ~Scheduler() noexcept;
+
+    [[nodiscard]] Counter Schedule(std::function<void()> job);
+
+    // Runs job(0) ... job(count - 1), the counter is done once all of them have finished
+    [[nodiscard]] Counter Schedule(std::uint32_t count, std::function<void(std::uint32_t)> job);
+
+    // The job is only queued once the dependency is done
+    [[nodiscard]] Counter ScheduleAfter(const Counter & dependency, std::function<void()> job);
+
+    // Executes other jobs while waiting, rethrows the first exception thrown by the counter's jobs
+    void Wait(const Counter & counter);
+
+    [[nodiscard]] std::uint32_t GetWorkerCount() const noexcept;
+
+    [[nodiscard]] Impl::Scheduler & GetImpl() noexcept;
+
+private:
+    static constexpr auto memorySize      = sizeof(void *);
+    static constexpr auto memoryAlignment = alignof(void *);
+
+    OptimizedPimpl<Impl::Scheduler, memorySize, memoryAlignment> m_Pimpl;
+};
+
+} // namespace CuEngine::Jobs
@@ -0,0 +1,103 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Math/Matrix.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace CuEngine::Math
+{
+// Structure of arrays: each coordinate is contiguous so one register holds the same coordinate of several points
+struct PointArrays
+{
+    std::span<float> x;
+    std::span<float> y;
+    std::span<float> z;
+};
+
+struct ConstPointArrays
+{
+    std::span<const float> x;
+    std::span<const float> y;
+    std::span<const float> z;
+};
+
+// Structure of arrays for matrices: eight matrices interleaved element by element, elements[column * 4 + row] holds
+// that element of each of them. An AVX2 register covers the whole block and an SSE4.1 register half of it, either way
+// a product needs no shuffles at all. The width is the same in every build so the layout is too
+struct alignas(32) Mat4Block
+{
+    static constexpr std::uint32_t matrixCount = 8;
+
+    float elements[16][matrixCount] = {};
+};
+
+static_assert(sizeof(Mat4Block) == Mat4Block::matrixCount * sizeof(Mat4));
+
+// Blocks needed to hold a number of matrices
+[[nodiscard]] constexpr std::size_t GetBlockCount(std::size_t matrixCount) noexcept
+{
+    return (matrixCount + Mat4Block::matrixCount - 1) / Mat4Block::matrixCount;
+}
+
+// Interleaves matrices into blocks, the lanes past the last matrix are filled with identity. The matrices or the
+// lanes of the blocks, whichever are fewer, bound the count
+void PackMatrices(std::span<const Mat4> matrices, std::span<Mat4Block> blocks) noexcept;
+
+// The inverse of PackMatrices, padding lanes are only read if there are matrices left to fill
+void UnpackMatrices(std::span<const Mat4Block> blocks, std::span<Mat4> matrices) noexcept;
+
+// Affine transform of every point, w is taken as 1 and never divided by. The shortest array bounds the count and the
+// result may be the input itself
+void TransformPoints(const Mat4 & matrix, const ConstPointArrays & points, const PointArrays & result) noexcept;
+
+// result[i] = left[i] * right[i], the shortest span bounds the count and the result may alias either input
+void MultiplyMatrices(std::span<const Mat4> left, std::span<const Mat4> right, std::span<Mat4> result) noexcept;
+
+// Every lane of result[i] = the same lane of left[i] * right[i]. The shortest span bounds the count and the result may
+// alias either input
+void MultiplyMatrices(std::span<const Mat4Block> left, std::span<const Mat4Block> right,
+                      std::span<Mat4Block> result) noexcept;
+
+// result[i] = left[leftIndices[i]] * right[i], gathering e.g. parent matrices. The indices have to be in range and the
+// gathered matrices must not be written by the same call, the result may still alias right
+void MultiplyMatrices(std::span<const Mat4> left, std::span<const std::uint32_t> leftIndices,
+                      std::span<const Mat4> right, std::span<Mat4> result) noexcept;
+
+// Plain loops with the same contract, kept in every build to check and measure the SIMD kernels against
+namespace Scalar
+{
+void TransformPoints(const Mat4 & matrix, const ConstPointArrays & points, const PointArrays & result) noexcept;
+
+void MultiplyMatrices(std::span<const Mat4> left, std::span<const Mat4> right, std::span<Mat4> result) noexcept;
+
+void MultiplyMatrices(std::span<const Mat4Block> left, std::span<const Mat4Block> right,
+                      std::span<Mat4Block> result) noexcept;
+
+void MultiplyMatrices(std::span<const Mat4> left, std::span<const std::uint32_t> leftIndices,
+                      std::span<const Mat4> right, std::span<Mat4> result) noexcept;
+} // namespace Scalar
+} // namespace CuEngine::Math
@@ -0,0 +1,243 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Math/Quaternion.hpp>
+#include <CuEngine/Math/Simd.hpp>
+#include <CuEngine/Math/Vector.hpp>
+
+#include <array>
+#include <cmath>
+
+namespace CuEngine::Math
+{
+// Column-major like the shaders expect and multiplied onto column vectors, the default is the identity
+struct alignas(16) Mat4
+{
+    std::array<Vec4, 4> columns = { Vec4 { 1.0f, 0.0f, 0.0f, 0.0f }, Vec4 { 0.0f, 1.0f, 0.0f, 0.0f },
+                                    Vec4 { 0.0f, 0.0f, 1.0f, 0.0f }, Vec4 { 0.0f, 0.0f, 0.0f, 1.0f } };
+};
+
+static_assert(sizeof(Mat4) == 64);
+
+#if defined(CU_MATH_SIMD)
+namespace Detail
+{
+// left * column for a left matrix already held in registers
+[[nodiscard]] inline __m128 MultiplyColumn(__m128 left0, __m128 left1, __m128 left2, __m128 left3,
+                                           __m128 column) noexcept
+{
+    auto x = _mm_shuffle_ps(column, column, _MM_SHUFFLE(0, 0, 0, 0));
+    auto y = _mm_shuffle_ps(column, column, _MM_SHUFFLE(1, 1, 1, 1));
+    auto z = _mm_shuffle_ps(column, column, _MM_SHUFFLE(2, 2, 2, 2));
+    auto w = _mm_shuffle_ps(column, column, _MM_SHUFFLE(3, 3, 3, 3));
+
+#if defined(CU_MATH_AVX2)
+    auto result = _mm_mul_ps(left0, x);
+    result      = _mm_fmadd_ps(left1, y, result);
+    result      = _mm_fmadd_ps(left2, z, result);
+
+    return _mm_fmadd_ps(left3, w, result);
+#else
+    auto result = _mm_add_ps(_mm_mul_ps(left0, x), _mm_mul_ps(left1, y));
+
+    return _mm_add_ps(result, _mm_add_ps(_mm_mul_ps(left2, z), _mm_mul_ps(left3, w)));
+#endif
+}
+} // namespace Detail
+#endif
+
+[[nodiscard]] inline Vec4 operator*(const Mat4 & matrix, const Vec4 & vector) noexcept
+{
+#if defined(CU_MATH_SIMD)
+    return Detail::StoreVec4(Detail::MultiplyColumn(Detail::Load(matrix.columns[0]), Detail::Load(matrix.columns[1]),
+                                                    Detail::Load(matrix.columns[2]), Detail::Load(matrix.columns[3]),
+                                                    Detail::Load(vector)));
+#else
+    const auto & [c0, c1, c2, c3] = matrix.columns;
+
+    return { c0.x * vector.x + c1.x * vector.y + c2.x * vector.z + c3.x * vector.w,
+             c0.y * vector.x + c1.y * vector.y + c2.y * vector.z + c3.y * vector.w,
+             c0.z * vector.x + c1.z * vector.y + c2.z * vector.z + c3.z * vector.w,
+             c0.w * vector.x + c1.w * vector.y + c2.w * vector.z + c3.w * vector.w };
+#endif
+}
+
+// Applies right first, then left
+[[nodiscard]] inline Mat4 operator*(const Mat4 & left, const Mat4 & right) noexcept
+{
+    Mat4 result;
+
+#if defined(CU_MATH_SIMD)
+    auto left0 = Detail::Load(left.columns[0]);
+    auto left1 = Detail::Load(left.columns[1]);
+    auto left2 = Detail::Load(left.columns[2]);
+    auto left3 = Detail::Load(left.columns[3]);
+
+    for (auto column = 0; column < 4; ++column)
+    {
+        _mm_store_ps(&result.columns[column].x,
+                     Detail::MultiplyColumn(left0, left1, left2, left3, Detail::Load(right.columns[column])));
+    }
+#else
+    for (auto column = 0; column < 4; ++column)
+    {
+        result.columns[column] = left * right.columns[column];
+    }
+#endif
+
+    return result;
+}
+
+// w = 1, translation applies
+[[nodiscard]] inline Vec3 TransformPoint(const Mat4 & matrix, const Vec3 & point) noexcept
+{
+    return ToVec3(matrix * ToVec4(point, 1.0f));
+}
+
+// w = 0, translation is ignored
+[[nodiscard]] inline Vec3 TransformDirection(const Mat4 & matrix, const Vec3 & direction) noexcept
+{
+    return ToVec3(matrix * ToVec4(direction, 0.0f));
+}
+
+[[nodiscard]] inline Mat4 Transpose(const Mat4 & matrix) noexcept
+{
+    Mat4 result;
+
+#if defined(CU_MATH_SIMD)
+    auto c0 = Detail::Load(matrix.columns[0]);
+    auto c1 = Detail::Load(matrix.columns[1]);
+    auto c2 = Detail::Load(matrix.columns[2]);
+    auto c3 = Detail::Load(matrix.columns[3]);
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+    result.columns = { Detail::StoreVec4(c0), Detail::StoreVec4(c1), Detail::StoreVec4(c2), Detail::StoreVec4(c3) };
+#else
+    const auto & [c0, c1, c2, c3] = matrix.columns;
+
+    result.columns = { Vec4 { c0.x, c1.x, c2.x, c3.x }, Vec4 { c0.y, c1.y, c2.y, c3.y },
+                       Vec4 { c0.z, c1.z, c2.z, c3.z }, Vec4 { c0.w, c1.w, c2.w, c3.w } };
+#endif
+
+    return result;
+}
+
+[[nodiscard]] inline Mat4 Translation(const Vec3 & translation) noexcept
+{
+    Mat4 result;
+    result.columns[3] = ToVec4(translation, 1.0f);
+
+    return result;
+}
+
+[[nodiscard]] inline Mat4 Scaling(const Vec3 & scale) noexcept
+{
+    Mat4 result;
+    result.columns[0].x = scale.x;
+    result.columns[1].y = scale.y;
+    result.columns[2].z = scale.z;
+
+    return result;
+}
+
+// The quaternion has to be normalized
+[[nodiscard]] inline Mat4 Rotation(const Quat & rotation) noexcept
+{
+    auto [x, y, z, w] = rotation;
+
+    Mat4 result;
+    result.columns[0] = { 1.0f - 2.0f * (y * y + z * z), 2.0f * (x * y + w * z), 2.0f * (x * z - w * y), 0.0f };
+    result.columns[1] = { 2.0f * (x * y - w * z), 1.0f - 2.0f * (x * x + z * z), 2.0f * (y * z + w * x), 0.0f };
+    result.columns[2] = { 2.0f * (x * z + w * y), 2.0f * (y * z - w * x), 1.0f - 2.0f * (x * x + y * y), 0.0f };
+
+    return result;
+}
+
+// Translation * Rotation * Scaling without the two matrix products
+[[nodiscard]] inline Mat4 Compose(const Vec3 & translation, const Quat & rotation, const Vec3 & scale) noexcept
+{
+    auto result       = Rotation(rotation);
+    result.columns[0] = result.columns[0] * scale.x;
+    result.columns[1] = result.columns[1] * scale.y;
+    result.columns[2] = result.columns[2] * scale.z;
+    result.columns[3] = ToVec4(translation, 1.0f);
+
+    return result;
+}
+
+// Only valid for matrices whose last row is 0, 0, 0, 1, which covers everything Compose and LookAt build
+[[nodiscard]] inline Mat4 InverseAffine(const Mat4 & matrix) noexcept
+{
+    auto a = ToVec3(matrix.columns[0]);
+    auto b = ToVec3(matrix.columns[1]);
+    auto c = ToVec3(matrix.columns[2]);
+    auto t = ToVec3(matrix.columns[3]);
+
+    // The rows of the inverse 3x3 are the pairwise cross products of its columns over the determinant
+    auto bc      = Cross(b, c);
+    auto inverse = 1.0f / Dot(a, bc);
+    auto row0    = bc * inverse;
+    auto row1    = Cross(c, a) * inverse;
+    auto row2    = Cross(a, b) * inverse;
+
+    Mat4 result;
+    result.columns[0] = ToVec4(row0, -Dot(row0, t));
+    result.columns[1] = ToVec4(row1, -Dot(row1, t));
+    result.columns[2] = ToVec4(row2, -Dot(row2, t));
+    result.columns[3] = { 0.0f, 0.0f, 0.0f, 1.0f };
+
+    return Transpose(result);
+}
+
+// Right-handed view space looking down -Z
+[[nodiscard]] inline Mat4 LookAt(const Vec3 & eye, const Vec3 & target, const Vec3 & up) noexcept
+{
+    auto forward = Normalize(target - eye);
+    auto side    = Normalize(Cross(forward, up));
+    auto top     = Cross(side, forward);
+
+    Mat4 result;
+    result.columns[0] = { side.x, top.x, -forward.x, 0.0f };
+    result.columns[1] = { side.y, top.y, -forward.y, 0.0f };
+    result.columns[2] = { side.z, top.z, -forward.z, 0.0f };
+    result.columns[3] = { -Dot(side, eye), -Dot(top, eye), Dot(forward, eye), 1.0f };
+
+    return result;
+}
+
+// Vulkan clip space: depth from 0 at the near plane to 1 at the far plane and Y pointing down
+[[nodiscard]] inline Mat4 Perspective(float verticalFov, float aspectRatio, float nearPlane, float farPlane) noexcept
+{
+    auto focal = 1.0f / std::tan(verticalFov * 0.5f);
+    auto range = 1.0f / (nearPlane - farPlane);
+
+    Mat4 result;
+    result.columns[0] = { focal / aspectRatio, 0.0f, 0.0f, 0.0f };
+    result.columns[1] = { 0.0f, -focal, 0.0f, 0.0f };
+    result.columns[2] = { 0.0f, 0.0f, farPlane * range, -1.0f };
+    result.columns[3] = { 0.0f, 0.0f, nearPlane * farPlane * range, 0.0f };
+
+    return result;
+}
+} // namespace CuEngine::Math
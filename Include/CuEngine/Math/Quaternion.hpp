@@ -0,0 +1,162 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Math/Simd.hpp>
+#include <CuEngine/Math/Vector.hpp>
+
+#include <cmath>
+
+namespace CuEngine::Math
+{
+// Unit quaternion rotations, the default is the identity
+struct alignas(16) Quat
+{
+    float x = 0.0f;
+    float y = 0.0f;
+    float z = 0.0f;
+    float w = 1.0f;
+};
+
+static_assert(sizeof(Quat) == 16);
+
+#if defined(CU_MATH_SIMD)
+namespace Detail
+{
+[[nodiscard]] inline __m128 Load(const Quat & quat) noexcept
+{
+    return _mm_load_ps(&quat.x);
+}
+
+[[nodiscard]] inline Quat StoreQuat(__m128 value) noexcept
+{
+    Quat result;
+    _mm_store_ps(&result.x, value);
+
+    return result;
+}
+} // namespace Detail
+#endif
+
+// The axis has to be normalized
+[[nodiscard]] inline Quat FromAxisAngle(const Vec3 & axis, float angle) noexcept
+{
+    auto sine = std::sin(angle * 0.5f);
+
+    return { axis.x * sine, axis.y * sine, axis.z * sine, std::cos(angle * 0.5f) };
+}
+
+// Applies right first, then left
+[[nodiscard]] inline Quat operator*(const Quat & left, const Quat & right) noexcept
+{
+#if defined(CU_MATH_SIMD)
+    auto r = Detail::Load(right);
+
+    // Each lane of left scales a permutation of right with alternating signs
+    auto wzyx = _mm_xor_ps(_mm_shuffle_ps(r, r, _MM_SHUFFLE(0, 1, 2, 3)), _mm_set_ps(-0.0f, 0.0f, -0.0f, 0.0f));
+    auto zwxy = _mm_xor_ps(_mm_shuffle_ps(r, r, _MM_SHUFFLE(1, 0, 3, 2)), _mm_set_ps(-0.0f, -0.0f, 0.0f, 0.0f));
+    auto yxwz = _mm_xor_ps(_mm_shuffle_ps(r, r, _MM_SHUFFLE(2, 3, 0, 1)), _mm_set_ps(-0.0f, 0.0f, 0.0f, -0.0f));
+
+    auto result = _mm_mul_ps(_mm_set1_ps(left.w), r);
+    result      = _mm_add_ps(result, _mm_mul_ps(_mm_set1_ps(left.x), wzyx));
+    result      = _mm_add_ps(result, _mm_mul_ps(_mm_set1_ps(left.y), zwxy));
+    result      = _mm_add_ps(result, _mm_mul_ps(_mm_set1_ps(left.z), yxwz));
+
+    return Detail::StoreQuat(result);
+#else
+    return { left.w * right.x + left.x * right.w + left.y * right.z - left.z * right.y,
+             left.w * right.y - left.x * right.z + left.y * right.w + left.z * right.x,
+             left.w * right.z + left.x * right.y - left.y * right.x + left.z * right.w,
+             left.w * right.w - left.x * right.x - left.y * right.y - left.z * right.z };
+#endif
+}
+
+[[nodiscard]] inline Quat Conjugate(const Quat & quat) noexcept
+{
+    return { -quat.x, -quat.y, -quat.z, quat.w };
+}
+
+[[nodiscard]] inline float Dot(const Quat & left, const Quat & right) noexcept
+{
+#if defined(CU_MATH_SIMD)
+    return _mm_cvtss_f32(_mm_dp_ps(Detail::Load(left), Detail::Load(right), 0xF1));
+#else
+    return left.x * right.x + left.y * right.y + left.z * right.z + left.w * right.w;
+#endif
+}
+
+// A zero quaternion becomes the identity
+[[nodiscard]] inline Quat Normalize(const Quat & quat) noexcept
+{
+    auto length = std::sqrt(Dot(quat, quat));
+    if (length <= 0.0f)
+    {
+        return {};
+    }
+
+    auto inverse = 1.0f / length;
+
+    return { quat.x * inverse, quat.y * inverse, quat.z * inverse, quat.w * inverse };
+}
+
+[[nodiscard]] inline Vec3 Rotate(const Quat & quat, const Vec3 & vector) noexcept
+{
+    // v + w * t + u x t with t = 2 * u x v, two cross products instead of building the matrix
+    auto axis = Vec3 { quat.x, quat.y, quat.z };
+    auto t    = Cross(axis, vector) * 2.0f;
+
+    return vector + t * quat.w + Cross(axis, t);
+}
+
+// Takes the shorter arc, cheaper than Slerp and close enough for small steps like frame interpolation
+[[nodiscard]] inline Quat Nlerp(const Quat & from, const Quat & to, float alpha) noexcept
+{
+    auto sign = Dot(from, to) < 0.0f ? -1.0f : 1.0f;
+    auto a    = 1.0f - alpha;
+    auto b    = alpha * sign;
+
+    return Normalize(
+        Quat { from.x * a + to.x * b, from.y * a + to.y * b, from.z * a + to.z * b, from.w * a + to.w * b });
+}
+
+// Constant angular velocity along the shorter arc
+[[nodiscard]] inline Quat Slerp(const Quat & from, const Quat & to, float alpha) noexcept
+{
+    auto cosine = Dot(from, to);
+    auto sign   = cosine < 0.0f ? -1.0f : 1.0f;
+    cosine *= sign;
+
+    // Nearly parallel quaternions divide by a vanishing sine, interpolating linearly is exact enough there
+    if (cosine > 0.9995f)
+    {
+        return Nlerp(from, to, alpha);
+    }
+
+    auto angle = std::acos(cosine);
+    auto sine  = std::sin(angle);
+    auto a     = std::sin((1.0f - alpha) * angle) / sine;
+    auto b     = std::sin(alpha * angle) / sine * sign;
+
+    return { from.x * a + to.x * b, from.y * a + to.y * b, from.z * a + to.z * b, from.w * a + to.w * b };
+}
+} // namespace CuEngine::Math
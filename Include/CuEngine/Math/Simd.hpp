@@ -0,0 +1,50 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <string_view>
+
+// The build picks one instruction set for the whole engine, see CUENGINE_SIMD. Everything that includes the math
+// headers has to be compiled with the same choice, the types are identical but the inline functions are not
+#if defined(CU_MATH_AVX2) && !(defined(__AVX2__) && (defined(__FMA__) || defined(_MSC_VER)))
+#error "CU_MATH_AVX2 requires compiling for AVX2 and FMA"
+#endif
+
+#if defined(CU_MATH_AVX2) || defined(CU_MATH_SSE41)
+#define CU_MATH_SIMD
+#include <immintrin.h>
+#endif
+
+namespace CuEngine::Math
+{
+[[nodiscard]] constexpr std::string_view GetInstructionSetName() noexcept
+{
+#if defined(CU_MATH_AVX2)
+    return "AVX2";
+#elif defined(CU_MATH_SSE41)
+    return "SSE4.1";
+#else
+    return "Scalar";
+#endif
+}
+} // namespace CuEngine::Math
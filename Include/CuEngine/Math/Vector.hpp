@@ -0,0 +1,274 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Math/Simd.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace CuEngine::Math
+{
+// One SIMD register wide so arrays of them can be loaded without shuffling
+struct alignas(16) Vec4
+{
+    float x = 0.0f;
+    float y = 0.0f;
+    float z = 0.0f;
+    float w = 0.0f;
+};
+
+// Padded to a full register, the padding stays zero so whole-register operations leave it alone
+struct alignas(16) Vec3
+{
+    float x       = 0.0f;
+    float y       = 0.0f;
+    float z       = 0.0f;
+    float padding = 0.0f;
+};
+
+static_assert(sizeof(Vec4) == 16 && sizeof(Vec3) == 16);
+
+#if defined(CU_MATH_SIMD)
+namespace Detail
+{
+[[nodiscard]] inline __m128 Load(const Vec4 & vector) noexcept
+{
+    return _mm_load_ps(&vector.x);
+}
+
+[[nodiscard]] inline __m128 Load(const Vec3 & vector) noexcept
+{
+    return _mm_load_ps(&vector.x);
+}
+
+[[nodiscard]] inline Vec4 StoreVec4(__m128 value) noexcept
+{
+    Vec4 result;
+    _mm_store_ps(&result.x, value);
+
+    return result;
+}
+
+// Clears the fourth lane to keep the padding invariant
+[[nodiscard]] inline Vec3 StoreVec3(__m128 value) noexcept
+{
+    Vec3 result;
+    _mm_store_ps(&result.x, _mm_blend_ps(value, _mm_setzero_ps(), 0x8));
+
+    return result;
+}
+} // namespace Detail
+#endif
+
+[[nodiscard]] inline Vec4 operator+(const Vec4 & left, const Vec4 & right) noexcept
+{
+#if defined(CU_MATH_SIMD)
+    return Detail::StoreVec4(_mm_add_ps(Detail::Load(left), Detail::Load(right)));
+#else
+    return { left.x + right.x, left.y + right.y, left.z + right.z, left.w + right.w };
+#endif
+}
+
+[[nodiscard]] inline Vec4 operator-(const Vec4 & left, const Vec4 & right) noexcept
+{
+#if defined(CU_MATH_SIMD)
+    return Detail::StoreVec4(_mm_sub_ps(Detail::Load(left), Detail::Load(right)));
+#else
+    return { left.x - right.x, left.y - right.y, left.z - right.z, left.w - right.w };
+#endif
+}
+
+// Component-wise
+[[nodiscard]] inline Vec4 operator*(const Vec4 & left, const Vec4 & right) noexcept
+{
+#if defined(CU_MATH_SIMD)
+    return Detail::StoreVec4(_mm_mul_ps(Detail::Load(left), Detail::Load(right)));
+#else
+    return { left.x * right.x, left.y * right.y, left.z * right.z, left.w * right.w };
+#endif
+}
+
+[[nodiscard]] inline Vec4 operator*(const Vec4 & vector, float scale) noexcept
+{
+#if defined(CU_MATH_SIMD)
+    return Detail::StoreVec4(_mm_mul_ps(Detail::Load(vector), _mm_set1_ps(scale)));
+#else
+    return { vector.x * scale, vector.y * scale, vector.z * scale, vector.w * scale };
+#endif
+}
+
+[[nodiscard]] inline Vec4 operator*(float scale, const Vec4 & vector) noexcept
+{
+    return vector * scale;
+}
+
+[[nodiscard]] inline Vec4 Min(const Vec4 & left, const Vec4 & right) noexcept
+{
+#if defined(CU_MATH_SIMD)
+    return Detail::StoreVec4(_mm_min_ps(Detail::Load(left), Detail::Load(right)));
+#else
+    return { std::min(left.x, right.x), std::min(left.y, right.y), std::min(left.z, right.z),
+             std::min(left.w, right.w) };
+#endif
+}
+
+[[nodiscard]] inline Vec4 Max(const Vec4 & left, const Vec4 & right) noexcept
+{
+#if defined(CU_MATH_SIMD)
+    return Detail::StoreVec4(_mm_max_ps(Detail::Load(left), Detail::Load(right)));
+#else
+    return { std::max(left.x, right.x), std::max(left.y, right.y), std::max(left.z, right.z),
+             std::max(left.w, right.w) };
+#endif
+}
+
+[[nodiscard]] inline float Dot(const Vec4 & left, const Vec4 & right) noexcept
+{
+#if defined(CU_MATH_SIMD)
+    return _mm_cvtss_f32(_mm_dp_ps(Detail::Load(left), Detail::Load(right), 0xF1));
+#else
+    return left.x * right.x + left.y * right.y + left.z * right.z + left.w * right.w;
+#endif
+}
+
+[[nodiscard]] inline float Length(const Vec4 & vector) noexcept
+{
+    return std::sqrt(Dot(vector, vector));
+}
+
+// The zero vector stays zero
+[[nodiscard]] inline Vec4 Normalize(const Vec4 & vector) noexcept
+{
+    auto length = Length(vector);
+
+    return length > 0.0f ? vector * (1.0f / length) : Vec4 {};
+}
+
+[[nodiscard]] inline Vec4 Lerp(const Vec4 & from, const Vec4 & to, float alpha) noexcept
+{
+    return from + (to - from) * alpha;
+}
+
+[[nodiscard]] inline Vec3 operator+(const Vec3 & left, const Vec3 & right) noexcept
+{
+#if defined(CU_MATH_SIMD)
+    return Detail::StoreVec3(_mm_add_ps(Detail::Load(left), Detail::Load(right)));
+#else
+    return { left.x + right.x, left.y + right.y, left.z + right.z };
+#endif
+}
+
+[[nodiscard]] inline Vec3 operator-(const Vec3 & left, const Vec3 & right) noexcept
+{
+#if defined(CU_MATH_SIMD)
+    return Detail::StoreVec3(_mm_sub_ps(Detail::Load(left), Detail::Load(right)));
+#else
+    return { left.x - right.x, left.y - right.y, left.z - right.z };
+#endif
+}
+
+[[nodiscard]] inline Vec3 operator-(const Vec3 & vector) noexcept
+{
+    return Vec3 {} - vector;
+}
+
+// Component-wise
+[[nodiscard]] inline Vec3 operator*(const Vec3 & left, const Vec3 & right) noexcept
+{
+#if defined(CU_MATH_SIMD)
+    return Detail::StoreVec3(_mm_mul_ps(Detail::Load(left), Detail::Load(right)));
+#else
+    return { left.x * right.x, left.y * right.y, left.z * right.z };
+#endif
+}
+
+[[nodiscard]] inline Vec3 operator*(const Vec3 & vector, float scale) noexcept
+{
+#if defined(CU_MATH_SIMD)
+    return Detail::StoreVec3(_mm_mul_ps(Detail::Load(vector), _mm_set1_ps(scale)));
+#else
+    return { vector.x * scale, vector.y * scale, vector.z * scale };
+#endif
+}
+
+[[nodiscard]] inline Vec3 operator*(float scale, const Vec3 & vector) noexcept
+{
+    return vector * scale;
+}
+
+[[nodiscard]] inline float Dot(const Vec3 & left, const Vec3 & right) noexcept
+{
+#if defined(CU_MATH_SIMD)
+    return _mm_cvtss_f32(_mm_dp_ps(Detail::Load(left), Detail::Load(right), 0x71));
+#else
+    return left.x * right.x + left.y * right.y + left.z * right.z;
+#endif
+}
+
+[[nodiscard]] inline Vec3 Cross(const Vec3 & left, const Vec3 & right) noexcept
+{
+#if defined(CU_MATH_SIMD)
+    // left.yzx * right.zxy - left.zxy * right.yzx, computed as (left * right.yzx - left.yzx * right).yzx
+    auto a = Detail::Load(left);
+    auto b = Detail::Load(right);
+
+    auto aYzx = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+    auto bYzx = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+    auto c    = _mm_sub_ps(_mm_mul_ps(a, bYzx), _mm_mul_ps(aYzx, b));
+
+    return Detail::StoreVec3(_mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1)));
+#else
+    return { left.y * right.z - left.z * right.y, left.z * right.x - left.x * right.z,
+             left.x * right.y - left.y * right.x };
+#endif
+}
+
+[[nodiscard]] inline float Length(const Vec3 & vector) noexcept
+{
+    return std::sqrt(Dot(vector, vector));
+}
+
+// The zero vector stays zero
+[[nodiscard]] inline Vec3 Normalize(const Vec3 & vector) noexcept
+{
+    auto length = Length(vector);
+
+    return length > 0.0f ? vector * (1.0f / length) : Vec3 {};
+}
+
+[[nodiscard]] inline Vec3 Lerp(const Vec3 & from, const Vec3 & to, float alpha) noexcept
+{
+    return from + (to - from) * alpha;
+}
+
+[[nodiscard]] inline Vec4 ToVec4(const Vec3 & vector, float w) noexcept
+{
+    return { vector.x, vector.y, vector.z, w };
+}
+
+[[nodiscard]] inline Vec3 ToVec3(const Vec4 & vector) noexcept
+{
+    return { vector.x, vector.y, vector.z };
+}
+} // namespace CuEngine::Math
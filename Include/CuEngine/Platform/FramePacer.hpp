@@ -0,0 +1,85 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Utility/OptimizedPimpl.hpp>
+
+#include <cstdint>
+
+namespace CuEngine::Platform
+{
+
+namespace Impl
+{
+class FramePacer;
+}
+
+class Window;
+
+enum class FramePacingMode : std::uint8_t
+{
+    // Renders as fast as the swapchain allows
+    Uncapped,
+    // Renders at the target frame rate, sleeping between frames
+    FixedRate,
+    // Sleeps until window activity and renders only after input or a redraw request
+    OnDemand
+};
+
+// Decides when the render loop draws the next frame, minimized windows never do
+class FramePacer
+{
+public:
+    explicit FramePacer(Impl::FramePacer && framePacer) noexcept;
+
+    FramePacer(const FramePacer &) = delete;
+
+    FramePacer(FramePacer && other) noexcept;
+
+    FramePacer & operator=(const FramePacer &) = delete;
+
+    FramePacer & operator=(FramePacer && other) noexcept;
+
+    ~FramePacer() noexcept;
+
+    // Meant for the render thread, the window's events are pumped on the main thread meanwhile.
+    // Returns whether a frame should be rendered now, the window has to outlive the pacer
+    [[nodiscard]] bool WaitForFrame(Window & window);
+
+    // Without a window only the frame rate is paced
+    [[nodiscard]] bool WaitForFrame();
+
+    // Wakes a waiting render-on-demand loop, callable from any thread
+    void RequestRedraw() noexcept;
+
+    [[nodiscard]] FramePacingMode GetMode() const noexcept;
+
+    [[nodiscard]] Impl::FramePacer & GetImpl() noexcept;
+
+private:
+    static constexpr auto memorySize      = sizeof(void *);
+    static constexpr auto memoryAlignment = alignof(void *);
+
+    OptimizedPimpl<Impl::FramePacer, memorySize, memoryAlignment> m_Pimpl;
+};
+} // namespace CuEngine::Platform
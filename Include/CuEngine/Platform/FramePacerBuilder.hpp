@@ -0,0 +1,75 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Platform/FramePacer.hpp>
+#include <CuEngine/Utility/OptimizedPimpl.hpp>
+
+#include <chrono>
+#include <cstdint>
+
+namespace CuEngine::Platform
+{
+
+namespace Impl
+{
+class FramePacerBuilder;
+}
+
+class FramePacerBuilder
+{
+public:
+    FramePacerBuilder();
+
+    FramePacerBuilder(const FramePacerBuilder & other);
+
+    FramePacerBuilder(FramePacerBuilder && other) noexcept;
+
+    FramePacerBuilder & operator=(const FramePacerBuilder & other);
+
+    FramePacerBuilder & operator=(FramePacerBuilder && other) noexcept;
+
+    ~FramePacerBuilder() noexcept;
+
+    FramePacerBuilder & SetMode(FramePacingMode mode) noexcept;
+
+    // Frames per second for the fixed rate mode and the cap of the render-on-demand mode, zero is uncapped
+    FramePacerBuilder & SetTargetFrameRate(double frameRate) noexcept;
+
+    // Applies while the window is not focused, zero keeps the target frame rate
+    FramePacerBuilder & SetBackgroundFrameRate(double frameRate) noexcept;
+
+    // Longest a single wait for events blocks, so the loop still gets to its periodic work
+    FramePacerBuilder & SetIdleTimeout(std::chrono::milliseconds timeout) noexcept;
+
+    [[nodiscard]] FramePacer Build() const;
+
+    [[nodiscard]] Impl::FramePacerBuilder & GetImpl() noexcept;
+
+private:
+    static constexpr auto memorySize      = sizeof(std::int64_t) * 4;
+    static constexpr auto memoryAlignment = alignof(std::int64_t);
+
+    OptimizedPimpl<Impl::FramePacerBuilder, memorySize, memoryAlignment> m_Pimpl;
+};
+} // namespace CuEngine::Platform
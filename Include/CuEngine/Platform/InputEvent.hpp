@@ -0,0 +1,52 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace CuEngine::Platform
+{
+enum class InputEventType : std::uint8_t
+{
+    Key,
+    Character,
+    MouseButton,
+    CursorPosition,
+    Scroll
+};
+
+// Values follow GLFW: key and button codes, GLFW_PRESS, GLFW_RELEASE and GLFW_REPEAT for the action
+struct InputEvent
+{
+    // Taken in the OS callback, so consumers can tell how long the event waited for them
+    std::chrono::steady_clock::time_point timestamp = {};
+    InputEventType                        type      = InputEventType::Key;
+    std::int32_t                          code      = 0;
+    std::int32_t                          scancode  = 0;
+    std::int32_t                          action    = 0;
+    std::int32_t                          modifiers = 0;
+    double                                x         = 0.0;
+    double                                y         = 0.0;
+};
+} // namespace CuEngine::Platform
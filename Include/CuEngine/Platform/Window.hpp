@@ -22,8 +22,13 @@
 
 #pragma once
 
+#include <CuEngine/Platform/InputEvent.hpp>
 #include <CuEngine/Utility/OptimizedPimpl.hpp>
 
+#include <chrono>
+#include <cstdint>
+#include <functional>
+
 namespace CuEngine::Platform
 {
 
@@ -45,9 +50,48 @@ public:
 
     Window & operator=(Window && other) noexcept;
 
+    // Any thread
     [[nodiscard]] bool ShouldClose() const noexcept;
 
-    void PollEvents() noexcept;
+    // Any thread, also wakes the main thread so it notices
+    void RequestClose() noexcept;
+
+    // Main thread only, resize and minimize callbacks run from here
+    void PollEvents();
+
+    // Main thread only, returns early as soon as an event arrives
+    void WaitEvents(std::chrono::nanoseconds timeout);
+
+    // Any thread, wakes the main thread out of WaitEvents
+    static void PostEmptyEvent() noexcept;
+
+    // Called once per event pump with the final framebuffer size, however many resizes happened in between
+    void SetResizeCallback(std::function<void(std::uint32_t width, std::uint32_t height)> callback) noexcept;
+
+    void SetMinimizeCallback(std::function<void(bool isMinimized)> callback) noexcept;
+
+    // Input reaches exactly one consumer thread through a lock-free queue filled by the event pump
+    [[nodiscard]] bool PopInputEvent(InputEvent & event) noexcept;
+
+    // Events lost because the consumer fell a whole queue behind
+    [[nodiscard]] std::uint64_t GetDroppedInputEventCount() const noexcept;
+
+    // The queries below are safe from any thread and reflect the last event pump
+    [[nodiscard]] std::uint32_t GetWidth() const noexcept;
+
+    [[nodiscard]] std::uint32_t GetHeight() const noexcept;
+
+    [[nodiscard]] bool IsMinimized() const noexcept;
+
+    [[nodiscard]] bool IsFocused() const noexcept;
+
+    // Blocks until events arrive, NotifyActivity is called or the timeout passes
+    void WaitForActivity(std::chrono::nanoseconds timeout) const;
+
+    void NotifyActivity() noexcept;
+
+    // Whether input or window events arrived since the last call
+    [[nodiscard]] bool ConsumeActivity() noexcept;
 
     ~Window() noexcept;
 
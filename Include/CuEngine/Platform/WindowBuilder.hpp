@@ -60,12 +60,15 @@ public:
 
     WindowBuilder & SetTitle(const std::string & title) noexcept;
 
+    // Resizes reach the window's resize callback, the swapchain has to be recreated after them
+    WindowBuilder & SetResizable(bool isResizable) noexcept;
+
     [[nodiscard]] Window Build() const;
 
     [[nodiscard]] Impl::WindowBuilder & GetImpl() noexcept;
 
 private:
-    static constexpr auto memorySize      = sizeof(std::size_t) * 2 + sizeof(std::string);
+    static constexpr auto memorySize      = sizeof(std::size_t) * 3 + sizeof(std::string);
     static constexpr auto memoryAlignment = std::max(alignof(std::size_t), alignof(std::string));
 
     OptimizedPimpl<Impl::WindowBuilder, memorySize, memoryAlignment> m_Pimpl;
@@ -0,0 +1,102 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <string_view>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#elif defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+namespace CuEngine::Profiling
+{
+// Raw time stamp counter ticks where there is one, they are calibrated against the steady clock when a capture is
+// written. Reading the counter costs a fraction of reading the steady clock
+[[nodiscard]] inline std::uint64_t GetTimestamp() noexcept
+{
+#if defined(_M_X64) || defined(__x86_64__)
+    return __rdtsc();
+#else
+    return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+// The name has to outlive the capture, string literals are the intended use
+void Record(const char * name, std::uint64_t begin, std::uint64_t end) noexcept;
+
+void SetThreadName(std::string_view name);
+
+// Records the time since the previous mark as a frame of the calling thread and counts down a running capture
+void MarkFrame();
+
+// Captures every thread from now until frameCount frames were marked, then writes Chrome trace JSON that Perfetto
+// opens as well. The ring of a thread holds its latest events only, so long captures of busy threads lose the start
+void CaptureFrames(std::uint32_t frameCount, std::filesystem::path path);
+
+// Writes a running capture right away, for example when the application quits before it is complete
+void FlushCapture();
+
+[[nodiscard]] bool IsCapturing() noexcept;
+
+class Zone
+{
+public:
+    explicit Zone(const char * name) noexcept : m_Name(name), m_Begin(GetTimestamp())
+    {}
+
+    Zone(const Zone &) = delete;
+
+    Zone(Zone &&) = delete;
+
+    Zone & operator=(const Zone &) = delete;
+
+    Zone & operator=(Zone &&) = delete;
+
+    ~Zone() noexcept
+    {
+        Record(m_Name, m_Begin, GetTimestamp());
+    }
+
+private:
+    const char *  m_Name;
+    std::uint64_t m_Begin;
+};
+} // namespace CuEngine::Profiling
+
+#define CU_PROFILE_CONCATENATE_IMPL(left, right) left##right
+#define CU_PROFILE_CONCATENATE(left, right)      CU_PROFILE_CONCATENATE_IMPL(left, right)
+
+#if defined(CU_ENABLE_PROFILING)
+#define CU_PROFILE_SCOPE(name)  const ::CuEngine::Profiling::Zone CU_PROFILE_CONCATENATE(profileZone, __LINE__)(name)
+#define CU_PROFILE_FRAME()      ::CuEngine::Profiling::MarkFrame()
+#define CU_PROFILE_THREAD(name) ::CuEngine::Profiling::SetThreadName(name)
+#else
+#define CU_PROFILE_SCOPE(name)  static_cast<void>(0)
+#define CU_PROFILE_FRAME()      static_cast<void>(0)
+#define CU_PROFILE_THREAD(name) static_cast<void>(0)
+#endif
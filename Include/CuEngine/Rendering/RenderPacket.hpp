@@ -0,0 +1,171 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <vector>
+
+namespace CuEngine::Rendering
+{
+// Column-major like the shaders expect, the default is the identity
+struct ViewParameters
+{
+    std::array<float, 16> viewProjection = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+                                             0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f };
+    std::array<float, 4>  clearColor     = { 0.0f, 0.0f, 0.0f, 1.0f };
+    std::uint32_t         width          = 0;
+    std::uint32_t         height         = 0;
+};
+
+// Sorting by the key alone orders draws by layer, then pipeline and material to minimize state changes, then depth
+struct DrawItem
+{
+    std::uint64_t key            = 0;
+    std::uint32_t instanceOffset = 0;
+    std::uint32_t instanceCount  = 0;
+    std::uint32_t instanceStride = 0;
+};
+
+[[nodiscard]] constexpr std::uint64_t MakeDrawKey(std::uint8_t layer, std::uint16_t pipeline, std::uint16_t material,
+                                                  std::uint32_t depth) noexcept
+{
+    constexpr auto depthBits = 24u;
+    constexpr auto depthMask = (std::uint64_t(1) << depthBits) - 1;
+
+    return std::uint64_t(layer) << 56 | std::uint64_t(pipeline) << 40 | std::uint64_t(material) << depthBits
+           | (depth & depthMask);
+}
+
+// Everything the render thread needs for one frame, written by the frame thread without touching the heap: the
+// storage is reserved once and a full packet drops further draws instead of growing
+class RenderPacket
+{
+public:
+    RenderPacket(std::uint32_t drawCapacity, std::uint32_t instanceDataCapacity)
+        : m_Frame(0), m_View(), m_DrawCount(0), m_Draws(drawCapacity), m_InstanceDataSize(0),
+          m_InstanceData(instanceDataCapacity), m_DroppedDrawCount(0)
+    {}
+
+    RenderPacket(const RenderPacket & other) = delete;
+
+    RenderPacket(RenderPacket && other) noexcept = default;
+
+    RenderPacket & operator=(const RenderPacket & other) = delete;
+
+    RenderPacket & operator=(RenderPacket && other) noexcept = default;
+
+    ~RenderPacket() noexcept = default;
+
+    void Reset(std::uint64_t frame) noexcept
+    {
+        m_Frame            = frame;
+        m_View             = ViewParameters();
+        m_DrawCount        = 0;
+        m_InstanceDataSize = 0;
+        m_DroppedDrawCount = 0;
+    }
+
+    // Copies the instances into the packet, false when it is full and the draw was dropped
+    bool AddDraw(std::uint64_t key, const void * instanceData, std::uint32_t instanceStride,
+                 std::uint32_t instanceCount) noexcept
+    {
+        // Keeps every instance block aligned for vector loads on the render thread
+        constexpr auto instanceAlignment = std::uint32_t(16);
+
+        auto offset = (m_InstanceDataSize + instanceAlignment - 1) & ~(instanceAlignment - 1);
+        auto size   = std::uint64_t(instanceStride) * instanceCount;
+        if (m_DrawCount == m_Draws.size() || offset + size > m_InstanceData.size())
+        {
+            ++m_DroppedDrawCount;
+            return false;
+        }
+
+        if (size != 0)
+        {
+            std::memcpy(m_InstanceData.data() + offset, instanceData, size);
+        }
+        m_Draws[m_DrawCount++] = DrawItem{
+            .key = key, .instanceOffset = offset, .instanceCount = instanceCount, .instanceStride = instanceStride
+        };
+        m_InstanceDataSize = static_cast<std::uint32_t>(offset + size);
+
+        return true;
+    }
+
+    // Sorting happens on the frame thread, so the render thread only walks the draws in order
+    void SortDraws() noexcept
+    {
+        std::sort(m_Draws.begin(), m_Draws.begin() + m_DrawCount,
+                  [](const DrawItem & left, const DrawItem & right)
+                  {
+                      return left.key < right.key;
+                  });
+    }
+
+    [[nodiscard]] std::uint64_t GetFrame() const noexcept
+    {
+        return m_Frame;
+    }
+
+    [[nodiscard]] ViewParameters & GetView() noexcept
+    {
+        return m_View;
+    }
+
+    [[nodiscard]] const ViewParameters & GetView() const noexcept
+    {
+        return m_View;
+    }
+
+    [[nodiscard]] std::span<const DrawItem> GetDraws() const noexcept
+    {
+        return std::span(m_Draws.data(), m_DrawCount);
+    }
+
+    [[nodiscard]] std::span<const std::byte> GetInstanceData(const DrawItem & draw) const noexcept
+    {
+        return std::span(m_InstanceData.data() + draw.instanceOffset,
+                         std::size_t(draw.instanceStride) * draw.instanceCount);
+    }
+
+    [[nodiscard]] std::uint32_t GetDroppedDrawCount() const noexcept
+    {
+        return m_DroppedDrawCount;
+    }
+
+private:
+    std::uint64_t          m_Frame;
+    ViewParameters         m_View;
+    std::uint32_t          m_DrawCount;
+    std::vector<DrawItem>  m_Draws;
+    std::uint32_t          m_InstanceDataSize;
+    std::vector<std::byte> m_InstanceData;
+    std::uint32_t          m_DroppedDrawCount;
+};
+} // namespace CuEngine::Rendering
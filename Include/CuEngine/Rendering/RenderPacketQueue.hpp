@@ -0,0 +1,82 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Rendering/RenderPacket.hpp>
+#include <CuEngine/Utility/OptimizedPimpl.hpp>
+
+#include <cstdint>
+#include <stop_token>
+
+namespace CuEngine::Rendering
+{
+namespace Impl
+{
+class RenderPacketQueue;
+}
+
+// Two packets in flight: the frame thread fills frame N while the render thread translates frame N - 1. Either side
+// waits only when it is a whole frame ahead of the other
+class RenderPacketQueue
+{
+public:
+    explicit RenderPacketQueue(Impl::RenderPacketQueue && renderPacketQueue) noexcept;
+
+    RenderPacketQueue(const RenderPacketQueue &) = delete;
+
+    RenderPacketQueue(RenderPacketQueue && other) noexcept;
+
+    RenderPacketQueue & operator=(const RenderPacketQueue &) = delete;
+
+    RenderPacketQueue & operator=(RenderPacketQueue && other) noexcept;
+
+    ~RenderPacketQueue() noexcept;
+
+    // Frame thread only. The packet is reset for the frame, null once the queue is closed or the wait is stopped
+    [[nodiscard]] RenderPacket * BeginWrite(std::uint64_t frame, std::stop_token stopToken);
+
+    void EndWrite() noexcept;
+
+    // Render thread only. Packets written before closing are still handed out, null once they are all consumed
+    [[nodiscard]] const RenderPacket * BeginRead(std::stop_token stopToken);
+
+    void EndRead() noexcept;
+
+    // Either side calls it when it is done, which releases the other from its wait
+    void Close() noexcept;
+
+    // Reads that found no packet ready and writes that found no packet free, which tells the side limiting the frame
+    // rate
+    [[nodiscard]] std::uint64_t GetReadWaitCount() const noexcept;
+
+    [[nodiscard]] std::uint64_t GetWriteWaitCount() const noexcept;
+
+    [[nodiscard]] Impl::RenderPacketQueue & GetImpl() noexcept;
+
+private:
+    static constexpr auto memorySize      = sizeof(void *);
+    static constexpr auto memoryAlignment = alignof(void *);
+
+    OptimizedPimpl<Impl::RenderPacketQueue, memorySize, memoryAlignment> m_Pimpl;
+};
+} // namespace CuEngine::Rendering
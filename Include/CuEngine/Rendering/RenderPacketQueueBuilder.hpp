@@ -0,0 +1,67 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Rendering/RenderPacketQueue.hpp>
+#include <CuEngine/Utility/OptimizedPimpl.hpp>
+
+#include <cstdint>
+
+namespace CuEngine::Rendering
+{
+namespace Impl
+{
+class RenderPacketQueueBuilder;
+}
+
+class RenderPacketQueueBuilder
+{
+public:
+    RenderPacketQueueBuilder() noexcept;
+
+    RenderPacketQueueBuilder(const RenderPacketQueueBuilder & other) noexcept;
+
+    RenderPacketQueueBuilder(RenderPacketQueueBuilder && other) noexcept;
+
+    RenderPacketQueueBuilder & operator=(const RenderPacketQueueBuilder & other) noexcept;
+
+    RenderPacketQueueBuilder & operator=(RenderPacketQueueBuilder && other) noexcept;
+
+    ~RenderPacketQueueBuilder() noexcept;
+
+    // Both capacities are per packet and reserved up front, nothing grows while frames are produced
+    RenderPacketQueueBuilder & SetDrawCapacity(std::uint32_t drawCapacity) noexcept;
+
+    RenderPacketQueueBuilder & SetInstanceDataCapacity(std::uint32_t instanceDataCapacity) noexcept;
+
+    [[nodiscard]] RenderPacketQueue Build() const;
+
+    [[nodiscard]] Impl::RenderPacketQueueBuilder & GetImpl() noexcept;
+
+private:
+    static constexpr auto memorySize      = sizeof(std::uint32_t) * 2;
+    static constexpr auto memoryAlignment = alignof(std::uint32_t);
+
+    OptimizedPimpl<Impl::RenderPacketQueueBuilder, memorySize, memoryAlignment> m_Pimpl;
+};
+} // namespace CuEngine::Rendering
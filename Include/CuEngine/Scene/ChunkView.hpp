@@ -0,0 +1,83 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Scene/Component.hpp>
+#include <CuEngine/Scene/Entity.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+namespace CuEngine::Scene
+{
+// One chunk of an archetype: every component is a contiguous array, indexed by the same row as the entities
+class ChunkView
+{
+public:
+    static constexpr auto missingColumn = std::numeric_limits<std::uint32_t>::max();
+
+    using ColumnOffsets = std::array<std::uint32_t, maxComponentTypeCount>;
+
+    ChunkView(std::byte * memory, const ColumnOffsets & columnOffsets, std::uint32_t entityOffset,
+              std::uint32_t entityCount) noexcept
+        : m_Memory(memory), m_ColumnOffsets(&columnOffsets), m_EntityOffset(entityOffset), m_EntityCount(entityCount)
+    {}
+
+    [[nodiscard]] std::uint32_t GetEntityCount() const noexcept
+    {
+        return m_EntityCount;
+    }
+
+    [[nodiscard]] std::span<const Entity> GetEntities() const noexcept
+    {
+        return std::span(reinterpret_cast<const Entity *>(m_Memory + m_EntityOffset), m_EntityCount);
+    }
+
+    [[nodiscard]] bool HasComponent(ComponentId id) const noexcept
+    {
+        return (*m_ColumnOffsets)[id] != missingColumn;
+    }
+
+    // Empty when the chunk's archetype does not have the component
+    template <typename ComponentT>
+    [[nodiscard]] std::span<ComponentT> GetComponents() const
+    {
+        auto offset = (*m_ColumnOffsets)[GetComponentInfo<ComponentT>().id];
+        if (offset == missingColumn)
+        {
+            return {};
+        }
+
+        return std::span(reinterpret_cast<ComponentT *>(m_Memory + offset), m_EntityCount);
+    }
+
+private:
+    std::byte *           m_Memory;
+    const ColumnOffsets * m_ColumnOffsets;
+    std::uint32_t         m_EntityOffset;
+    std::uint32_t         m_EntityCount;
+};
+} // namespace CuEngine::Scene
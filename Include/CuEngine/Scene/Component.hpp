@@ -0,0 +1,92 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace CuEngine::Scene
+{
+using ComponentId = std::uint32_t;
+
+inline constexpr auto maxComponentTypeCount = std::size_t(64);
+
+// Columns inside a chunk are never aligned to more than a cache line
+inline constexpr auto maxComponentAlignment = std::size_t(64);
+
+using ComponentMask = std::bitset<maxComponentTypeCount>;
+
+// What the type-erased storage needs to know about a component type
+struct ComponentInfo
+{
+    ComponentId   id        = 0;
+    std::uint32_t size      = 0;
+    std::uint32_t alignment = 0;
+
+    // Leaves the source alive, the caller still destroys it
+    void (*moveConstruct)(void * destination, void * source) noexcept = nullptr;
+    void (*destroy)(void * component) noexcept                        = nullptr;
+};
+
+// Ids are handed out in order of first use, throws once there are more types than a mask can hold
+[[nodiscard]] ComponentId AllocateComponentId();
+
+template <typename ComponentT>
+[[nodiscard]] const ComponentInfo & GetComponentInfo()
+{
+    static_assert(std::is_same_v<ComponentT, std::remove_cvref_t<ComponentT>>, "Components are plain value types");
+    static_assert(std::is_nothrow_move_constructible_v<ComponentT> && std::is_nothrow_destructible_v<ComponentT>,
+                  "Components are moved between chunks, which must not throw");
+    static_assert(alignof(ComponentT) <= maxComponentAlignment, "Component alignment exceeds a cache line");
+
+    auto moveConstruct = [](void * destination, void * source) noexcept
+    {
+        new (destination) ComponentT(std::move(*static_cast<ComponentT *>(source)));
+    };
+    auto destroy = [](void * component) noexcept
+    {
+        static_cast<ComponentT *>(component)->~ComponentT();
+    };
+
+    static const auto info = ComponentInfo{ .id            = AllocateComponentId(),
+                                            .size          = static_cast<std::uint32_t>(sizeof(ComponentT)),
+                                            .alignment     = static_cast<std::uint32_t>(alignof(ComponentT)),
+                                            .moveConstruct = moveConstruct,
+                                            .destroy       = destroy };
+
+    return info;
+}
+
+template <typename... ComponentsT>
+[[nodiscard]] ComponentMask MakeComponentMask()
+{
+    auto mask = ComponentMask();
+    (mask.set(GetComponentInfo<ComponentsT>().id), ...);
+
+    return mask;
+}
+} // namespace CuEngine::Scene
@@ -0,0 +1,114 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Scene/Component.hpp>
+#include <CuEngine/Scene/Entity.hpp>
+#include <CuEngine/Scene/World.hpp>
+#include <CuEngine/Utility/OptimizedPimpl.hpp>
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace CuEngine::Scene
+{
+namespace Impl
+{
+class EntityCommandBuffer;
+}
+
+// Records structural changes while queries are running and applies them afterwards, in recording order. Recording is
+// thread-safe, so the jobs of a parallel query can share one buffer
+class EntityCommandBuffer
+{
+public:
+    EntityCommandBuffer();
+
+    EntityCommandBuffer(const EntityCommandBuffer &) = delete;
+
+    EntityCommandBuffer(EntityCommandBuffer && other) noexcept;
+
+    EntityCommandBuffer & operator=(const EntityCommandBuffer &) = delete;
+
+    EntityCommandBuffer & operator=(EntityCommandBuffer && other) noexcept;
+
+    ~EntityCommandBuffer() noexcept;
+
+    template <typename... ComponentsT>
+    void CreateEntity(ComponentsT &&... components)
+    {
+        auto values   = std::tuple<std::remove_cvref_t<ComponentsT>...>(std::forward<ComponentsT>(components)...);
+        auto infos    = std::array<const ComponentInfo *, sizeof...(ComponentsT)>{
+            &GetComponentInfo<std::remove_cvref_t<ComponentsT>>()...
+        };
+        auto pointers = std::apply(
+            [](auto &... value)
+            {
+                return std::array<void *, sizeof...(ComponentsT)>{ &value... };
+            },
+            values);
+
+        CreateEntity(std::span<const ComponentInfo * const>(infos), std::span<void * const>(pointers));
+    }
+
+    template <typename ComponentT>
+    void AddComponent(Entity entity, ComponentT && component)
+    {
+        auto value = std::remove_cvref_t<ComponentT>(std::forward<ComponentT>(component));
+        AddComponent(entity, GetComponentInfo<std::remove_cvref_t<ComponentT>>(), &value);
+    }
+
+    template <typename ComponentT>
+    void RemoveComponent(Entity entity)
+    {
+        RemoveComponent(entity, GetComponentInfo<ComponentT>());
+    }
+
+    // The values are moved into the buffer, the caller still destroys its own
+    void CreateEntity(std::span<const ComponentInfo * const> infos, std::span<void * const> values);
+
+    void DestroyEntity(Entity entity);
+
+    void AddComponent(Entity entity, const ComponentInfo & info, void * value);
+
+    void RemoveComponent(Entity entity, const ComponentInfo & info);
+
+    // Leaves the buffer empty but keeps its memory for the next frame
+    void Playback(World & world);
+
+    [[nodiscard]] std::uint32_t GetCommandCount() const noexcept;
+
+    [[nodiscard]] Impl::EntityCommandBuffer & GetImpl() noexcept;
+
+private:
+    static constexpr auto memorySize      = sizeof(void *);
+    static constexpr auto memoryAlignment = alignof(void *);
+
+    OptimizedPimpl<Impl::EntityCommandBuffer, memorySize, memoryAlignment> m_Pimpl;
+};
+} // namespace CuEngine::Scene
@@ -0,0 +1,138 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Jobs/Scheduler.hpp>
+#include <CuEngine/Math/Matrix.hpp>
+#include <CuEngine/Math/Quaternion.hpp>
+#include <CuEngine/Math/Vector.hpp>
+#include <CuEngine/Utility/OptimizedPimpl.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <span>
+
+namespace CuEngine::Scene
+{
+namespace Impl
+{
+class TransformHierarchy;
+}
+
+// The generation tells a live node from an earlier one that was destroyed and whose index got reused
+struct TransformNode
+{
+    std::uint32_t index      = std::numeric_limits<std::uint32_t>::max();
+    std::uint32_t generation = 0;
+
+    bool operator==(const TransformNode &) const noexcept = default;
+};
+
+inline constexpr auto nullTransformNode = TransformNode();
+
+// Relative to the parent, applied as scale, then rotation, then translation
+struct LocalTransform
+{
+    Math::Vec3 translation;
+    Math::Quat rotation;
+    Math::Vec3 scale = { 1.0f, 1.0f, 1.0f };
+};
+
+// A run of consecutive world matrix indices
+struct TransformRange
+{
+    std::uint32_t first = 0;
+    std::uint32_t count = 0;
+};
+
+// Nodes are laid out in flat arrays sorted by depth and then by parent, so every level and every node's children are
+// contiguous and parents always come before their children. Update only recomputes the world matrices of nodes whose
+// local transform changed and of their descendants, level by level in SIMD batches. Adding, removing and reparenting
+// nodes re-sorts the layout at the next Update, which then recomputes everything. Nothing here is thread-safe
+class TransformHierarchy
+{
+public:
+    static constexpr auto invalidIndex = std::numeric_limits<std::uint32_t>::max();
+
+    TransformHierarchy();
+
+    TransformHierarchy(const TransformHierarchy &) = delete;
+
+    TransformHierarchy(TransformHierarchy && other) noexcept;
+
+    TransformHierarchy & operator=(const TransformHierarchy &) = delete;
+
+    TransformHierarchy & operator=(TransformHierarchy && other) noexcept;
+
+    ~TransformHierarchy() noexcept;
+
+    // A null parent makes a root
+    [[nodiscard]] TransformNode CreateNode(TransformNode parent = nullTransformNode, const LocalTransform & local = {});
+
+    // The descendants are destroyed along with it at the next Update, destroying a node that is already gone does
+    // nothing
+    void DestroyNode(TransformNode node) noexcept;
+
+    // A null parent makes the node a root
+    void SetParent(TransformNode node, TransformNode parent);
+
+    void SetLocalTransform(TransformNode node, const LocalTransform & local);
+
+    [[nodiscard]] const LocalTransform * GetLocalTransform(TransformNode node) const noexcept;
+
+    [[nodiscard]] bool IsAlive(TransformNode node) const noexcept;
+
+    void Update();
+
+    // Levels with enough dirty nodes are split across the scheduler's workers
+    void Update(Jobs::Scheduler & scheduler);
+
+    // The matrix and its index are those of the last Update, the index changes whenever the layout does
+    [[nodiscard]] const Math::Mat4 * GetWorldMatrix(TransformNode node) const noexcept;
+
+    [[nodiscard]] std::uint32_t GetMatrixIndex(TransformNode node) const noexcept;
+
+    [[nodiscard]] std::span<const Math::Mat4> GetWorldMatrices() const noexcept;
+
+    // Sorted, non-overlapping runs of the world matrices recomputed since the last ClearChangedRanges, i.e. what a copy
+    // of them has to refresh. A layout change covers every matrix
+    [[nodiscard]] std::span<const TransformRange> GetChangedRanges() const noexcept;
+
+    void ClearChangedRanges() noexcept;
+
+    [[nodiscard]] std::uint32_t GetNodeCount() const noexcept;
+
+    [[nodiscard]] std::uint32_t GetLevelCount() const noexcept;
+
+    // How many world matrices the last Update recomputed
+    [[nodiscard]] std::uint32_t GetUpdatedCount() const noexcept;
+
+    [[nodiscard]] Impl::TransformHierarchy & GetImpl() noexcept;
+
+private:
+    static constexpr auto memorySize      = sizeof(void *);
+    static constexpr auto memoryAlignment = alignof(void *);
+
+    OptimizedPimpl<Impl::TransformHierarchy, memorySize, memoryAlignment> m_Pimpl;
+};
+} // namespace CuEngine::Scene
@@ -0,0 +1,218 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Jobs/Scheduler.hpp>
+#include <CuEngine/Scene/ChunkView.hpp>
+#include <CuEngine/Scene/Component.hpp>
+#include <CuEngine/Scene/Entity.hpp>
+#include <CuEngine/Utility/OptimizedPimpl.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace CuEngine::Scene
+{
+namespace Impl
+{
+class World;
+}
+
+// Entities with the same set of components share an archetype, whose components are stored column by column in
+// fixed-size chunks. Structural changes, i.e. creating and destroying entities or adding and removing components,
+// are not thread-safe and invalidate chunk views. Queries only read the layout, so several can run at once
+class World
+{
+public:
+    World();
+
+    World(const World &) = delete;
+
+    World(World && other) noexcept;
+
+    World & operator=(const World &) = delete;
+
+    World & operator=(World && other) noexcept;
+
+    ~World() noexcept;
+
+    template <typename... ComponentsT>
+    Entity CreateEntity(ComponentsT &&... components)
+    {
+        auto values   = std::tuple<std::remove_cvref_t<ComponentsT>...>(std::forward<ComponentsT>(components)...);
+        auto infos    = std::array<const ComponentInfo *, sizeof...(ComponentsT)>{
+            &GetComponentInfo<std::remove_cvref_t<ComponentsT>>()...
+        };
+        auto pointers = std::apply(
+            [](auto &... value)
+            {
+                return std::array<void *, sizeof...(ComponentsT)>{ &value... };
+            },
+            values);
+
+        return CreateEntity(std::span<const ComponentInfo * const>(infos), std::span<void * const>(pointers));
+    }
+
+    // Replaces the component if the entity already has one
+    template <typename ComponentT>
+    void AddComponent(Entity entity, ComponentT && component)
+    {
+        auto value = std::remove_cvref_t<ComponentT>(std::forward<ComponentT>(component));
+        AddComponent(entity, GetComponentInfo<std::remove_cvref_t<ComponentT>>(), &value);
+    }
+
+    template <typename ComponentT>
+    void RemoveComponent(Entity entity)
+    {
+        RemoveComponent(entity, GetComponentInfo<ComponentT>());
+    }
+
+    // Null when the entity is gone or does not have the component, valid until the next structural change
+    template <typename ComponentT>
+    [[nodiscard]] ComponentT * GetComponent(Entity entity)
+    {
+        return static_cast<ComponentT *>(GetComponent(entity, GetComponentInfo<ComponentT>().id));
+    }
+
+    template <typename ComponentT>
+    [[nodiscard]] bool HasComponent(Entity entity)
+    {
+        return GetComponent(entity, GetComponentInfo<ComponentT>().id) != nullptr;
+    }
+
+    // Calls function(chunk) for every non-empty chunk whose archetype has all of the components
+    template <typename... ComponentsT, typename FunctionT>
+    void ForEachChunk(FunctionT && function)
+    {
+        auto chunks = std::vector<ChunkView>();
+        CollectChunks(MakeComponentMask<ComponentsT...>(), ComponentMask(), chunks);
+        for (auto && chunk : chunks)
+        {
+            function(chunk);
+        }
+    }
+
+    // Calls function(entity, components...) for every entity that has all of the components, in storage order
+    template <typename... ComponentsT, typename FunctionT>
+    void ForEach(FunctionT && function)
+    {
+        ForEachChunk<ComponentsT...>(
+            [&function](const ChunkView & chunk)
+            {
+                ForEachRow<ComponentsT...>(chunk, function);
+            });
+    }
+
+    // Like ForEach, but the chunks are split across the scheduler's workers. Returns once every entity is visited
+    template <typename... ComponentsT, typename FunctionT>
+    void ParallelForEach(Jobs::Scheduler & scheduler, FunctionT && function)
+    {
+        ParallelForEachChunk<ComponentsT...>(scheduler,
+                                             [&function](const ChunkView & chunk)
+                                             {
+                                                 ForEachRow<ComponentsT...>(chunk, function);
+                                             });
+    }
+
+    template <typename... ComponentsT, typename FunctionT>
+    void ParallelForEachChunk(Jobs::Scheduler & scheduler, FunctionT && function)
+    {
+        // A few jobs per worker keeps them busy when chunks take uneven time
+        constexpr auto jobsPerWorker = std::uint32_t(4);
+
+        auto chunks = std::vector<ChunkView>();
+        CollectChunks(MakeComponentMask<ComponentsT...>(), ComponentMask(), chunks);
+        if (chunks.empty())
+        {
+            return;
+        }
+
+        auto chunkCount   = static_cast<std::uint32_t>(chunks.size());
+        auto jobCount     = std::min(chunkCount, std::max(scheduler.GetWorkerCount(), 1u) * jobsPerWorker);
+        auto chunksPerJob = (chunkCount + jobCount - 1) / jobCount;
+        auto counter      = scheduler.Schedule((chunkCount + chunksPerJob - 1) / chunksPerJob,
+                                               [&chunks, &function, chunkCount, chunksPerJob](std::uint32_t job)
+                                               {
+                                                   auto end = std::min(chunkCount, (job + 1) * chunksPerJob);
+                                                   for (auto index = job * chunksPerJob; index < end; ++index)
+                                                   {
+                                                       function(chunks[index]);
+                                                   }
+                                               });
+        scheduler.Wait(counter);
+    }
+
+    Entity CreateEntity(std::span<const ComponentInfo * const> infos, std::span<void * const> values);
+
+    // Destroying an entity that is already gone does nothing
+    void DestroyEntity(Entity entity) noexcept;
+
+    void AddComponent(Entity entity, const ComponentInfo & info, void * value);
+
+    void RemoveComponent(Entity entity, const ComponentInfo & info);
+
+    [[nodiscard]] void * GetComponent(Entity entity, ComponentId id) noexcept;
+
+    [[nodiscard]] bool IsAlive(Entity entity) const noexcept;
+
+    // Appends a view of every non-empty chunk whose archetype has all the required and none of the excluded components
+    void CollectChunks(const ComponentMask & required, const ComponentMask & excluded,
+                       std::vector<ChunkView> & chunks) const;
+
+    [[nodiscard]] std::uint32_t GetEntityCount() const noexcept;
+
+    [[nodiscard]] std::uint32_t GetArchetypeCount() const noexcept;
+
+    [[nodiscard]] std::uint32_t GetChunkCount() const noexcept;
+
+    [[nodiscard]] Impl::World & GetImpl() noexcept;
+
+private:
+    template <typename... ComponentsT, typename FunctionT>
+    static void ForEachRow(const ChunkView & chunk, FunctionT & function)
+    {
+        auto entities = chunk.GetEntities();
+        auto columns  = std::make_tuple(chunk.GetComponents<ComponentsT>().data()...);
+        for (auto row = std::uint32_t(0); row < chunk.GetEntityCount(); ++row)
+        {
+            std::apply(
+                [&function, &entities, row](auto *... column)
+                {
+                    function(entities[row], column[row]...);
+                },
+                columns);
+        }
+    }
+
+    static constexpr auto memorySize      = sizeof(void *);
+    static constexpr auto memoryAlignment = alignof(void *);
+
+    OptimizedPimpl<Impl::World, memorySize, memoryAlignment> m_Pimpl;
+};
+} // namespace CuEngine::Scene
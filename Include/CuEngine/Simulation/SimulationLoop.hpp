@@ -0,0 +1,77 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Utility/OptimizedPimpl.hpp>
+
+#include <chrono>
+#include <cstdint>
+
+namespace CuEngine::Simulation
+{
+namespace Impl
+{
+class SimulationLoop;
+}
+
+// Runs the tick function at a fixed rate on its own thread until destroyed, whatever the render thread does
+class SimulationLoop
+{
+public:
+    explicit SimulationLoop(Impl::SimulationLoop && simulationLoop) noexcept;
+
+    SimulationLoop(const SimulationLoop &) = delete;
+
+    SimulationLoop(SimulationLoop && other) noexcept;
+
+    SimulationLoop & operator=(const SimulationLoop &) = delete;
+
+    SimulationLoop & operator=(SimulationLoop && other) noexcept;
+
+    ~SimulationLoop() noexcept;
+
+    // Waits for the tick in progress, no further ticks run afterwards
+    void Stop() noexcept;
+
+    // False once stopped or after the tick function threw
+    [[nodiscard]] bool IsRunning() const noexcept;
+
+    // Rethrows what stopped the tick function, if anything
+    void RethrowIfFailed() const;
+
+    [[nodiscard]] std::chrono::steady_clock::duration GetTickPeriod() const noexcept;
+
+    [[nodiscard]] std::uint64_t GetTickCount() const noexcept;
+
+    // Ticks given up on after falling too far behind, so a stall does not turn into a burst of catch-up ticks
+    [[nodiscard]] std::uint64_t GetSkippedTickCount() const noexcept;
+
+    [[nodiscard]] Impl::SimulationLoop & GetImpl() noexcept;
+
+private:
+    static constexpr auto memorySize      = sizeof(void *);
+    static constexpr auto memoryAlignment = alignof(void *);
+
+    OptimizedPimpl<Impl::SimulationLoop, memorySize, memoryAlignment> m_Pimpl;
+};
+} // namespace CuEngine::Simulation
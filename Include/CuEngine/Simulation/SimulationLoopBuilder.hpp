@@ -0,0 +1,75 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Simulation/SimulationLoop.hpp>
+#include <CuEngine/Utility/OptimizedPimpl.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+
+namespace CuEngine::Simulation
+{
+namespace Impl
+{
+class SimulationLoopBuilder;
+}
+
+class SimulationLoopBuilder
+{
+public:
+    // Called with the tick index and the time the tick stands for, which advances by exactly one period per tick
+    using TickFunction = std::function<void(std::uint64_t tick, std::chrono::steady_clock::time_point tickTime)>;
+
+    SimulationLoopBuilder();
+
+    SimulationLoopBuilder(const SimulationLoopBuilder & other);
+
+    SimulationLoopBuilder(SimulationLoopBuilder && other) noexcept;
+
+    SimulationLoopBuilder & operator=(const SimulationLoopBuilder & other);
+
+    SimulationLoopBuilder & operator=(SimulationLoopBuilder && other) noexcept;
+
+    ~SimulationLoopBuilder() noexcept;
+
+    SimulationLoopBuilder & SetTickRate(double tickRate) noexcept;
+
+    // How many late ticks are still run back to back before the loop skips ahead
+    SimulationLoopBuilder & SetMaxCatchUpTicks(std::uint32_t maxCatchUpTicks) noexcept;
+
+    SimulationLoopBuilder & SetTickFunction(TickFunction tickFunction) noexcept;
+
+    // Starts the simulation thread
+    [[nodiscard]] SimulationLoop Build() const;
+
+    [[nodiscard]] Impl::SimulationLoopBuilder & GetImpl() noexcept;
+
+private:
+    static constexpr auto memorySize      = sizeof(std::int64_t) * 2 + sizeof(TickFunction);
+    static constexpr auto memoryAlignment = alignof(TickFunction);
+
+    OptimizedPimpl<Impl::SimulationLoopBuilder, memorySize, memoryAlignment> m_Pimpl;
+};
+} // namespace CuEngine::Simulation
@@ -0,0 +1,100 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Utility/TripleBuffer.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+namespace CuEngine::Simulation
+{
+// Carries the two most recent ticks from the simulation to the render thread, which draws in between them
+template <typename StateT>
+class SnapshotChannel
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Snapshot
+    {
+        StateT            previous;
+        StateT            current;
+        Clock::time_point time;
+        std::uint64_t     tick;
+    };
+
+    struct Sample
+    {
+        const StateT & previous;
+        const StateT & current;
+        // How far the render time is from the previous towards the current tick, in [0, 1]
+        float          alpha;
+        std::uint64_t  tick;
+    };
+
+    SnapshotChannel() = default;
+
+    SnapshotChannel(const SnapshotChannel & other) = delete;
+
+    SnapshotChannel(SnapshotChannel && other) noexcept = delete;
+
+    SnapshotChannel & operator=(const SnapshotChannel & other) = delete;
+
+    SnapshotChannel & operator=(SnapshotChannel && other) noexcept = delete;
+
+    ~SnapshotChannel() noexcept = default;
+
+    // Simulation thread only, time is the tick time of the current state, which is fully shown one period later
+    void Publish(const StateT & previous, const StateT & current, Clock::time_point time, std::uint64_t tick)
+    {
+        auto & snapshot   = m_Snapshots.GetWriteBuffer();
+        snapshot.previous = previous;
+        snapshot.current  = current;
+        snapshot.time     = time;
+        snapshot.tick     = tick;
+        m_Snapshots.Publish();
+    }
+
+    // Render thread only. Rendering runs one tick behind the simulation, so there is always a pair to blend
+    [[nodiscard]] Sample Read(Clock::time_point now, Clock::duration tickPeriod) noexcept
+    {
+        const auto & snapshot = m_Snapshots.Read();
+
+        auto alpha = 1.0f;
+        if (tickPeriod > Clock::duration::zero())
+        {
+            auto elapsed = std::chrono::duration<float>(now - snapshot.time) / std::chrono::duration<float>(tickPeriod);
+            alpha        = std::clamp(elapsed, 0.0f, 1.0f);
+        }
+
+        return Sample{
+            .previous = snapshot.previous, .current = snapshot.current, .alpha = alpha, .tick = snapshot.tick
+        };
+    }
+
+private:
+    TripleBuffer<Snapshot> m_Snapshots;
+};
+} // namespace CuEngine::Simulation
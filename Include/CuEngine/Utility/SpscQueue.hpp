@@ -0,0 +1,114 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+namespace CuEngine
+{
+// Bounded ring between exactly one producer and one consumer thread, neither side ever blocks the other
+template <typename T>
+class SpscQueue
+{
+    static_assert(std::is_nothrow_copy_assignable_v<T> && std::is_default_constructible_v<T>);
+
+public:
+    explicit SpscQueue(std::size_t capacity = 1024)
+        : m_Head(0), m_CachedTail(0), m_Tail(0), m_CachedHead(0), m_Mask(capacity - 1),
+          m_Items(std::make_unique<T[]>(capacity))
+    {
+        if (!std::has_single_bit(capacity))
+        {
+            throw std::runtime_error("SpscQueue capacity has to be a power of two");
+        }
+    }
+
+    SpscQueue(const SpscQueue & other) = delete;
+
+    SpscQueue(SpscQueue && other) noexcept = delete;
+
+    SpscQueue & operator=(const SpscQueue & other) = delete;
+
+    SpscQueue & operator=(SpscQueue && other) noexcept = delete;
+
+    ~SpscQueue() noexcept = default;
+
+    // Producer thread only, fails instead of overwriting when the consumer has fallen a whole ring behind
+    [[nodiscard]] bool TryPush(const T & item) noexcept
+    {
+        auto tail = m_Tail.load(std::memory_order_relaxed);
+        if (tail - m_CachedHead > m_Mask)
+        {
+            m_CachedHead = m_Head.load(std::memory_order_acquire);
+            if (tail - m_CachedHead > m_Mask)
+            {
+                return false;
+            }
+        }
+
+        m_Items[tail & m_Mask] = item;
+        m_Tail.store(tail + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    // Consumer thread only
+    [[nodiscard]] bool TryPop(T & item) noexcept
+    {
+        auto head = m_Head.load(std::memory_order_relaxed);
+        if (head == m_CachedTail)
+        {
+            m_CachedTail = m_Tail.load(std::memory_order_acquire);
+            if (head == m_CachedTail)
+            {
+                return false;
+            }
+        }
+
+        item = m_Items[head & m_Mask];
+        m_Head.store(head + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    [[nodiscard]] std::size_t GetCapacity() const noexcept
+    {
+        return m_Mask + 1;
+    }
+
+private:
+    // Each side caches the other's index and only reloads it when the ring looks full or empty,
+    // so the shared cache lines change hands once per batch rather than once per item
+    alignas(64) std::atomic<std::size_t> m_Head;
+    std::size_t                          m_CachedTail;
+    alignas(64) std::atomic<std::size_t> m_Tail;
+    std::size_t                          m_CachedHead;
+    alignas(64) std::size_t              m_Mask;
+    std::unique_ptr<T[]>                 m_Items;
+};
+} // namespace CuEngine
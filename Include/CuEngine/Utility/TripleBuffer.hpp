@@ -0,0 +1,87 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+namespace CuEngine
+{
+// Hands the latest value from one writer thread to one reader thread without either side waiting.
+// Three slots let the writer always have one to fill while the reader holds another, the third is in between
+template <typename T>
+class TripleBuffer
+{
+    static_assert(std::is_default_constructible_v<T>);
+
+    static constexpr auto indexMask = std::uint8_t(0x3);
+    static constexpr auto freshBit  = std::uint8_t(0x4);
+
+public:
+    TripleBuffer() : m_Buffers(), m_Shared(1), m_WriteIndex(0), m_ReadIndex(2)
+    {}
+
+    TripleBuffer(const TripleBuffer & other) = delete;
+
+    TripleBuffer(TripleBuffer && other) noexcept = delete;
+
+    TripleBuffer & operator=(const TripleBuffer & other) = delete;
+
+    TripleBuffer & operator=(TripleBuffer && other) noexcept = delete;
+
+    ~TripleBuffer() noexcept = default;
+
+    // Writer thread only, the slot keeps whatever was written into it two publishes ago
+    [[nodiscard]] T & GetWriteBuffer() noexcept
+    {
+        return m_Buffers[m_WriteIndex];
+    }
+
+    // Writer thread only
+    void Publish() noexcept
+    {
+        auto shared  = m_Shared.exchange(static_cast<std::uint8_t>(m_WriteIndex | freshBit), std::memory_order_acq_rel);
+        m_WriteIndex = shared & indexMask;
+    }
+
+    // Reader thread only, returns the latest published value, which stays valid until the next call
+    [[nodiscard]] const T & Read() noexcept
+    {
+        if ((m_Shared.load(std::memory_order_relaxed) & freshBit) != 0)
+        {
+            auto shared = m_Shared.exchange(m_ReadIndex, std::memory_order_acq_rel);
+            m_ReadIndex = shared & indexMask;
+        }
+
+        return m_Buffers[m_ReadIndex];
+    }
+
+private:
+    std::array<T, 3>                      m_Buffers;
+    alignas(64) std::atomic<std::uint8_t> m_Shared;
+    alignas(64) std::uint8_t              m_WriteIndex;
+    alignas(64) std::uint8_t              m_ReadIndex;
+};
+} // namespace CuEngine
@@ -0,0 +1,83 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Utility/OptimizedPimpl.hpp>
+
+#include <cstdint>
+
+namespace CuEngine::Vulkan
+{
+namespace Impl
+{
+class Buffer;
+}
+
+enum class BufferUsage : std::uint32_t
+{
+    TransferSource      = 0x001,
+    TransferDestination = 0x002,
+    Uniform             = 0x010,
+    Storage             = 0x020,
+    Index               = 0x040,
+    Vertex              = 0x080,
+    Indirect            = 0x100
+};
+
+[[nodiscard]] constexpr BufferUsage operator|(BufferUsage left, BufferUsage right) noexcept
+{
+    return static_cast<BufferUsage>(static_cast<std::uint32_t>(left) | static_cast<std::uint32_t>(right));
+}
+
+class Buffer
+{
+public:
+    explicit Buffer(Impl::Buffer && buffer) noexcept;
+
+    Buffer(const Buffer &) noexcept = delete;
+
+    Buffer(Buffer && other) noexcept;
+
+    Buffer & operator=(const Buffer &) noexcept = delete;
+
+    Buffer & operator=(Buffer && other) noexcept;
+
+    ~Buffer() noexcept;
+
+    [[nodiscard]] std::uint64_t GetSize() const noexcept;
+
+    // Null unless the buffer was created with a host visible memory usage
+    [[nodiscard]] void * GetMappedData() const noexcept;
+
+    [[nodiscard]] Impl::Buffer & GetImpl() noexcept;
+
+    [[nodiscard]] const Impl::Buffer & GetImpl() const noexcept;
+
+private:
+    static constexpr auto memorySize      = sizeof(void *) * 7 + sizeof(std::uint64_t) * 3 + sizeof(std::uint32_t) * 2;
+    static constexpr auto memoryAlignment = alignof(void *);
+
+    OptimizedPimpl<Impl::Buffer, memorySize, memoryAlignment> m_Pimpl;
+};
+
+} // namespace CuEngine::Vulkan
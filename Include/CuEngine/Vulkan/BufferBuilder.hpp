@@ -0,0 +1,79 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Utility/OptimizedPimpl.hpp>
+#include <CuEngine/Vulkan/Buffer.hpp>
+#include <CuEngine/Vulkan/Device.hpp>
+#include <CuEngine/Vulkan/MemoryAllocator.hpp>
+#include <CuEngine/Vulkan/QueueFamily.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace CuEngine::Vulkan
+{
+namespace Impl
+{
+class BufferBuilder;
+}
+
+class BufferBuilder
+{
+public:
+    explicit BufferBuilder();
+
+    BufferBuilder(const BufferBuilder & other);
+
+    BufferBuilder(BufferBuilder && other) noexcept;
+
+    BufferBuilder & operator=(const BufferBuilder & other);
+
+    BufferBuilder & operator=(BufferBuilder && other) noexcept;
+
+    ~BufferBuilder() noexcept;
+
+    BufferBuilder & SetDevice(Device & device) noexcept;
+
+    BufferBuilder & SetSize(std::uint64_t size) noexcept;
+
+    BufferBuilder & SetUsage(BufferUsage usage) noexcept;
+
+    BufferBuilder & SetMemoryUsage(MemoryUsage memoryUsage) noexcept;
+
+    // Buffers used by more than one queue family are shared concurrently
+    BufferBuilder & SetQueueFamilies(const std::vector<QueueFamily> & queueFamilies);
+
+    [[nodiscard]] Buffer Build() const;
+
+    [[nodiscard]] Impl::BufferBuilder & GetImpl() noexcept;
+
+private:
+    static constexpr auto memorySize =
+        sizeof(void *) * 2 + sizeof(std::uint64_t) + sizeof(std::uint32_t) * 2 + sizeof(std::vector<std::uint32_t>);
+    static constexpr auto memoryAlignment = alignof(void *);
+
+    OptimizedPimpl<Impl::BufferBuilder, memorySize, memoryAlignment> m_Pimpl;
+};
+
+} // namespace CuEngine::Vulkan
@@ -0,0 +1,73 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Utility/OptimizedPimpl.hpp>
+#include <CuEngine/Vulkan/Synchronization.hpp>
+
+#include <vector>
+
+namespace CuEngine::Vulkan
+{
+namespace Impl
+{
+class CommandBuffer;
+}
+
+class CommandBuffer
+{
+public:
+    explicit CommandBuffer(Impl::CommandBuffer && commandBuffer) noexcept;
+
+    CommandBuffer(const CommandBuffer & other) noexcept;
+
+    CommandBuffer(CommandBuffer && other) noexcept;
+
+    CommandBuffer & operator=(const CommandBuffer & other) noexcept;
+
+    CommandBuffer & operator=(CommandBuffer && other) noexcept;
+
+    ~CommandBuffer() noexcept;
+
+    void End();
+
+    void ExecuteCommands(const std::vector<CommandBuffer> & secondaryCommandBuffers);
+
+    // Queue family ownership transfer, the release goes into the source family's command buffer
+    void ReleaseOwnership(const BufferOwnershipTransfer & transfer) noexcept;
+
+    // and the acquire into the destination family's one, submitted after a semaphore wait on the release
+    void AcquireOwnership(const BufferOwnershipTransfer & transfer) noexcept;
+
+    [[nodiscard]] Impl::CommandBuffer & GetImpl() noexcept;
+
+    [[nodiscard]] const Impl::CommandBuffer & GetImpl() const noexcept;
+
+private:
+    static constexpr auto memorySize      = sizeof(void *);
+    static constexpr auto memoryAlignment = alignof(void *);
+
+    OptimizedPimpl<Impl::CommandBuffer, memorySize, memoryAlignment> m_Pimpl;
+};
+
+} // namespace CuEngine::Vulkan
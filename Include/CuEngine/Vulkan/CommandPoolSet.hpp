@@ -0,0 +1,89 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Jobs/Scheduler.hpp>
+#include <CuEngine/Utility/OptimizedPimpl.hpp>
+#include <CuEngine/Vulkan/CommandBuffer.hpp>
+#include <CuEngine/Vulkan/Image.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace CuEngine::Vulkan
+{
+namespace Impl
+{
+class CommandPoolSet;
+}
+
+// The dynamic rendering the secondaries continue, no formats at all means they are executed outside of rendering
+struct SecondaryInheritance
+{
+    std::vector<Format> colorFormats;
+    Format              depthFormat;
+    Format              stencilFormat;
+};
+
+class CommandPoolSet
+{
+public:
+    explicit CommandPoolSet(Impl::CommandPoolSet && commandPoolSet) noexcept;
+
+    CommandPoolSet(const CommandPoolSet &) noexcept = delete;
+
+    CommandPoolSet(CommandPoolSet && other) noexcept;
+
+    CommandPoolSet & operator=(const CommandPoolSet &) noexcept = delete;
+
+    CommandPoolSet & operator=(CommandPoolSet && other) noexcept;
+
+    ~CommandPoolSet() noexcept;
+
+    // Resets every pool of the frame at once, the frame's previous submission has to be complete
+    void BeginFrame(std::uint32_t frameIndex);
+
+    [[nodiscard]] CommandBuffer BeginPrimary();
+
+    // Can be called concurrently as long as every thread uses its own worker index
+    [[nodiscard]] CommandBuffer BeginSecondary(std::uint32_t workerIndex, const SecondaryInheritance & inheritance);
+
+    // Records the tasks as up to GetWorkerCount() jobs and executes them into the primary in task order
+    void RecordSecondary(Jobs::Scheduler & scheduler, CommandBuffer & primary, const SecondaryInheritance & inheritance,
+                         std::uint32_t taskCount, const std::function<void(CommandBuffer &, std::uint32_t)> & record);
+
+    [[nodiscard]] std::uint32_t GetFramesInFlight() const noexcept;
+
+    [[nodiscard]] std::uint32_t GetWorkerCount() const noexcept;
+
+    [[nodiscard]] Impl::CommandPoolSet & GetImpl() noexcept;
+
+private:
+    static constexpr auto memorySize      = sizeof(void *) + sizeof(std::uint32_t) * 4 + sizeof(std::vector<int>) * 2;
+    static constexpr auto memoryAlignment = alignof(void *);
+
+    OptimizedPimpl<Impl::CommandPoolSet, memorySize, memoryAlignment> m_Pimpl;
+};
+
+} // namespace CuEngine::Vulkan
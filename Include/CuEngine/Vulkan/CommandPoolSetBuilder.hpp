@@ -0,0 +1,74 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Utility/OptimizedPimpl.hpp>
+#include <CuEngine/Vulkan/CommandPoolSet.hpp>
+#include <CuEngine/Vulkan/Device.hpp>
+#include <CuEngine/Vulkan/QueueFamily.hpp>
+
+#include <cstdint>
+
+namespace CuEngine::Vulkan
+{
+namespace Impl
+{
+class CommandPoolSetBuilder;
+}
+
+class CommandPoolSetBuilder
+{
+public:
+    explicit CommandPoolSetBuilder();
+
+    CommandPoolSetBuilder(const CommandPoolSetBuilder & other);
+
+    CommandPoolSetBuilder(CommandPoolSetBuilder && other) noexcept;
+
+    CommandPoolSetBuilder & operator=(const CommandPoolSetBuilder & other);
+
+    CommandPoolSetBuilder & operator=(CommandPoolSetBuilder && other) noexcept;
+
+    ~CommandPoolSetBuilder() noexcept;
+
+    CommandPoolSetBuilder & SetDevice(Device & device) noexcept;
+
+    CommandPoolSetBuilder & SetQueueFamily(const QueueFamily & queueFamily) noexcept;
+
+    CommandPoolSetBuilder & SetFramesInFlight(std::uint32_t framesInFlight) noexcept;
+
+    // Defaults to the number of hardware threads
+    CommandPoolSetBuilder & SetWorkerCount(std::uint32_t workerCount) noexcept;
+
+    [[nodiscard]] CommandPoolSet Build() const;
+
+    [[nodiscard]] Impl::CommandPoolSetBuilder & GetImpl() noexcept;
+
+private:
+    static constexpr auto memorySize      = sizeof(void *) + sizeof(std::uint32_t) * 4;
+    static constexpr auto memoryAlignment = alignof(void *);
+
+    OptimizedPimpl<Impl::CommandPoolSetBuilder, memorySize, memoryAlignment> m_Pimpl;
+};
+
+} // namespace CuEngine::Vulkan
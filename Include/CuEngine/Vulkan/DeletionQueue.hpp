@@ -0,0 +1,86 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Utility/OptimizedPimpl.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace CuEngine::Vulkan
+{
+namespace Impl
+{
+class DeletionQueue;
+}
+
+class Buffer;
+class Image;
+class RenderGraph;
+class TimelineSemaphore;
+
+// Keeps resources alive until the GPU has reached the timeline value of the last submission that used them
+class DeletionQueue
+{
+public:
+    explicit DeletionQueue(Impl::DeletionQueue && deletionQueue) noexcept;
+
+    DeletionQueue(const DeletionQueue &) noexcept = delete;
+
+    DeletionQueue(DeletionQueue && other) noexcept;
+
+    DeletionQueue & operator=(const DeletionQueue &) noexcept = delete;
+
+    DeletionQueue & operator=(DeletionQueue && other) noexcept;
+
+    ~DeletionQueue() noexcept;
+
+    // The semaphore has to outlive everything retired against it
+    void Retire(Buffer && buffer, const TimelineSemaphore & semaphore, std::uint64_t value);
+
+    void Retire(Image && image, const TimelineSemaphore & semaphore, std::uint64_t value);
+
+    void Retire(RenderGraph && renderGraph, const TimelineSemaphore & semaphore, std::uint64_t value);
+
+    // For handles without a wrapper of their own
+    void Retire(std::function<void()> destroy, const TimelineSemaphore & semaphore, std::uint64_t value);
+
+    // Releases everything the GPU is done with and returns how much that was, meant to be called once per frame
+    std::size_t Collect();
+
+    // Releases everything regardless of the GPU, only safe once the device is idle
+    void Flush() noexcept;
+
+    [[nodiscard]] std::size_t GetPendingCount() const noexcept;
+
+    [[nodiscard]] Impl::DeletionQueue & GetImpl() noexcept;
+
+private:
+    static constexpr auto memorySize      = sizeof(void *);
+    static constexpr auto memoryAlignment = alignof(void *);
+
+    OptimizedPimpl<Impl::DeletionQueue, memorySize, memoryAlignment> m_Pimpl;
+};
+
+} // namespace CuEngine::Vulkan
@@ -23,6 +23,9 @@
 #pragma once
 
 #include <CuEngine/Utility/OptimizedPimpl.hpp>
+#include <CuEngine/Vulkan/DeletionQueue.hpp>
+#include <CuEngine/Vulkan/MemoryAllocator.hpp>
+#include <CuEngine/Vulkan/PipelineCache.hpp>
 
 namespace CuEngine::Vulkan
 {
@@ -46,10 +49,17 @@ public:
 
     ~Device() noexcept;
 
+    [[nodiscard]] PipelineCache & GetPipelineCache() noexcept;
+
+    [[nodiscard]] MemoryAllocator & GetMemoryAllocator() noexcept;
+
+    [[nodiscard]] DeletionQueue & GetDeletionQueue() noexcept;
+
     [[nodiscard]] Impl::Device & getImpl() noexcept;
 
 private:
-    static constexpr auto memorySize      = sizeof(void *);
+    static constexpr auto memorySize =
+        sizeof(void *) * 2 + sizeof(PipelineCache) + sizeof(MemoryAllocator) + sizeof(DeletionQueue);
     static constexpr auto memoryAlignment = alignof(void *);
 
     OptimizedPimpl<Impl::Device, memorySize, memoryAlignment> m_Pimpl;
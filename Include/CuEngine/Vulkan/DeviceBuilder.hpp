@@ -27,6 +27,7 @@
 #include <CuEngine/Vulkan/PhysicalDevice.hpp>
 #include <CuEngine/Vulkan/QueueFamily.hpp>
 
+#include <filesystem>
 #include <map>
 #include <utility>
 #include <vector>
@@ -57,14 +58,21 @@ public:
 
     DeviceBuilder & SetPhysicalDevice(PhysicalDevice & physicalDevice) noexcept;
 
+    // Headless devices do not require swapchain support
+    DeviceBuilder & SetHeadless(bool isHeadless) noexcept;
+
     DeviceBuilder & AddQueues(const QueueFamily & queueFamily, const std::vector<float> & queuePriorities);
 
+    // The cache is kept in memory only when no path is set
+    DeviceBuilder & SetPipelineCachePath(const std::filesystem::path & path);
+
     [[nodiscard]] Device Build() const;
 
     [[nodiscard]] Impl::DeviceBuilder & GetImpl() noexcept;
 
 private:
-    static constexpr auto memorySize      = sizeof(void *) + sizeof(std::map<int, int>);
+    static constexpr auto memorySize =
+        sizeof(void *) * 3 + sizeof(std::map<int, int>) + sizeof(std::filesystem::path);
     static constexpr auto memoryAlignment = std::max(alignof(void *), alignof(std::map<int, int>));
 
     OptimizedPimpl<Impl::DeviceBuilder, memorySize, memoryAlignment> m_Pimpl;
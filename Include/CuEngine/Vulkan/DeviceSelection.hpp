@@ -0,0 +1,49 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Vulkan/Instance.hpp>
+#include <CuEngine/Vulkan/PhysicalDevice.hpp>
+#include <CuEngine/Vulkan/QueueFamily.hpp>
+#include <CuEngine/Vulkan/Surface.hpp>
+
+#include <string_view>
+
+namespace CuEngine::Vulkan
+{
+// Without a surface the presentation family is the graphics family, the transfer and compute families fall back to it
+// as well when the device has no dedicated ones
+struct SuitableDevice
+{
+    PhysicalDevice physicalDevice;
+    QueueFamily    graphicsQueueFamily;
+    QueueFamily    presentationQueueFamily;
+    QueueFamily    transferQueueFamily;
+    QueueFamily    computeQueueFamily;
+};
+
+// Picks the highest ranked device the engine can run on, discrete GPUs first. The preferred device matches part of
+// the device name or its whole UUID, ignoring case, and restricts the choice to the matching devices
+[[nodiscard]] SuitableDevice SelectDevice(Instance & instance, Surface * surface, std::string_view preferredDevice);
+
+} // namespace CuEngine::Vulkan
@@ -0,0 +1,95 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Utility/OptimizedPimpl.hpp>
+#include <CuEngine/Vulkan/CommandBuffer.hpp>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CuEngine::Vulkan
+{
+namespace Impl
+{
+class GpuProfiler;
+}
+
+struct GpuScopeStatistics
+{
+    std::string   name;
+    std::uint32_t sampleCount;
+    double        minMilliseconds;
+    double        averageMilliseconds;
+    double        p50Milliseconds;
+    double        p95Milliseconds;
+    double        p99Milliseconds;
+    double        maxMilliseconds;
+
+    // Averages over the window, only outermost scopes are counted and only where pipeline statistics are supported
+    std::uint64_t inputAssemblyPrimitives;
+    std::uint64_t vertexShaderInvocations;
+    std::uint64_t fragmentShaderInvocations;
+    std::uint64_t computeShaderInvocations;
+};
+
+class GpuProfiler
+{
+public:
+    explicit GpuProfiler(Impl::GpuProfiler && gpuProfiler) noexcept;
+
+    GpuProfiler(const GpuProfiler &) noexcept = delete;
+
+    GpuProfiler(GpuProfiler && other) noexcept;
+
+    GpuProfiler & operator=(const GpuProfiler &) noexcept = delete;
+
+    GpuProfiler & operator=(GpuProfiler && other) noexcept;
+
+    ~GpuProfiler() noexcept;
+
+    // Collects what the frame recorded the last time it was in flight and resets its queries, so that submission
+    // has to be complete. Has to be recorded outside of a render pass
+    void BeginFrame(CommandBuffer & commandBuffer, std::uint32_t frameIndex);
+
+    // Scopes nest and have to be closed before the frame ends, the ones past the scope limit are dropped
+    void BeginScope(CommandBuffer & commandBuffer, std::string_view name);
+
+    void EndScope(CommandBuffer & commandBuffer);
+
+    [[nodiscard]] std::vector<GpuScopeStatistics> GetStatistics() const;
+
+    [[nodiscard]] bool HasPipelineStatistics() const noexcept;
+
+    [[nodiscard]] Impl::GpuProfiler & GetImpl() noexcept;
+
+private:
+    static constexpr auto memorySize      = sizeof(void *);
+    static constexpr auto memoryAlignment = alignof(void *);
+
+    OptimizedPimpl<Impl::GpuProfiler, memorySize, memoryAlignment> m_Pimpl;
+};
+
+} // namespace CuEngine::Vulkan
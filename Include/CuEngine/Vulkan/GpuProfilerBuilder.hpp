@@ -0,0 +1,81 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Utility/OptimizedPimpl.hpp>
+#include <CuEngine/Vulkan/Device.hpp>
+#include <CuEngine/Vulkan/GpuProfiler.hpp>
+#include <CuEngine/Vulkan/PhysicalDevice.hpp>
+#include <CuEngine/Vulkan/QueueFamily.hpp>
+
+#include <cstdint>
+
+namespace CuEngine::Vulkan
+{
+namespace Impl
+{
+class GpuProfilerBuilder;
+}
+
+class GpuProfilerBuilder
+{
+public:
+    explicit GpuProfilerBuilder();
+
+    GpuProfilerBuilder(const GpuProfilerBuilder & other);
+
+    GpuProfilerBuilder(GpuProfilerBuilder && other) noexcept;
+
+    GpuProfilerBuilder & operator=(const GpuProfilerBuilder & other);
+
+    GpuProfilerBuilder & operator=(GpuProfilerBuilder && other) noexcept;
+
+    ~GpuProfilerBuilder() noexcept;
+
+    GpuProfilerBuilder & SetPhysicalDevice(PhysicalDevice & physicalDevice) noexcept;
+
+    GpuProfilerBuilder & SetDevice(Device & device) noexcept;
+
+    // The family of the queue the profiled command buffers are submitted to
+    GpuProfilerBuilder & SetQueueFamily(const QueueFamily & queueFamily) noexcept;
+
+    // Results are read back this many frames after they were recorded
+    GpuProfilerBuilder & SetFramesInFlight(std::uint32_t framesInFlight) noexcept;
+
+    GpuProfilerBuilder & SetMaxScopesPerFrame(std::uint32_t maxScopesPerFrame) noexcept;
+
+    // Number of frames the statistics are computed over
+    GpuProfilerBuilder & SetHistorySize(std::uint32_t historySize) noexcept;
+
+    [[nodiscard]] GpuProfiler Build() const;
+
+    [[nodiscard]] Impl::GpuProfilerBuilder & GetImpl() noexcept;
+
+private:
+    static constexpr auto memorySize      = sizeof(void *) * 2 + sizeof(std::uint32_t) * 4;
+    static constexpr auto memoryAlignment = alignof(void *);
+
+    OptimizedPimpl<Impl::GpuProfilerBuilder, memorySize, memoryAlignment> m_Pimpl;
+};
+
+} // namespace CuEngine::Vulkan
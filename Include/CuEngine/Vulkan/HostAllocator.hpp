@@ -0,0 +1,66 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace CuEngine::Vulkan
+{
+// Mirrors VkSystemAllocationScope
+enum class HostAllocationScope : std::uint32_t
+{
+    Command  = 0,
+    Object   = 1,
+    Cache    = 2,
+    Device   = 3,
+    Instance = 4
+};
+
+struct HostScopeStatistics
+{
+    HostAllocationScope scope;
+    std::uint64_t       currentBytes;
+    std::uint64_t       peakBytes;
+    std::uint64_t       allocationCount;
+    std::uint64_t       liveAllocationCount;
+    // Memory the driver allocated on its own and only reported, e.g. executable memory for shaders
+    std::uint64_t       internalBytes;
+};
+
+struct HostAllocatorStatistics
+{
+    std::vector<HostScopeStatistics> scopes;
+    std::uint64_t                    pooledAllocationCount;
+    std::uint64_t                    systemAllocationCount;
+    std::uint64_t                    poolReservedBytes;
+};
+
+// Host memory the driver allocates through the engine, every Vulkan object is created with these callbacks
+class HostAllocator
+{
+public:
+    [[nodiscard]] static HostAllocatorStatistics GetStatistics();
+};
+
+} // namespace CuEngine::Vulkan
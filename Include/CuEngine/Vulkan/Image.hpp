@@ -0,0 +1,96 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <CuEngine/Utility/OptimizedPimpl.hpp>
+
+#include <cstdint>
+
+namespace CuEngine::Vulkan
+{
+namespace Impl
+{
+class Image;
+}
+
+enum class Format : std::uint32_t
+{
+    Undefined          = 0,
+    R8G8B8A8Unorm      = 37,
+    R8G8B8A8Srgb       = 43,
+    B8G8R8A8Unorm      = 44,
+    B8G8R8A8Srgb       = 50,
+    R16G16B16A16Sfloat = 97,
+    R32Sfloat          = 100,
+    D32Sfloat          = 126,
+    D24UnormS8Uint     = 129
+};
+
+enum class ImageUsage : std::uint32_t
+{
+    TransferSource         = 0x001,
+    TransferDestination    = 0x002,
+    Sampled                = 0x004,
+    Storage                = 0x008,
+    ColorAttachment        = 0x010,
+    DepthStencilAttachment = 0x020,
+    InputAttachment        = 0x080
+};
+
+[[nodiscard]] constexpr ImageUsage operator|(ImageUsage left, ImageUsage right) noexcept
+{
+    return static_cast<ImageUsage>(static_cast<std::uint32_t>(left) | static_cast<std::uint32_t>(right));
+}
+
+class Image
+{
+public:
+    explicit Image(Impl::Image && image) noexcept;
+
+    Image(const Image &) noexcept = delete;
+
+    Image(Image && other) noexcept;
+
+    Image & operator=(const Image &) noexcept = delete;
+
+    Image & operator=(Image && other) noexcept;
+
+    ~Image() noexcept;
+
+    [[nodiscard]] Format GetFormat() const noexcept;
+
+    [[nodiscard]] std::uint32_t GetWidth() const noexcept;
+
+    [[nodiscard]] std::uint32_t GetHeight() const noexcept;
+
+    [[nodiscard]] Impl::Image & GetImpl() noexcept;
+
+    [[nodiscard]] const Impl::Image & GetImpl() const noexcept;
+
+private:
+    static constexpr auto memorySize      = sizeof(void *) * 8 + sizeof(std::uint64_t) * 2 + sizeof(std::uint32_t) * 6;
+    static constexpr auto memoryAlignment = alignof(void *);
+
+    OptimizedPimpl<Impl::Image, memorySize, memoryAlignment> m_Pimpl;
+};
+
+} // namespace CuEngine::Vulkan
@@ -50,13 +50,16 @@ public:
 
     ~InstanceBuilder() noexcept;
 
+    // Skips the extensions window surfaces need, so that no window system has to be present
+    InstanceBuilder & SetHeadless(bool isHeadless) noexcept;
+
     [[nodiscard]] Instance Build() const;
 
     [[nodiscard]] Impl::InstanceBuilder & GetImpl() noexcept;
 
 private:
-    static constexpr auto memorySize      = sizeof(char);
-    static constexpr auto memoryAlignment = alignof(char);
+    static constexpr auto memorySize      = sizeof(bool);
+    static constexpr auto memoryAlignment = alignof(bool);
 
     OptimizedPimpl<Impl::InstanceBuilder, memorySize, memoryAlignment> m_Pimpl;
 };
@@ -0,0 +1,81 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Utility/OptimizedPimpl.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace CuEngine::Vulkan
+{
+namespace Impl
+{
+class MemoryAllocator;
+}
+
+enum class MemoryUsage
+{
+    GpuOnly,
+    CpuToGpu,
+    GpuToCpu
+};
+
+struct MemoryHeapStatistics
+{
+    std::uint64_t size;
+    std::uint64_t blockBytes;
+    std::uint64_t usedBytes;
+    std::uint32_t blockCount;
+    std::uint32_t allocationCount;
+    std::uint32_t dedicatedAllocationCount;
+    bool          isDeviceLocal;
+};
+
+class MemoryAllocator
+{
+public:
+    explicit MemoryAllocator(Impl::MemoryAllocator && memoryAllocator) noexcept;
+
+    MemoryAllocator(const MemoryAllocator &) noexcept = delete;
+
+    MemoryAllocator(MemoryAllocator && other) noexcept;
+
+    MemoryAllocator & operator=(const MemoryAllocator &) noexcept = delete;
+
+    MemoryAllocator & operator=(MemoryAllocator && other) noexcept;
+
+    ~MemoryAllocator() noexcept;
+
+    [[nodiscard]] std::vector<MemoryHeapStatistics> GetStatistics() const;
+
+    [[nodiscard]] Impl::MemoryAllocator & GetImpl() noexcept;
+
+private:
+    static constexpr auto memorySize      = sizeof(void *);
+    static constexpr auto memoryAlignment = alignof(void *);
+
+    OptimizedPimpl<Impl::MemoryAllocator, memorySize, memoryAlignment> m_Pimpl;
+};
+
+} // namespace CuEngine::Vulkan
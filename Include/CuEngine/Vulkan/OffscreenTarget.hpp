@@ -0,0 +1,84 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Utility/OptimizedPimpl.hpp>
+#include <CuEngine/Vulkan/GpuProfiler.hpp>
+#include <CuEngine/Vulkan/Image.hpp>
+#include <CuEngine/Vulkan/Queue.hpp>
+#include <CuEngine/Vulkan/Synchronization.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace CuEngine::Vulkan
+{
+namespace Impl
+{
+class OffscreenTarget;
+}
+
+// Takes the place of a swapchain when there is no window. Every frame in flight renders into a device-local image of
+// its own that is never presented, so nothing waits for vertical sync
+class OffscreenTarget
+{
+public:
+    explicit OffscreenTarget(Impl::OffscreenTarget && offscreenTarget) noexcept;
+
+    OffscreenTarget(const OffscreenTarget &) noexcept = delete;
+
+    OffscreenTarget(OffscreenTarget && other) noexcept;
+
+    OffscreenTarget & operator=(const OffscreenTarget &) noexcept = delete;
+
+    OffscreenTarget & operator=(OffscreenTarget && other) noexcept;
+
+    ~OffscreenTarget() noexcept;
+
+    // Waits until the frame's previous submission is complete, an offscreen image is never out of date
+    [[nodiscard]] bool AcquireNextImage();
+
+    // Leaves the frame's image in the transfer source layout, ready to be read back. The GPU profiler, if any, times
+    // the frame's commands and needs as many frames in flight as the target
+    void Submit(Queue & graphicsQueue, const std::vector<TimelineWait> & waits = {},
+                GpuProfiler * gpuProfiler = nullptr);
+
+    // Waits for every frame in flight
+    void WaitIdle();
+
+    [[nodiscard]] std::uint32_t GetFramesInFlight() const noexcept;
+
+    [[nodiscard]] std::uint32_t GetFrameIndex() const noexcept;
+
+    [[nodiscard]] const Image & GetImage() const noexcept;
+
+    [[nodiscard]] Impl::OffscreenTarget & GetImpl() noexcept;
+
+private:
+    static constexpr auto memorySize      = sizeof(void *);
+    static constexpr auto memoryAlignment = alignof(void *);
+
+    OptimizedPimpl<Impl::OffscreenTarget, memorySize, memoryAlignment> m_Pimpl;
+};
+
+} // namespace CuEngine::Vulkan
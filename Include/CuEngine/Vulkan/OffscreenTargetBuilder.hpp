@@ -0,0 +1,80 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Utility/OptimizedPimpl.hpp>
+#include <CuEngine/Vulkan/Device.hpp>
+#include <CuEngine/Vulkan/Image.hpp>
+#include <CuEngine/Vulkan/OffscreenTarget.hpp>
+#include <CuEngine/Vulkan/QueueFamily.hpp>
+
+#include <cstdint>
+
+namespace CuEngine::Vulkan
+{
+namespace Impl
+{
+class OffscreenTargetBuilder;
+}
+
+class OffscreenTargetBuilder
+{
+public:
+    explicit OffscreenTargetBuilder();
+
+    OffscreenTargetBuilder(const OffscreenTargetBuilder & other);
+
+    OffscreenTargetBuilder(OffscreenTargetBuilder && other) noexcept;
+
+    OffscreenTargetBuilder & operator=(const OffscreenTargetBuilder & other);
+
+    OffscreenTargetBuilder & operator=(OffscreenTargetBuilder && other) noexcept;
+
+    ~OffscreenTargetBuilder() noexcept;
+
+    OffscreenTargetBuilder & SetDevice(Device & device) noexcept;
+
+    // The family of the queue the frames are submitted to
+    OffscreenTargetBuilder & SetQueueFamily(const QueueFamily & queueFamily) noexcept;
+
+    OffscreenTargetBuilder & SetFormat(Format format) noexcept;
+
+    OffscreenTargetBuilder & SetExtent(std::uint32_t width, std::uint32_t height) noexcept;
+
+    // Added to the transfer usages the images always have
+    OffscreenTargetBuilder & SetUsage(ImageUsage usage) noexcept;
+
+    OffscreenTargetBuilder & SetFramesInFlight(std::uint32_t framesInFlight) noexcept;
+
+    [[nodiscard]] OffscreenTarget Build() const;
+
+    [[nodiscard]] Impl::OffscreenTargetBuilder & GetImpl() noexcept;
+
+private:
+    static constexpr auto memorySize      = sizeof(void *) + sizeof(std::uint32_t) * 6;
+    static constexpr auto memoryAlignment = alignof(void *);
+
+    OptimizedPimpl<Impl::OffscreenTargetBuilder, memorySize, memoryAlignment> m_Pimpl;
+};
+
+} // namespace CuEngine::Vulkan
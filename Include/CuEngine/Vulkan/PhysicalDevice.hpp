@@ -25,6 +25,8 @@
 #include <CuEngine/Utility/OptimizedPimpl.hpp>
 #include <CuEngine/Vulkan/Instance.hpp>
 
+#include <cstdint>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -35,6 +37,15 @@ namespace Impl
 class PhysicalDevice;
 }
 
+enum class PhysicalDeviceType : std::uint32_t
+{
+    Other         = 0,
+    IntegratedGpu = 1,
+    DiscreteGpu   = 2,
+    VirtualGpu    = 3,
+    Cpu           = 4
+};
+
 class PhysicalDevice
 {
 public:
@@ -52,12 +63,32 @@ public:
 
     [[nodiscard]] std::string GetName() const;
 
+    [[nodiscard]] float GetTimestampPeriod() const;
+
+    [[nodiscard]] PhysicalDeviceType GetType() const noexcept;
+
+    // Formatted as 8-4-4-4-12 hexadecimal digits, empty when the driver does not report one
+    [[nodiscard]] std::string GetUuid() const;
+
+    [[nodiscard]] std::uint32_t GetApiVersion() const noexcept;
+
+    // Size of the largest device-local heap
+    [[nodiscard]] std::uint64_t GetDeviceLocalMemorySize() const noexcept;
+
+    [[nodiscard]] bool HasExtension(std::string_view name) const noexcept;
+
+    [[nodiscard]] bool HasTimelineSemaphoreSupport() const noexcept;
+
+    [[nodiscard]] bool HasSynchronization2Support() const noexcept;
+
+    [[nodiscard]] bool HasPipelineStatisticsSupport() const noexcept;
+
     [[nodiscard]] Impl::PhysicalDevice & GetImpl() noexcept;
 
     [[nodiscard]] static std::vector<PhysicalDevice> Enumerate(Instance & instance);
 
 private:
-    static constexpr auto memorySize      = sizeof(void *);
+    static constexpr auto memorySize      = sizeof(void *) * 2;
     static constexpr auto memoryAlignment = alignof(void *);
 
     OptimizedPimpl<Impl::PhysicalDevice, memorySize, memoryAlignment> m_Pimpl;
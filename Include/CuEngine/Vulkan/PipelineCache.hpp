@@ -0,0 +1,73 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Utility/OptimizedPimpl.hpp>
+
+#include <cstdint>
+
+namespace CuEngine::Vulkan
+{
+namespace Impl
+{
+class PipelineCache;
+}
+
+// Hits and misses come from pipeline creation feedback and stay zero without the extension or without pipelines
+struct PipelineCacheStatistics
+{
+    std::uint64_t hits;
+    std::uint64_t misses;
+    std::size_t   loadedSize;
+    std::size_t   savedSize;
+};
+
+class PipelineCache
+{
+public:
+    explicit PipelineCache(Impl::PipelineCache && pipelineCache) noexcept;
+
+    PipelineCache(const PipelineCache &) noexcept = delete;
+
+    PipelineCache(PipelineCache && other) noexcept;
+
+    PipelineCache & operator=(const PipelineCache &) noexcept = delete;
+
+    PipelineCache & operator=(PipelineCache && other) noexcept;
+
+    ~PipelineCache() noexcept;
+
+    void Save();
+
+    [[nodiscard]] PipelineCacheStatistics GetStatistics() const noexcept;
+
+    [[nodiscard]] Impl::PipelineCache & GetImpl() noexcept;
+
+private:
+    static constexpr auto memorySize      = sizeof(void *) * 3;
+    static constexpr auto memoryAlignment = alignof(void *);
+
+    OptimizedPimpl<Impl::PipelineCache, memorySize, memoryAlignment> m_Pimpl;
+};
+
+} // namespace CuEngine::Vulkan
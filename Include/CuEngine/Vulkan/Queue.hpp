@@ -23,8 +23,13 @@
 #pragma once
 
 #include <CuEngine/Utility/OptimizedPimpl.hpp>
+#include <CuEngine/Vulkan/CommandBuffer.hpp>
 #include <CuEngine/Vulkan/Device.hpp>
 #include <CuEngine/Vulkan/QueueFamily.hpp>
+#include <CuEngine/Vulkan/Synchronization.hpp>
+#include <CuEngine/Vulkan/TimelineSemaphore.hpp>
+
+#include <vector>
 
 namespace CuEngine::Vulkan
 {
@@ -48,6 +53,10 @@ public:
 
     ~Queue() noexcept;
 
+    // Command buffers start once all waits are satisfied, the signals fire when all of them have completed
+    void Submit(const std::vector<CommandBuffer> & commandBuffers, const std::vector<TimelineWait> & waits = {},
+                const std::vector<TimelineSignal> & signals = {});
+
     [[nodiscard]] Impl::Queue & getImpl() noexcept;
 
     [[nodiscard]] static Queue Get(Device & device, QueueFamily & queueFamily, std::uint32_t queueIndex);
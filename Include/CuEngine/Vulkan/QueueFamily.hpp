@@ -26,6 +26,7 @@
 #include <CuEngine/Vulkan/PhysicalDevice.hpp>
 #include <CuEngine/Vulkan/Surface.hpp>
 
+#include <cstdint>
 #include <string_view>
 #include <vector>
 
@@ -53,8 +54,18 @@ public:
 
     [[nodiscard]] bool HasGraphicsSupport() const noexcept;
 
+    [[nodiscard]] bool HasTransferSupport() const noexcept;
+
+    [[nodiscard]] bool HasComputeSupport() const noexcept;
+
+    [[nodiscard]] bool IsTransferOnly() const noexcept;
+
+    [[nodiscard]] bool IsComputeOnly() const noexcept;
+
     [[nodiscard]] bool HasSurfaceSupport(Surface & surface) const;
 
+    [[nodiscard]] std::uint32_t GetIndex() const noexcept;
+
     [[nodiscard]] Impl::QueueFamily & GetImpl() noexcept;
 
     [[nodiscard]] const Impl::QueueFamily & GetImpl() const noexcept;
@@ -64,7 +75,7 @@ public:
     [[nodiscard]] static std::vector<QueueFamily> Enumerate(PhysicalDevice & queueFamiliesProperty);
 
 private:
-    static constexpr auto memorySize      = sizeof(void *) + sizeof(std::uint32_t) * 2;
+    static constexpr auto memorySize      = sizeof(void *) * 2 + sizeof(std::uint32_t) * 2;
     static constexpr auto memoryAlignment = alignof(void *);
 
     OptimizedPimpl<Impl::QueueFamily, memorySize, memoryAlignment> m_Pimpl;
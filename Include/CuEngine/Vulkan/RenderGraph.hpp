@@ -0,0 +1,162 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <CuEngine/Utility/OptimizedPimpl.hpp>
+#include <CuEngine/Vulkan/Buffer.hpp>
+#include <CuEngine/Vulkan/CommandBuffer.hpp>
+#include <CuEngine/Vulkan/Image.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace CuEngine::Vulkan
+{
+namespace Impl
+{
+class RenderGraph;
+}
+
+class RenderGraph;
+
+// Handles index the resource tables of the builder that returned them
+struct ImageHandle
+{
+    std::uint32_t index;
+};
+
+struct BufferHandle
+{
+    std::uint32_t index;
+};
+
+// Every access implies the pipeline stages, memory access and, for images, the layout it happens in
+enum class ImageAccess : std::uint32_t
+{
+    None,
+    ColorAttachmentWrite,
+    DepthAttachmentWrite,
+    DepthAttachmentRead,
+    FragmentShaderRead,
+    ComputeShaderRead,
+    ComputeShaderWrite,
+    TransferRead,
+    TransferWrite,
+    Present
+};
+
+enum class BufferAccess : std::uint32_t
+{
+    None,
+    VertexRead,
+    IndexRead,
+    IndirectRead,
+    UniformRead,
+    VertexShaderRead,
+    FragmentShaderRead,
+    ComputeShaderRead,
+    ComputeShaderWrite,
+    TransferRead,
+    TransferWrite
+};
+
+// Usage flags of transient images are derived from the accesses of the passes using them
+struct ImageDescription
+{
+    Format        format;
+    std::uint32_t width;
+    std::uint32_t height;
+};
+
+struct ImageUse
+{
+    ImageHandle image;
+    ImageAccess access;
+};
+
+struct BufferUse
+{
+    BufferHandle buffer;
+    BufferAccess access;
+};
+
+struct RenderPassDescription
+{
+    std::string            name;
+    std::vector<ImageUse>  images;
+    std::vector<BufferUse> buffers;
+
+    // Passes whose results leave the graph some other way, e.g. a readback, are never culled
+    bool hasSideEffects;
+
+    std::function<void(CommandBuffer &, const RenderGraph &)> execute;
+};
+
+struct RenderGraphStatistics
+{
+    std::uint32_t passCount;
+    std::uint32_t culledPassCount;
+    std::uint32_t barrierBatchCount;
+    std::uint32_t imageBarrierCount;
+    std::uint32_t bufferBarrierCount;
+    std::uint64_t transientMemorySize;
+    std::uint64_t unaliasedMemorySize;
+};
+
+class RenderGraph
+{
+public:
+    explicit RenderGraph(Impl::RenderGraph && renderGraph) noexcept;
+
+    RenderGraph(const RenderGraph &) noexcept = delete;
+
+    RenderGraph(RenderGraph && other) noexcept;
+
+    RenderGraph & operator=(const RenderGraph &) noexcept = delete;
+
+    RenderGraph & operator=(RenderGraph && other) noexcept;
+
+    ~RenderGraph() noexcept;
+
+    // Records the live passes and their barriers into a command buffer that is already recording
+    void Execute(CommandBuffer & commandBuffer) const;
+
+    [[nodiscard]] const Image & GetImage(ImageHandle image) const noexcept;
+
+    [[nodiscard]] const Buffer & GetBuffer(BufferHandle buffer) const noexcept;
+
+    [[nodiscard]] RenderGraphStatistics GetStatistics() const noexcept;
+
+    [[nodiscard]] Impl::RenderGraph & GetImpl() noexcept;
+
+    [[nodiscard]] const Impl::RenderGraph & GetImpl() const noexcept;
+
+private:
+    static constexpr auto memorySize      = sizeof(void *);
+    static constexpr auto memoryAlignment = alignof(void *);
+
+    OptimizedPimpl<Impl::RenderGraph, memorySize, memoryAlignment> m_Pimpl;
+};
+
+} // namespace CuEngine::Vulkan
@@ -0,0 +1,78 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <CuEngine/Utility/OptimizedPimpl.hpp>
+#include <CuEngine/Vulkan/Buffer.hpp>
+#include <CuEngine/Vulkan/Device.hpp>
+#include <CuEngine/Vulkan/Image.hpp>
+#include <CuEngine/Vulkan/RenderGraph.hpp>
+
+#include <vector>
+
+namespace CuEngine::Vulkan
+{
+namespace Impl
+{
+class RenderGraphBuilder;
+}
+
+class RenderGraphBuilder
+{
+public:
+    explicit RenderGraphBuilder();
+
+    RenderGraphBuilder(const RenderGraphBuilder & other);
+
+    RenderGraphBuilder(RenderGraphBuilder && other) noexcept;
+
+    RenderGraphBuilder & operator=(const RenderGraphBuilder & other);
+
+    RenderGraphBuilder & operator=(RenderGraphBuilder && other) noexcept;
+
+    ~RenderGraphBuilder() noexcept;
+
+    RenderGraphBuilder & SetDevice(Device & device) noexcept;
+
+    // Transient images only live for the duration of the graph, their memory is shared when lifetimes do not overlap
+    [[nodiscard]] ImageHandle CreateImage(const ImageDescription & description);
+
+    // The graph takes imported images from the initial access and leaves them in the final one after execution
+    [[nodiscard]] ImageHandle ImportImage(const Image & image, ImageAccess initialAccess, ImageAccess finalAccess);
+
+    [[nodiscard]] BufferHandle ImportBuffer(const Buffer & buffer, BufferAccess initialAccess);
+
+    // Passes execute in the order they were added
+    RenderGraphBuilder & AddPass(const RenderPassDescription & pass);
+
+    [[nodiscard]] RenderGraph Build() const;
+
+    [[nodiscard]] Impl::RenderGraphBuilder & GetImpl() noexcept;
+
+private:
+    static constexpr auto memorySize      = sizeof(void *) + sizeof(std::vector<int>) * 3;
+    static constexpr auto memoryAlignment = alignof(void *);
+
+    OptimizedPimpl<Impl::RenderGraphBuilder, memorySize, memoryAlignment> m_Pimpl;
+};
+
+} // namespace CuEngine::Vulkan
@@ -0,0 +1,97 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Utility/OptimizedPimpl.hpp>
+#include <CuEngine/Vulkan/GpuProfiler.hpp>
+#include <CuEngine/Vulkan/Queue.hpp>
+#include <CuEngine/Vulkan/Synchronization.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace CuEngine::Vulkan
+{
+namespace Impl
+{
+class Swapchain;
+}
+
+enum class PresentMode
+{
+    Immediate,
+    Mailbox,
+    Fifo,
+    FifoRelaxed
+};
+
+class Swapchain
+{
+public:
+    explicit Swapchain(Impl::Swapchain && swapchain) noexcept;
+
+    Swapchain(const Swapchain &) noexcept = delete;
+
+    Swapchain(Swapchain && other) noexcept;
+
+    Swapchain & operator=(const Swapchain &) noexcept = delete;
+
+    Swapchain & operator=(Swapchain && other) noexcept;
+
+    ~Swapchain() noexcept;
+
+    [[nodiscard]] bool AcquireNextImage();
+
+    // The frame's submission also waits for the given timeline values, e.g. uploads feeding this frame. The GPU
+    // profiler, if any, times the frame's commands and needs as many frames in flight as the swapchain
+    [[nodiscard]] bool Present(Queue & graphicsQueue, Queue & presentationQueue,
+                               const std::vector<TimelineWait> & waits = {}, GpuProfiler * gpuProfiler = nullptr);
+
+    [[nodiscard]] PresentMode GetPresentMode() const noexcept;
+
+    [[nodiscard]] std::uint32_t GetFramesInFlight() const noexcept;
+
+    [[nodiscard]] std::uint32_t GetFrameIndex() const noexcept;
+
+    [[nodiscard]] std::uint32_t GetImageCount() const noexcept;
+
+    [[nodiscard]] std::uint32_t GetImageIndex() const noexcept;
+
+    // Color the frame is cleared to when it is recorded, the default is opaque black
+    void SetClearColor(float red, float green, float blue, float alpha) noexcept;
+
+    [[nodiscard]] std::uint32_t GetWidth() const noexcept;
+
+    [[nodiscard]] std::uint32_t GetHeight() const noexcept;
+
+    [[nodiscard]] Impl::Swapchain & GetImpl() noexcept;
+
+private:
+    static constexpr auto memorySize =
+        sizeof(void *) * 2 + sizeof(std::uint32_t) * 6 + sizeof(float) * 4 + sizeof(std::vector<void *>) * 6;
+    static constexpr auto memoryAlignment = alignof(void *);
+
+    OptimizedPimpl<Impl::Swapchain, memorySize, memoryAlignment> m_Pimpl;
+};
+
+} // namespace CuEngine::Vulkan
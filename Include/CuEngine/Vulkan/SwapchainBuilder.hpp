@@ -0,0 +1,90 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Platform/Window.hpp>
+#include <CuEngine/Utility/OptimizedPimpl.hpp>
+#include <CuEngine/Vulkan/Device.hpp>
+#include <CuEngine/Vulkan/PhysicalDevice.hpp>
+#include <CuEngine/Vulkan/QueueFamily.hpp>
+#include <CuEngine/Vulkan/Surface.hpp>
+#include <CuEngine/Vulkan/Swapchain.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace CuEngine::Vulkan
+{
+namespace Impl
+{
+class SwapchainBuilder;
+}
+
+class SwapchainBuilder
+{
+public:
+    explicit SwapchainBuilder();
+
+    SwapchainBuilder(const SwapchainBuilder & other);
+
+    SwapchainBuilder(SwapchainBuilder && other) noexcept;
+
+    SwapchainBuilder & operator=(const SwapchainBuilder & other);
+
+    SwapchainBuilder & operator=(SwapchainBuilder && other) noexcept;
+
+    ~SwapchainBuilder() noexcept;
+
+    SwapchainBuilder & SetPhysicalDevice(PhysicalDevice & physicalDevice) noexcept;
+
+    SwapchainBuilder & SetDevice(Device & device) noexcept;
+
+    SwapchainBuilder & SetSurface(Surface & surface) noexcept;
+
+    SwapchainBuilder & SetWindow(Platform::Window & window) noexcept;
+
+    SwapchainBuilder & SetQueueFamilies(const QueueFamily & graphicsQueueFamily,
+                                        const QueueFamily & presentationQueueFamily);
+
+    // Modes are tried in the given order, FIFO is used when none of them is supported
+    SwapchainBuilder & SetPresentModes(const std::vector<PresentMode> & presentModes);
+
+    SwapchainBuilder & SetFramesInFlight(std::uint32_t framesInFlight) noexcept;
+
+    // Recreates from the given swapchain without waiting for the device, its queued presents still go through.
+    // Build takes over its frames in flight and leaves it empty, so it can simply be replaced by the result
+    SwapchainBuilder & SetOldSwapchain(Swapchain & swapchain) noexcept;
+
+    [[nodiscard]] Swapchain Build() const;
+
+    [[nodiscard]] Impl::SwapchainBuilder & GetImpl() noexcept;
+
+private:
+    static constexpr auto memorySize =
+        sizeof(void *) * 5 + sizeof(std::vector<int>) * 2 + sizeof(std::uint32_t) * 2;
+    static constexpr auto memoryAlignment = alignof(void *);
+
+    OptimizedPimpl<Impl::SwapchainBuilder, memorySize, memoryAlignment> m_Pimpl;
+};
+
+} // namespace CuEngine::Vulkan
@@ -0,0 +1,109 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstdint>
+
+namespace CuEngine::Vulkan
+{
+class Buffer;
+class TimelineSemaphore;
+
+// Values match VkPipelineStageFlagBits
+enum class PipelineStage : std::uint32_t
+{
+    None                  = 0x00000,
+    TopOfPipe             = 0x00001,
+    DrawIndirect          = 0x00002,
+    VertexInput           = 0x00004,
+    VertexShader          = 0x00008,
+    FragmentShader        = 0x00080,
+    EarlyFragmentTests    = 0x00100,
+    LateFragmentTests     = 0x00200,
+    ColorAttachmentOutput = 0x00400,
+    ComputeShader         = 0x00800,
+    Transfer              = 0x01000,
+    BottomOfPipe          = 0x02000,
+    Host                  = 0x04000,
+    AllGraphics           = 0x08000,
+    AllCommands           = 0x10000
+};
+
+// Values match VkAccessFlagBits
+enum class Access : std::uint32_t
+{
+    None                 = 0x00000,
+    IndirectCommandRead  = 0x00001,
+    IndexRead            = 0x00002,
+    VertexAttributeRead  = 0x00004,
+    UniformRead          = 0x00008,
+    ShaderRead           = 0x00020,
+    ShaderWrite          = 0x00040,
+    ColorAttachmentRead  = 0x00080,
+    ColorAttachmentWrite = 0x00100,
+    DepthStencilRead     = 0x00200,
+    DepthStencilWrite    = 0x00400,
+    TransferRead         = 0x00800,
+    TransferWrite        = 0x01000,
+    HostRead             = 0x02000,
+    HostWrite            = 0x04000,
+    MemoryRead           = 0x08000,
+    MemoryWrite          = 0x10000
+};
+
+[[nodiscard]] constexpr PipelineStage operator|(PipelineStage left, PipelineStage right) noexcept
+{
+    return static_cast<PipelineStage>(static_cast<std::uint32_t>(left) | static_cast<std::uint32_t>(right));
+}
+
+[[nodiscard]] constexpr Access operator|(Access left, Access right) noexcept
+{
+    return static_cast<Access>(static_cast<std::uint32_t>(left) | static_cast<std::uint32_t>(right));
+}
+
+struct TimelineWait
+{
+    const TimelineSemaphore * semaphore;
+    std::uint64_t             value;
+    PipelineStage             stage;
+};
+
+struct TimelineSignal
+{
+    const TimelineSemaphore * semaphore;
+    std::uint64_t             value;
+};
+
+// Recorded twice: released on the source family's queue and acquired on the destination family's queue
+struct BufferOwnershipTransfer
+{
+    const Buffer * buffer;
+    std::uint32_t  sourceQueueFamily;
+    std::uint32_t  destinationQueueFamily;
+    PipelineStage  sourceStage;
+    Access         sourceAccess;
+    PipelineStage  destinationStage;
+    Access         destinationAccess;
+};
+
+} // namespace CuEngine::Vulkan
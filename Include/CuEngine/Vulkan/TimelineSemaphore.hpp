@@ -0,0 +1,71 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Utility/OptimizedPimpl.hpp>
+#include <CuEngine/Vulkan/Device.hpp>
+
+#include <cstdint>
+
+namespace CuEngine::Vulkan
+{
+namespace Impl
+{
+class TimelineSemaphore;
+}
+
+class TimelineSemaphore
+{
+public:
+    explicit TimelineSemaphore(Impl::TimelineSemaphore && timelineSemaphore) noexcept;
+
+    TimelineSemaphore(const TimelineSemaphore &) noexcept = delete;
+
+    TimelineSemaphore(TimelineSemaphore && other) noexcept;
+
+    TimelineSemaphore & operator=(const TimelineSemaphore &) noexcept = delete;
+
+    TimelineSemaphore & operator=(TimelineSemaphore && other) noexcept;
+
+    ~TimelineSemaphore() noexcept;
+
+    [[nodiscard]] std::uint64_t GetValue() const;
+
+    void Wait(std::uint64_t value) const;
+
+    void Signal(std::uint64_t value);
+
+    [[nodiscard]] Impl::TimelineSemaphore & GetImpl() noexcept;
+
+    [[nodiscard]] const Impl::TimelineSemaphore & GetImpl() const noexcept;
+
+    [[nodiscard]] static TimelineSemaphore Create(Device & device, std::uint64_t initialValue = 0);
+
+private:
+    static constexpr auto memorySize      = sizeof(void *) * 2;
+    static constexpr auto memoryAlignment = alignof(void *);
+
+    OptimizedPimpl<Impl::TimelineSemaphore, memorySize, memoryAlignment> m_Pimpl;
+};
+
+} // namespace CuEngine::Vulkan
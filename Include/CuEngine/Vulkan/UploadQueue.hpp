@@ -0,0 +1,77 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Utility/OptimizedPimpl.hpp>
+#include <CuEngine/Vulkan/Buffer.hpp>
+#include <CuEngine/Vulkan/TimelineSemaphore.hpp>
+
+#include <cstdint>
+
+namespace CuEngine::Vulkan
+{
+namespace Impl
+{
+class UploadQueue;
+}
+
+class UploadQueue
+{
+public:
+    explicit UploadQueue(Impl::UploadQueue && uploadQueue) noexcept;
+
+    UploadQueue(const UploadQueue &) noexcept = delete;
+
+    UploadQueue(UploadQueue && other) noexcept;
+
+    UploadQueue & operator=(const UploadQueue &) noexcept = delete;
+
+    UploadQueue & operator=(UploadQueue && other) noexcept;
+
+    ~UploadQueue() noexcept;
+
+    // The data is copied into the staging ring right away, the returned timeline value is signaled once the
+    // destination has been written
+    [[nodiscard]] std::uint64_t Upload(Buffer & destination, std::uint64_t offset, const void * data,
+                                       std::uint64_t size);
+
+    // Submits all pending copies as one batch
+    std::uint64_t Flush();
+
+    [[nodiscard]] bool IsComplete(std::uint64_t value) const;
+
+    void Wait(std::uint64_t value);
+
+    // Signaled with the values returned from Upload and Flush, other queues can wait on it instead of the host
+    [[nodiscard]] const TimelineSemaphore & GetSemaphore() const noexcept;
+
+    [[nodiscard]] Impl::UploadQueue & GetImpl() noexcept;
+
+private:
+    static constexpr auto memorySize      = sizeof(void *);
+    static constexpr auto memoryAlignment = alignof(void *);
+
+    OptimizedPimpl<Impl::UploadQueue, memorySize, memoryAlignment> m_Pimpl;
+};
+
+} // namespace CuEngine::Vulkan
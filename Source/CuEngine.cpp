@@ -21,60 +21,577 @@
 // SOFTWARE.
 
 #include <CuEngine/CuEngine.hpp>
+#include <CuEngine/Platform/FramePacerBuilder.hpp>
 #include <CuEngine/Platform/SystemBuilder.hpp>
 #include <CuEngine/Platform/WindowBuilder.hpp>
+#include <CuEngine/Profiling/Profiler.hpp>
+#include <CuEngine/Jobs/SchedulerBuilder.hpp>
+#include <CuEngine/Rendering/RenderPacketQueueBuilder.hpp>
+#include <CuEngine/Scene/TransformHierarchy.hpp>
+#include <CuEngine/Scene/World.hpp>
+#include <CuEngine/Simulation/SimulationLoopBuilder.hpp>
+#include <CuEngine/Simulation/SnapshotChannel.hpp>
+#include <CuEngine/Utility/TripleBuffer.hpp>
+#include <CuEngine/Vulkan/BufferBuilder.hpp>
 #include <CuEngine/Vulkan/DeviceBuilder.hpp>
+#include <CuEngine/Vulkan/DeviceSelection.hpp>
+#include <CuEngine/Vulkan/GpuProfilerBuilder.hpp>
+#include <CuEngine/Vulkan/HostAllocator.hpp>
 #include <CuEngine/Vulkan/InstanceBuilder.hpp>
+#include <CuEngine/Vulkan/OffscreenTargetBuilder.hpp>
 #include <CuEngine/Vulkan/PhysicalDevice.hpp>
 #include <CuEngine/Vulkan/Queue.hpp>
 #include <CuEngine/Vulkan/QueueFamily.hpp>
 #include <CuEngine/Vulkan/SurfaceBuilder.hpp>
+#include <CuEngine/Vulkan/SwapchainBuilder.hpp>
+#include <CuEngine/Vulkan/UploadQueueBuilder.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <exception>
 #include <iostream>
+#include <mutex>
+#include <numbers>
+#include <optional>
+#include <random>
 #include <set>
+#include <span>
+#include <string>
+#include <stop_token>
+#include <string_view>
+#include <thread>
+#include <vector>
 
 namespace CuEngine
 {
-struct SuitableDevice
+// What the simulation hands to the renderer: input nudges the phase, which the clear color cycles through
+struct DemoState
 {
-    Vulkan::PhysicalDevice physicalDevice;
-    Vulkan::QueueFamily    graphicsQueueFamily;
-    Vulkan::QueueFamily    presentationQueueFamily;
+    float phase    = 0.0f;
+    float velocity = 0.0f;
+
+    bool operator==(const DemoState &) const noexcept = default;
+};
+
+constexpr auto demoMaterialCount = 4u;
+constexpr auto demoInstanceScale = 0.005f;
+
+// Entities drift while the input keeps the phase moving, so an idle demo stays idle
+struct DemoPosition
+{
+    float x = 0.0f;
+    float y = 0.0f;
+};
+
+struct DemoVelocity
+{
+    float x = 0.0f;
+    float y = 0.0f;
+};
+
+struct DemoMaterial
+{
+    std::uint16_t index = 0;
+};
+
+struct DemoVisibility
+{
+    bool isVisible = false;
+};
+
+struct DemoTransform
+{
+    Scene::TransformNode node;
+};
+
+// What the render systems extracted from the world in the last tick that moved anything, per material
+struct DemoScene
+{
+    std::array<std::vector<std::array<float, 4>>, demoMaterialCount> instances;
+};
+
+// World matrices on their way from the simulation to the render thread, which is the only one submitting to the
+// queues. Only the changed ranges are copied in and out, so neither side holds the lock for long
+struct TransformUploads
+{
+    std::mutex                         mutex;
+    std::vector<Math::Mat4>            publishedMatrices;
+    std::vector<Scene::TransformRange> publishedRanges;
+
+    // Render thread only, what it has taken so far and the ranges still to copy into the instance buffer
+    std::vector<Math::Mat4>            matrices;
+    std::vector<Scene::TransformRange> ranges;
+};
+
+struct TransformStatistics
+{
+    std::uint64_t updateCount      = 0;
+    std::uint64_t updatedCount     = 0;
+    std::uint64_t uploadedCount    = 0;
+    std::uint64_t uploadRangeCount = 0;
+};
+
+struct RenderStatistics
+{
+    std::uint64_t packetCount      = 0;
+    std::uint64_t drawCount        = 0;
+    std::uint64_t batchCount       = 0;
+    std::uint64_t droppedDrawCount = 0;
 };
 
 static Platform::System CreateSystem();
 
 static Platform::Window CreateWindow(Platform::System & system);
 
-static Vulkan::Instance CreateInstance();
+static Platform::FramePacer CreateFramePacer(const ApplicationOptions & options);
+
+static DemoState ApplyInput(DemoState state, const Platform::InputEvent & event) noexcept;
+
+static DemoState StepDemo(DemoState state, float tickSeconds) noexcept;
+
+static void CreateDemoEntities(Scene::World & world, Scene::TransformHierarchy & transforms,
+                               std::uint32_t entityCount);
+
+static void AnimateDemoEntities(Scene::World & world, Jobs::Scheduler & scheduler, float seconds);
+
+static void CullDemoEntities(Scene::World & world, Jobs::Scheduler & scheduler);
 
-static SuitableDevice FindSuitableDevice(Vulkan::Instance & instance, Vulkan::Surface & surface);
+static void ExtractDemoScene(Scene::World & world, DemoScene & scene);
 
-static Vulkan::Device CreateDevice(SuitableDevice & suitableDevice);
+static void UpdateDemoTransforms(Scene::World & world, Scene::TransformHierarchy & transforms,
+                                 Jobs::Scheduler & scheduler, TransformStatistics & statistics);
+
+static void PublishTransforms(Scene::TransformHierarchy & transforms, TransformUploads & uploads);
+
+static void UploadTransforms(TransformUploads & uploads, Vulkan::SuitableDevice & suitableDevice,
+                             Vulkan::Device & device, Vulkan::UploadQueue & uploadQueue,
+                             std::optional<Vulkan::Buffer> & instanceBuffer, TransformStatistics & statistics);
+
+static void BuildRenderPacket(Rendering::RenderPacket & packet, float phase, const DemoScene & scene,
+                              std::uint32_t width, std::uint32_t height) noexcept;
+
+static void TranslateRenderPacket(const Rendering::RenderPacket & packet, Vulkan::Swapchain * swapchain,
+                                  RenderStatistics & statistics) noexcept;
+
+static Vulkan::Instance CreateInstance(bool isHeadless);
+
+static Vulkan::SuitableDevice FindSuitableDevice(Vulkan::Instance & instance, Vulkan::Surface * surface,
+                                                 std::string_view preferredDevice);
+
+static Vulkan::Device CreateDevice(Vulkan::SuitableDevice & suitableDevice, bool isHeadless);
 
 static Vulkan::Queue GetQueue(Vulkan::Device & device, Vulkan::QueueFamily & queueFamily);
 
 static Vulkan::Surface CreateSurface(Vulkan::Instance & instance, Platform::Window & window);
 
-int Application::Run() noexcept
+static Vulkan::Swapchain CreateSwapchain(Vulkan::SuitableDevice & suitableDevice, Vulkan::Device & device,
+                                         Vulkan::Surface & surface, Platform::Window & window,
+                                         Vulkan::Swapchain * oldSwapchain = nullptr);
+
+static Vulkan::OffscreenTarget CreateOffscreenTarget(Vulkan::SuitableDevice & suitableDevice, Vulkan::Device & device);
+
+static Vulkan::UploadQueue CreateUploadQueue(Vulkan::Device & device, Vulkan::Queue & transferQueue,
+                                             Vulkan::QueueFamily & transferQueueFamily);
+
+static Vulkan::Buffer CreateInstanceBuffer(Vulkan::SuitableDevice & suitableDevice, Vulkan::Device & device,
+                                           std::uint64_t size);
+
+static Vulkan::GpuProfiler CreateGpuProfiler(Vulkan::SuitableDevice & suitableDevice, Vulkan::Device & device,
+                                             std::uint32_t framesInFlight);
+
+static std::string_view GetScopeName(Vulkan::HostAllocationScope scope) noexcept;
+
+int Application::Run(const ApplicationOptions & options) noexcept
 {
 
     try
     {
-        auto system            = CreateSystem();
-        auto window            = CreateWindow(system);
-        auto instance          = CreateInstance();
-        auto surface           = CreateSurface(instance, window);
-        auto suitableDevice    = FindSuitableDevice(instance, surface);
-        auto device            = CreateDevice(suitableDevice);
+#if defined(CU_ENABLE_PROFILING)
+        constexpr auto profileFrameCount = 300;
+        constexpr auto profilePath       = "CuEngine.trace.json";
+
+        // Covers the start-up and the first frames
+        Profiling::CaptureFrames(profileFrameCount, profilePath);
+#endif
+        CU_PROFILE_THREAD("Main");
+
+        // Headless runs have no window system at all and render into offscreen images instead of a swapchain. The
+        // window system has to exist first, it reports the surface extensions the instance is created with
+        auto system = std::optional<Platform::System>();
+        if (!options.isHeadless)
+        {
+            system = CreateSystem();
+        }
+
+        auto instance = CreateInstance(options.isHeadless);
+        auto window   = std::optional<Platform::Window>();
+        auto surface  = std::optional<Vulkan::Surface>();
+        if (!options.isHeadless)
+        {
+            window  = CreateWindow(*system);
+            surface = CreateSurface(instance, *window);
+        }
+
+        auto suitableDevice    = FindSuitableDevice(instance, surface ? &*surface : nullptr, options.preferredDevice);
+        auto device            = CreateDevice(suitableDevice, options.isHeadless);
         auto graphicsQueue     = GetQueue(device, suitableDevice.graphicsQueueFamily);
         auto presentationQueue = GetQueue(device, suitableDevice.presentationQueueFamily);
+        auto transferQueue     = GetQueue(device, suitableDevice.transferQueueFamily);
+        auto computeQueue      = GetQueue(device, suitableDevice.computeQueueFamily);
+        auto uploadQueue       = CreateUploadQueue(device, transferQueue, suitableDevice.transferQueueFamily);
+
+        // Each frame's compute work signals the next value and the frame waits for it on the GPU only, so on a
+        // dedicated family it overlaps the rasterization of the frame before
+        auto computeSemaphore = Vulkan::TimelineSemaphore::Create(device);
+        auto computeValue     = std::uint64_t(0);
+
+        auto swapchain       = std::optional<Vulkan::Swapchain>();
+        auto offscreenTarget = std::optional<Vulkan::OffscreenTarget>();
+        if (options.isHeadless)
+        {
+            offscreenTarget = CreateOffscreenTarget(suitableDevice, device);
+        }
+        else
+        {
+            swapchain = CreateSwapchain(suitableDevice, device, *surface, *window);
+        }
+
+        // Recreated swapchains keep the frames of the old one, so the frame count never changes
+        auto framesInFlight = swapchain ? swapchain->GetFramesInFlight() : offscreenTarget->GetFramesInFlight();
+        auto gpuProfiler    = CreateGpuProfiler(suitableDevice, device, framesInFlight);
+
+        // Resizes are coalesced by the window, so a drag recreates the swapchain at most once per frame
+        auto isSwapchainOutdated = std::atomic<bool>(false);
+        if (window)
+        {
+            window->SetResizeCallback(
+                [&isSwapchainOutdated](std::uint32_t width, std::uint32_t height)
+                {
+                    if (width != 0 && height != 0)
+                    {
+                        isSwapchainOutdated.store(true);
+                    }
+                });
+        }
+
+        constexpr auto defaultTickRate     = 60.0;
+        constexpr auto demoEntityCount     = 100000u;
+        constexpr auto instanceDataPerDraw = demoEntityCount * sizeof(std::array<float, 4>);
+
+        // The simulation owns the world, the frame thread only sees the latest scene extracted from it
+        auto scheduler = Jobs::SchedulerBuilder().Build();
+        auto world     = Scene::World();
+        auto scenes    = TripleBuffer<DemoScene>();
+
+        // World matrices live on the GPU in one persistent buffer, indexed like the hierarchy lays them out, and only
+        // the ranges that changed are copied into it. The simulation publishes them, the render thread uploads them
+        auto transforms          = Scene::TransformHierarchy();
+        auto transformUploads    = TransformUploads();
+        auto instanceBuffer      = std::optional<Vulkan::Buffer>();
+        auto transformStatistics = TransformStatistics();
+        CreateDemoEntities(world, transforms, demoEntityCount);
 
-        // Main loop
-        while (!window.ShouldClose())
+        auto framePacer      = CreateFramePacer(options);
+        auto snapshots       = Simulation::SnapshotChannel<DemoState>();
+        auto tickRate        = options.simulationTickRate > 0.0 ? options.simulationTickRate : defaultTickRate;
+        auto inputEventCount = std::uint64_t(0);
+        auto maxInputLatency = std::chrono::steady_clock::duration::zero();
+
+        // Input is consumed by the simulation thread, which owns the state, the renderer only ever sees snapshots
+        auto simulation = Simulation::SimulationLoopBuilder()
+                              .SetTickRate(tickRate)
+                              .SetTickFunction(
+                                  [&, state = DemoState(), wasChanging = true](
+                                      std::uint64_t tick, std::chrono::steady_clock::time_point tickTime) mutable
+                                  {
+                                      auto previousState = state;
+                                      auto tickSeconds   = static_cast<float>(1.0 / tickRate);
+                                      auto event         = Platform::InputEvent();
+                                      while (window && window->PopInputEvent(event))
+                                      {
+                                          auto inputLatency = std::chrono::steady_clock::now() - event.timestamp;
+                                          maxInputLatency   = std::max(maxInputLatency, inputLatency);
+                                          ++inputEventCount;
+                                          state = ApplyInput(state, event);
+                                      }
+                                      state = StepDemo(state, tickSeconds);
+
+                                      auto isChanging = state != previousState;
+                                      if (isChanging || tick == 0)
+                                      {
+                                          AnimateDemoEntities(world, scheduler, state.phase - previousState.phase);
+                                          CullDemoEntities(world, scheduler);
+                                          UpdateDemoTransforms(world, transforms, scheduler, transformStatistics);
+                                          PublishTransforms(transforms, transformUploads);
+                                          ExtractDemoScene(world, scenes.GetWriteBuffer());
+                                          scenes.Publish();
+                                      }
+                                      snapshots.Publish(previousState, state, tickTime, tick);
+
+                                      // One more frame after settling, so on-demand pacing lands on the final state
+                                      if (isChanging || wasChanging)
+                                      {
+                                          framePacer.RequestRedraw();
+                                      }
+                                      wasChanging = isChanging;
+                                  })
+                              .Build();
+
+        auto packets = Rendering::RenderPacketQueueBuilder()
+                           .SetInstanceDataCapacity(static_cast<std::uint32_t>(instanceDataPerDraw))
+                           .Build();
+
+        // The frame thread samples the simulation and writes frame N into a packet while the render thread turns
+        // frame N - 1 into Vulkan commands, so command translation overlaps with producing the next frame
+        auto isRendering = std::atomic<bool>(true);
+        auto frameError  = std::exception_ptr();
+        auto frameCount  = std::uint32_t(0);
+        auto beginTime   = std::chrono::steady_clock::now();
+        auto frameLoop   = [&](std::stop_token stopToken)
+        {
+            try
+            {
+                while (!stopToken.stop_requested() && isRendering.load() && simulation.IsRunning()
+                       && (options.frameCount == 0 || frameCount < options.frameCount))
+                {
+                    auto isFrameDue = false;
+                    {
+                        CU_PROFILE_SCOPE("WaitForFrame");
+                        isFrameDue = window ? framePacer.WaitForFrame(*window) : framePacer.WaitForFrame();
+                    }
+
+                    if (!isFrameDue)
+                    {
+                        // Nothing to render, but what the GPU finished in the meantime can still go
+                        static_cast<void>(device.GetDeletionQueue().Collect());
+                        continue;
+                    }
+
+                    auto * packet = packets.BeginWrite(frameCount, stopToken);
+                    if (packet == nullptr)
+                    {
+                        break;
+                    }
+
+                    {
+                        CU_PROFILE_SCOPE("BuildRenderPacket");
+
+                        // Blends the last two ticks, so motion stays smooth whatever the frame to tick rate ratio
+                        auto sample = snapshots.Read(std::chrono::steady_clock::now(), simulation.GetTickPeriod());
+                        auto phase  = std::lerp(sample.previous.phase, sample.current.phase, sample.alpha);
+                        BuildRenderPacket(*packet, phase, scenes.Read(), window ? window->GetWidth() : 0,
+                                          window ? window->GetHeight() : 0);
+                    }
+                    packets.EndWrite();
+
+                    ++frameCount;
+                }
+            }
+            catch (...)
+            {
+                frameError = std::current_exception();
+            }
+
+            packets.Close();
+        };
+
+        auto renderError      = std::exception_ptr();
+        auto renderStatistics = RenderStatistics();
+        auto renderLoop       = [&](std::stop_token stopToken)
         {
-            window.PollEvents();
+            try
+            {
+                while (auto * packet = packets.BeginRead(stopToken))
+                {
+                    if (swapchain && isSwapchainOutdated.load() && window->GetWidth() != 0 && window->GetHeight() != 0)
+                    {
+                        CU_PROFILE_SCOPE("RecreateSwapchain");
+                        isSwapchainOutdated.store(false);
+                        swapchain = CreateSwapchain(suitableDevice, device, *surface, *window, &*swapchain);
+                    }
+
+                    TranslateRenderPacket(*packet, swapchain ? &*swapchain : nullptr, renderStatistics);
+                    packets.EndRead();
+
+                    // On this thread so that uploads and frames never submit to a shared queue at the same time
+                    UploadTransforms(transformUploads, suitableDevice, device, uploadQueue, instanceBuffer,
+                                     transformStatistics);
+
+                    // Post-processing and particles record into this submission once they exist, until then it only
+                    // orders the frame behind the compute queue
+                    {
+                        CU_PROFILE_SCOPE("SubmitCompute");
+                        computeQueue.Submit({}, {}, { Vulkan::TimelineSignal{ &computeSemaphore, ++computeValue } });
+                    }
+                    auto computeWaits = std::vector<Vulkan::TimelineWait>{
+                        { &computeSemaphore, computeValue, Vulkan::PipelineStage::AllGraphics }
+                    };
+
+                    if (swapchain)
+                    {
+                        CU_PROFILE_SCOPE("Present");
+                        if (!swapchain->AcquireNextImage()
+                            || !swapchain->Present(graphicsQueue, presentationQueue, computeWaits, &gpuProfiler))
+                        {
+                            isSwapchainOutdated.store(true);
+                        }
+                    }
+                    if (offscreenTarget && offscreenTarget->AcquireNextImage())
+                    {
+                        CU_PROFILE_SCOPE("Submit");
+                        offscreenTarget->Submit(graphicsQueue, computeWaits, &gpuProfiler);
+                    }
+
+                    // Resources retired by earlier frames go once the GPU has finished with them
+                    static_cast<void>(device.GetDeletionQueue().Collect());
+
+                    CU_PROFILE_FRAME();
+                }
+            }
+            catch (...)
+            {
+                renderError = std::current_exception();
+            }
+
+            isRendering.store(false);
+            packets.Close();
+        };
+
+        if (window)
+        {
+            // The main thread only pumps OS events, so a long frame can neither delay input nor leave the window
+            // unresponsive
+            constexpr auto eventTimeout = std::chrono::milliseconds(100);
+
+            auto renderThread = std::jthread(
+                [&renderLoop](std::stop_token stopToken)
+                {
+                    CU_PROFILE_THREAD("Render");
+                    renderLoop(stopToken);
+
+                    Platform::Window::PostEmptyEvent();
+                });
+            auto frameThread = std::jthread(
+                [&frameLoop, &window](std::stop_token stopToken)
+                {
+                    CU_PROFILE_THREAD("Frame");
+
+                    // Stopping also happens while unwinding, the pacer may be asleep on the window at that point
+                    auto wakeOnStop = std::stop_callback(stopToken,
+                                                         [&window]()
+                                                         {
+                                                             window->NotifyActivity();
+                                                         });
+                    frameLoop(stopToken);
+                });
+
+            while (isRendering.load() && !window->ShouldClose())
+            {
+                window->WaitEvents(eventTimeout);
+            }
+        }
+        else
+        {
+            auto renderThread = std::jthread(
+                [&renderLoop](std::stop_token stopToken)
+                {
+                    CU_PROFILE_THREAD("Render");
+                    renderLoop(stopToken);
+                });
+            frameLoop(std::stop_token());
+
+            // Joined without a stop request, the packets already written are still rendered
+            renderThread.join();
+        }
+
+        if (frameError)
+        {
+            std::rethrow_exception(frameError);
+        }
+        if (renderError)
+        {
+            std::rethrow_exception(renderError);
+        }
+
+        simulation.Stop();
+        simulation.RethrowIfFailed();
+
+        // Buffers retired against the upload queue have to go before it does
+        uploadQueue.Wait(uploadQueue.Flush());
+        computeSemaphore.Wait(computeValue);
+        static_cast<void>(device.GetDeletionQueue().Collect());
+
+        if (offscreenTarget)
+        {
+            offscreenTarget->WaitIdle();
+        }
+
+        auto elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - beginTime).count();
+        std::cout << "Frames: " << frameCount << " in " << elapsedSeconds << " s, "
+                  << (elapsedSeconds > 0.0 ? frameCount / elapsedSeconds : 0.0) << " frames per second" << std::endl;
+
+        std::cout << "Simulation: " << simulation.GetTickCount() << " ticks at " << tickRate << " per second, "
+                  << simulation.GetSkippedTickCount() << " skipped" << std::endl;
+
+        std::cout << "Scene: " << world.GetEntityCount() << " entities in " << world.GetArchetypeCount()
+                  << " archetypes, " << world.GetChunkCount() << " chunks" << std::endl;
+
+        std::cout << "Transforms: " << transforms.GetNodeCount() << " nodes on " << transforms.GetLevelCount()
+                  << " levels, " << transformStatistics.updatedCount << " world matrices recomputed in "
+                  << transformStatistics.updateCount << " updates, " << transformStatistics.uploadedCount
+                  << " uploaded in " << transformStatistics.uploadRangeCount << " ranges" << std::endl;
+
+        std::cout << "Render packets: " << renderStatistics.packetCount << " with " << renderStatistics.drawCount
+                  << " draws in " << renderStatistics.batchCount << " batches, " << renderStatistics.droppedDrawCount
+                  << " draws dropped, " << packets.GetWriteWaitCount() << " frame thread waits, "
+                  << packets.GetReadWaitCount() << " render thread waits" << std::endl;
+
+        if (window)
+        {
+            std::cout << "Input: " << inputEventCount << " events, "
+                      << std::chrono::duration<double, std::milli>(maxInputLatency).count()
+                      << " ms longest wait, " << window->GetDroppedInputEventCount() << " dropped" << std::endl;
+        }
+
+#if defined(CU_ENABLE_PROFILING)
+        Profiling::FlushCapture();
+#endif
+
+        auto pipelineCacheStatistics = device.GetPipelineCache().GetStatistics();
+        std::cout << "Pipeline cache: " << pipelineCacheStatistics.loadedSize << " bytes loaded, "
+                  << pipelineCacheStatistics.hits << " hits, " << pipelineCacheStatistics.misses << " misses"
+                  << std::endl;
+
+        for (auto && heapStatistics : device.GetMemoryAllocator().GetStatistics())
+        {
+            std::cout << "Memory heap: " << heapStatistics.usedBytes << " of " << heapStatistics.blockBytes
+                      << " bytes used in " << heapStatistics.blockCount << " blocks" << std::endl;
+        }
+
+        auto hostStatistics = Vulkan::HostAllocator::GetStatistics();
+        for (auto && scopeStatistics : hostStatistics.scopes)
+        {
+            if (scopeStatistics.allocationCount == 0)
+            {
+                continue;
+            }
+
+            std::cout << "Host memory " << GetScopeName(scopeStatistics.scope) << ": " << scopeStatistics.currentBytes
+                      << " bytes live, " << scopeStatistics.peakBytes << " bytes peak over "
+                      << scopeStatistics.allocationCount << " allocations" << std::endl;
+        }
+
+        std::cout << "Host allocations: " << hostStatistics.pooledAllocationCount << " pooled, "
+                  << hostStatistics.systemAllocationCount << " from the system, " << hostStatistics.poolReservedBytes
+                  << " bytes reserved by pools" << std::endl;
+
+        for (auto && scopeStatistics : gpuProfiler.GetStatistics())
+        {
+            std::cout << "GPU scope " << scopeStatistics.name << ": " << scopeStatistics.minMilliseconds << " min, "
+                      << scopeStatistics.averageMilliseconds << " avg, " << scopeStatistics.p99Milliseconds
+                      << " p99 ms over " << scopeStatistics.sampleCount << " frames" << std::endl;
         }
     }
     catch (const std::exception & e)
@@ -87,6 +604,8 @@ int Application::Run() noexcept
 
 static Platform::System CreateSystem()
 {
+    CU_PROFILE_SCOPE("CreateSystem");
+
     return Platform::SystemBuilder().Build();
 }
 
@@ -96,69 +615,365 @@ static Platform::Window CreateWindow(Platform::System & system)
     constexpr auto height = 600;
     constexpr auto name   = "CuEngine";
 
-    return Platform::WindowBuilder().SetSystem(system).SetWidth(width).SetHeight(height).SetTitle(name).Build();
+    return Platform::WindowBuilder()
+        .SetSystem(system)
+        .SetWidth(width)
+        .SetHeight(height)
+        .SetTitle(name)
+        .SetResizable(true)
+        .Build();
+}
+
+static Platform::FramePacer CreateFramePacer(const ApplicationOptions & options)
+{
+    // Keeps a window in the background from competing with the one being worked in
+    constexpr auto backgroundFrameRate = 10.0;
+    constexpr auto fixedFrameRate      = 60.0;
+
+    auto targetFrameRate = options.targetFrameRate;
+    if (options.framePacing == Platform::FramePacingMode::FixedRate && targetFrameRate <= 0.0)
+    {
+        targetFrameRate = fixedFrameRate;
+    }
+
+    return Platform::FramePacerBuilder()
+        .SetMode(options.framePacing)
+        .SetTargetFrameRate(targetFrameRate)
+        .SetBackgroundFrameRate(backgroundFrameRate)
+        .Build();
+}
+
+static DemoState ApplyInput(DemoState state, const Platform::InputEvent & event) noexcept
+{
+    constexpr auto pressAction  = 1; // GLFW_PRESS
+    constexpr auto inputImpulse = 0.5f;
+
+    if ((event.type == Platform::InputEventType::Key || event.type == Platform::InputEventType::MouseButton)
+        && event.action == pressAction)
+    {
+        state.velocity += inputImpulse;
+    }
+    else if (event.type == Platform::InputEventType::Scroll)
+    {
+        state.velocity += inputImpulse * static_cast<float>(event.y);
+    }
+
+    return state;
+}
+
+static DemoState StepDemo(DemoState state, float tickSeconds) noexcept
+{
+    constexpr auto damping      = 2.0f;
+    constexpr auto restVelocity = 0.001f;
+
+    state.phase    += state.velocity * tickSeconds;
+    state.velocity -= state.velocity * std::min(damping * tickSeconds, 1.0f);
+    if (std::abs(state.velocity) < restVelocity)
+    {
+        state.velocity = 0.0f;
+    }
+
+    return state;
 }
 
-static Vulkan::Instance CreateInstance()
+static void CreateDemoEntities(Scene::World & world, Scene::TransformHierarchy & transforms,
+                               std::uint32_t entityCount)
 {
-    return Vulkan::InstanceBuilder().Build();
+    constexpr auto maxSpeed = 0.5f;
+
+    // One group node per material, which the entities of that material hang off
+    auto groups = std::array<Scene::TransformNode, demoMaterialCount>();
+    for (auto && group : groups)
+    {
+        group = transforms.CreateNode();
+    }
+
+    auto local  = Scene::LocalTransform();
+    local.scale = { demoInstanceScale, demoInstanceScale, 1.0f };
+
+    auto random   = std::minstd_rand();
+    auto position = std::uniform_real_distribution<float>(-1.0f, 1.0f);
+    auto speed    = std::uniform_real_distribution<float>(-maxSpeed, maxSpeed);
+    for (auto index = 0u; index < entityCount; ++index)
+    {
+        auto material = static_cast<std::uint16_t>(index % demoMaterialCount);
+        auto node     = transforms.CreateNode(groups[material], local);
+        static_cast<void>(world.CreateEntity(DemoPosition{ .x = position(random), .y = position(random) },
+                                             DemoVelocity{ .x = speed(random), .y = speed(random) },
+                                             DemoMaterial{ .index = material }, DemoVisibility(),
+                                             DemoTransform{ .node = node }));
+    }
+}
+
+static void AnimateDemoEntities(Scene::World & world, Jobs::Scheduler & scheduler, float seconds)
+{
+    CU_PROFILE_SCOPE("AnimateDemoEntities");
+
+    // Wraps around the [-1, 1] square
+    auto wrap = [](float value)
+    {
+        return value - 2.0f * std::floor((value + 1.0f) * 0.5f);
+    };
+
+    world.ParallelForEach<DemoPosition, DemoVelocity>(
+        scheduler,
+        [seconds, &wrap](Scene::Entity, DemoPosition & position, const DemoVelocity & velocity)
+        {
+            position.x = wrap(position.x + velocity.x * seconds);
+            position.y = wrap(position.y + velocity.y * seconds);
+        });
+}
+
+static void CullDemoEntities(Scene::World & world, Jobs::Scheduler & scheduler)
+{
+    CU_PROFILE_SCOPE("CullDemoEntities");
+
+    constexpr auto viewExtent = 0.9f;
+
+    world.ParallelForEach<DemoPosition, DemoVisibility>(
+        scheduler,
+        [](Scene::Entity, const DemoPosition & position, DemoVisibility & visibility)
+        {
+            visibility.isVisible = std::abs(position.x) <= viewExtent && std::abs(position.y) <= viewExtent;
+        });
+}
+
+static void ExtractDemoScene(Scene::World & world, DemoScene & scene)
+{
+    CU_PROFILE_SCOPE("ExtractDemoScene");
+
+    // Clearing keeps the capacity, so extraction stops allocating once the lists have grown to the scene
+    for (auto && instances : scene.instances)
+    {
+        instances.clear();
+    }
+
+    world.ForEachChunk<DemoPosition, DemoMaterial, DemoVisibility>(
+        [&scene](const Scene::ChunkView & chunk)
+        {
+            auto positions    = chunk.GetComponents<DemoPosition>();
+            auto materials    = chunk.GetComponents<DemoMaterial>();
+            auto visibilities = chunk.GetComponents<DemoVisibility>();
+            for (auto row = 0u; row < chunk.GetEntityCount(); ++row)
+            {
+                if (visibilities[row].isVisible)
+                {
+                    scene.instances[materials[row].index].push_back(
+                        { positions[row].x, positions[row].y, 0.0f, demoInstanceScale });
+                }
+            }
+        });
+}
+
+static void UpdateDemoTransforms(Scene::World & world, Scene::TransformHierarchy & transforms,
+                                 Jobs::Scheduler & scheduler, TransformStatistics & statistics)
+{
+    CU_PROFILE_SCOPE("UpdateDemoTransforms");
+
+    // Setting a local transform is not thread-safe, but it is cheap next to the matrix products, which do run in
+    // parallel. Entities that did not move leave their subtree alone
+    world.ForEach<DemoPosition, DemoTransform>(
+        [&transforms](Scene::Entity, const DemoPosition & position, const DemoTransform & transform)
+        {
+            const auto * local = transforms.GetLocalTransform(transform.node);
+            if (local != nullptr && (local->translation.x != position.x || local->translation.y != position.y))
+            {
+                auto moved        = *local;
+                moved.translation = { position.x, position.y, 0.0f };
+                transforms.SetLocalTransform(transform.node, moved);
+            }
+        });
+
+    transforms.Update(scheduler);
+    ++statistics.updateCount;
+    statistics.updatedCount += transforms.GetUpdatedCount();
+}
+
+static void PublishTransforms(Scene::TransformHierarchy & transforms, TransformUploads & uploads)
+{
+    CU_PROFILE_SCOPE("PublishTransforms");
+
+    auto matrices = transforms.GetWorldMatrices();
+    auto ranges   = transforms.GetChangedRanges();
+
+    {
+        auto lock = std::scoped_lock(uploads.mutex);
+
+        // A layout change reports every matrix as changed, so a resize never leaves stale matrices behind
+        uploads.publishedMatrices.resize(matrices.size());
+        for (auto range : ranges)
+        {
+            std::ranges::copy(matrices.subspan(range.first, range.count),
+                              uploads.publishedMatrices.begin() + range.first);
+        }
+        uploads.publishedRanges.insert(uploads.publishedRanges.end(), ranges.begin(), ranges.end());
+    }
+
+    transforms.ClearChangedRanges();
+}
+
+static void UploadTransforms(TransformUploads & uploads, Vulkan::SuitableDevice & suitableDevice,
+                             Vulkan::Device & device, Vulkan::UploadQueue & uploadQueue,
+                             std::optional<Vulkan::Buffer> & instanceBuffer, TransformStatistics & statistics)
+{
+    CU_PROFILE_SCOPE("UploadTransforms");
+
+    {
+        auto lock = std::scoped_lock(uploads.mutex);
+        if (uploads.publishedRanges.empty())
+        {
+            return;
+        }
+
+        uploads.matrices.resize(uploads.publishedMatrices.size());
+        for (auto range : uploads.publishedRanges)
+        {
+            std::ranges::copy(std::span(uploads.publishedMatrices).subspan(range.first, range.count),
+                              uploads.matrices.begin() + range.first);
+        }
+        std::swap(uploads.ranges, uploads.publishedRanges);
+        uploads.publishedRanges.clear();
+    }
+
+    auto & matrices = uploads.matrices;
+    auto   size     = static_cast<std::uint64_t>(matrices.size() * sizeof(Math::Mat4));
+    if (size == 0)
+    {
+        return;
+    }
+
+    // Grows by half again to keep regrowth rare, the old buffer goes once the copies into it have finished, and the
+    // new one starts out with every matrix
+    auto isNewBuffer = !instanceBuffer || instanceBuffer->GetSize() < size;
+    if (isNewBuffer)
+    {
+        if (instanceBuffer)
+        {
+            auto value = uploadQueue.Flush();
+            device.GetDeletionQueue().Retire(std::move(*instanceBuffer), uploadQueue.GetSemaphore(), value);
+        }
+        instanceBuffer = CreateInstanceBuffer(suitableDevice, device, size + size / 2);
+    }
+
+    auto upload = [&](std::size_t first, std::size_t count)
+    {
+        static_cast<void>(uploadQueue.Upload(*instanceBuffer, first * sizeof(Math::Mat4), &matrices[first],
+                                             count * sizeof(Math::Mat4)));
+        statistics.uploadedCount += count;
+        ++statistics.uploadRangeCount;
+    };
+
+    if (isNewBuffer)
+    {
+        upload(0, matrices.size());
+    }
+    else
+    {
+        // Ranges from several ticks may overlap, copying a matrix twice is cheaper than merging them
+        for (auto range : uploads.ranges)
+        {
+            upload(range.first, range.count);
+        }
+    }
+    uploads.ranges.clear();
+
+    static_cast<void>(uploadQueue.Flush());
 }
 
-static SuitableDevice FindSuitableDevice(Vulkan::Instance & instance, Vulkan::Surface & surface)
+static void BuildRenderPacket(Rendering::RenderPacket & packet, float phase, const DemoScene & scene,
+                              std::uint32_t width, std::uint32_t height) noexcept
 {
-    auto physicalDevices = Vulkan::PhysicalDevice::Enumerate(instance);
-    auto suitableDeviceIt =
-        std::ranges::find_if(physicalDevices,
-                             [&surface](auto & device)
-                             {
-                                 return std::ranges::any_of(Vulkan::QueueFamily::Enumerate(device),
-                                                            [](const auto & queueFamily)
-                                                            {
-                                                                return queueFamily.HasGraphicsSupport();
-                                                            })
-                                        && std::ranges::any_of(Vulkan::QueueFamily::Enumerate(device),
-                                                               [&surface](const auto & queueFamily)
-                                                               {
-                                                                   return queueFamily.HasSurfaceSupport(surface);
-                                                               });
-                             });
+    constexpr auto fullTurn = 2.0f * std::numbers::pi_v<float>;
+
+    auto   angle    = fullTurn * phase;
+    auto & view     = packet.GetView();
+    view.clearColor = { 0.5f + 0.5f * std::sin(angle), 0.5f + 0.5f * std::cos(angle), 0.5f, 1.0f };
+    view.width      = width;
+    view.height     = height;
 
-    if (std::end(physicalDevices) == suitableDeviceIt)
+    for (auto material = 0u; material < demoMaterialCount; ++material)
     {
-        throw std::runtime_error("Failed to find a suitable Vulkan device");
+        auto & instances = scene.instances[material];
+        if (instances.empty())
+        {
+            continue;
+        }
+
+        auto key = Rendering::MakeDrawKey(0, 0, static_cast<std::uint16_t>(material), 0);
+        static_cast<void>(packet.AddDraw(key, instances.data(), sizeof(instances[0]),
+                                         static_cast<std::uint32_t>(instances.size())));
     }
-    auto suitableDevice = *suitableDeviceIt;
 
-    auto queueFamilies             = Vulkan::QueueFamily::Enumerate(suitableDevice);
-    auto graphicsQueueFamilyIt     = std::ranges::find_if(queueFamilies,
-                                                          [](const auto & queueFamily)
-                                                          {
-                                                              return queueFamily.HasGraphicsSupport();
-                                                          });
-    auto presentationQueueFamilyIt = std::ranges::find_if(queueFamilies,
-                                                          [&surface](const auto & queueFamily)
-                                                          {
-                                                              return queueFamily.HasSurfaceSupport(surface);
-                                                          });
+    packet.SortDraws();
+}
+
+static void TranslateRenderPacket(const Rendering::RenderPacket & packet, Vulkan::Swapchain * swapchain,
+                                  RenderStatistics & statistics) noexcept
+{
+    CU_PROFILE_SCOPE("TranslateRenderPacket");
 
-    if (std::end(queueFamilies) == graphicsQueueFamilyIt || std::end(queueFamilies) == presentationQueueFamilyIt)
+    // Everything above the depth bits is pipeline state
+    constexpr auto stateShift = 24u;
+
+    const auto & view = packet.GetView();
+    if (swapchain != nullptr)
+    {
+        swapchain->SetClearColor(view.clearColor[0], view.clearColor[1], view.clearColor[2], view.clearColor[3]);
+    }
+
+    // Draws are sorted, so consecutive ones with the same state become one instanced batch. Without pipelines yet the
+    // batches are only counted, this is where they will be bound and drawn
+    auto draws = packet.GetDraws();
+    for (auto drawIt = draws.begin(); drawIt != draws.end();)
     {
-        throw std::runtime_error("Failed to find a suitable Vulkan queue families");
+        auto state   = drawIt->key >> stateShift;
+        auto batchIt = std::find_if(drawIt, draws.end(),
+                                    [state](const Rendering::DrawItem & draw)
+                                    {
+                                        return draw.key >> stateShift != state;
+                                    });
+        ++statistics.batchCount;
+        drawIt = batchIt;
     }
-    auto graphicsQueueFamily     = *graphicsQueueFamilyIt;
-    auto presentationQueueFamily = *presentationQueueFamilyIt;
 
-    return { .physicalDevice          = suitableDevice,
-             .graphicsQueueFamily     = graphicsQueueFamily,
-             .presentationQueueFamily = presentationQueueFamily };
+    ++statistics.packetCount;
+    statistics.drawCount        += draws.size();
+    statistics.droppedDrawCount += packet.GetDroppedDrawCount();
+}
+
+static Vulkan::Instance CreateInstance(bool isHeadless)
+{
+    CU_PROFILE_SCOPE("CreateInstance");
+
+    return Vulkan::InstanceBuilder().SetHeadless(isHeadless).Build();
 }
 
-static Vulkan::Device CreateDevice(SuitableDevice & suitableDevice)
+static Vulkan::SuitableDevice FindSuitableDevice(Vulkan::Instance & instance, Vulkan::Surface * surface,
+                                                 std::string_view preferredDevice)
 {
-    auto builder = Vulkan::DeviceBuilder().SetPhysicalDevice(suitableDevice.physicalDevice);
+    CU_PROFILE_SCOPE("FindSuitableDevice");
 
-    for (auto && queueFamily :
-         std::set<Vulkan::QueueFamily>{ suitableDevice.graphicsQueueFamily, suitableDevice.presentationQueueFamily })
+    auto suitableDevice = Vulkan::SelectDevice(instance, surface, preferredDevice);
+    std::cout << "Device: " << suitableDevice.physicalDevice.GetName() << std::endl;
+
+    return suitableDevice;
+}
+
+static Vulkan::Device CreateDevice(Vulkan::SuitableDevice & suitableDevice, bool isHeadless)
+{
+    CU_PROFILE_SCOPE("CreateDevice");
+
+    constexpr auto pipelineCachePath = "CuEngine.pipelinecache";
+
+    auto builder = Vulkan::DeviceBuilder()
+                       .SetPhysicalDevice(suitableDevice.physicalDevice)
+                       .SetHeadless(isHeadless)
+                       .SetPipelineCachePath(pipelineCachePath);
+
+    for (auto && queueFamily : std::set<Vulkan::QueueFamily>{ suitableDevice.graphicsQueueFamily,
+                                                              suitableDevice.presentationQueueFamily,
+                                                              suitableDevice.transferQueueFamily,
+                                                              suitableDevice.computeQueueFamily })
     {
         builder.AddQueues(queueFamily, std::vector<float>{ 1.0 });
     }
@@ -176,4 +991,93 @@ static Vulkan::Surface CreateSurface(Vulkan::Instance & instance, Platform::Wind
     return Vulkan::SurfaceBuilder().SetInstance(instance).SetWindow(window).Build();
 };
 
+static Vulkan::Swapchain CreateSwapchain(Vulkan::SuitableDevice & suitableDevice, Vulkan::Device & device,
+                                         Vulkan::Surface & surface, Platform::Window & window,
+                                         Vulkan::Swapchain * oldSwapchain)
+{
+    constexpr auto framesInFlight = 2;
+
+    auto swapchainBuilder = Vulkan::SwapchainBuilder();
+    swapchainBuilder.SetPhysicalDevice(suitableDevice.physicalDevice)
+        .SetDevice(device)
+        .SetSurface(surface)
+        .SetWindow(window)
+        .SetQueueFamilies(suitableDevice.graphicsQueueFamily, suitableDevice.presentationQueueFamily)
+        .SetPresentModes({ Vulkan::PresentMode::Mailbox, Vulkan::PresentMode::Immediate,
+                           Vulkan::PresentMode::FifoRelaxed })
+        .SetFramesInFlight(framesInFlight);
+
+    if (oldSwapchain != nullptr)
+    {
+        swapchainBuilder.SetOldSwapchain(*oldSwapchain);
+    }
+
+    return swapchainBuilder.Build();
+}
+
+static Vulkan::OffscreenTarget CreateOffscreenTarget(Vulkan::SuitableDevice & suitableDevice, Vulkan::Device & device)
+{
+    constexpr auto width          = 800;
+    constexpr auto height         = 600;
+    constexpr auto framesInFlight = 2;
+
+    return Vulkan::OffscreenTargetBuilder()
+        .SetDevice(device)
+        .SetQueueFamily(suitableDevice.graphicsQueueFamily)
+        .SetFormat(Vulkan::Format::R8G8B8A8Unorm)
+        .SetExtent(width, height)
+        .SetUsage(Vulkan::ImageUsage::ColorAttachment)
+        .SetFramesInFlight(framesInFlight)
+        .Build();
+}
+
+static Vulkan::UploadQueue CreateUploadQueue(Vulkan::Device & device, Vulkan::Queue & transferQueue,
+                                             Vulkan::QueueFamily & transferQueueFamily)
+{
+    return Vulkan::UploadQueueBuilder().SetDevice(device).SetQueue(transferQueue, transferQueueFamily).Build();
+}
+
+// Written by the transfer queue and read by the graphics queue
+static Vulkan::Buffer CreateInstanceBuffer(Vulkan::SuitableDevice & suitableDevice, Vulkan::Device & device,
+                                           std::uint64_t size)
+{
+    return Vulkan::BufferBuilder()
+        .SetDevice(device)
+        .SetSize(size)
+        .SetUsage(Vulkan::BufferUsage::Storage | Vulkan::BufferUsage::TransferDestination)
+        .SetMemoryUsage(Vulkan::MemoryUsage::GpuOnly)
+        .SetQueueFamilies({ suitableDevice.graphicsQueueFamily, suitableDevice.transferQueueFamily })
+        .Build();
+}
+
+static Vulkan::GpuProfiler CreateGpuProfiler(Vulkan::SuitableDevice & suitableDevice, Vulkan::Device & device,
+                                             std::uint32_t framesInFlight)
+{
+    return Vulkan::GpuProfilerBuilder()
+        .SetPhysicalDevice(suitableDevice.physicalDevice)
+        .SetDevice(device)
+        .SetQueueFamily(suitableDevice.graphicsQueueFamily)
+        .SetFramesInFlight(framesInFlight)
+        .Build();
+}
+
+static std::string_view GetScopeName(Vulkan::HostAllocationScope scope) noexcept
+{
+    switch (scope)
+    {
+        case Vulkan::HostAllocationScope::Command:
+            return "command";
+        case Vulkan::HostAllocationScope::Object:
+            return "object";
+        case Vulkan::HostAllocationScope::Cache:
+            return "cache";
+        case Vulkan::HostAllocationScope::Device:
+            return "device";
+        case Vulkan::HostAllocationScope::Instance:
+            return "instance";
+    }
+
+    return "unknown";
+}
+
 } // namespace CuEngine
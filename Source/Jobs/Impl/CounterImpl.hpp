@@ -0,0 +1,76 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Jobs/Counter.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace CuEngine::Jobs::Impl
+{
+struct CounterState;
+
+struct Job
+{
+    std::shared_ptr<const std::function<void(std::uint32_t)>> function;
+    std::uint32_t                                             index;
+    std::shared_ptr<CounterState>                             counter;
+};
+
+struct CounterState
+{
+    explicit CounterState(std::uint32_t count) noexcept : pending(count), mutex(), continuations(), exception()
+    {}
+
+    std::atomic<std::uint32_t> pending;
+    std::mutex                 mutex;
+    std::vector<Job *>         continuations;
+    std::exception_ptr         exception;
+};
+
+class Counter
+{
+public:
+    explicit Counter(std::shared_ptr<CounterState> state) noexcept : m_State(std::move(state))
+    {}
+
+    [[nodiscard]] bool IsDone() const noexcept
+    {
+        return m_State->pending.load(std::memory_order_acquire) == 0;
+    }
+
+    [[nodiscard]] const std::shared_ptr<CounterState> & GetState() const noexcept
+    {
+        return m_State;
+    }
+
+private:
+    std::shared_ptr<CounterState> m_State;
+};
+} // namespace CuEngine::Jobs::Impl
@@ -0,0 +1,80 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "SchedulerImpl.hpp"
+
+#include <CuEngine/Jobs/SchedulerBuilder.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+
+namespace CuEngine::Jobs::Impl
+{
+class SchedulerBuilder
+{
+public:
+    explicit SchedulerBuilder() noexcept
+        : m_WorkerCount(std::max(std::thread::hardware_concurrency(), 1u)), m_IsPinned(false)
+    {}
+
+    SchedulerBuilder(const SchedulerBuilder & other) = default;
+
+    SchedulerBuilder(SchedulerBuilder && other) noexcept = default;
+
+    SchedulerBuilder & operator=(const SchedulerBuilder & other) = default;
+
+    SchedulerBuilder & operator=(SchedulerBuilder && other) noexcept = default;
+
+    ~SchedulerBuilder() noexcept = default;
+
+    SchedulerBuilder & SetWorkerCount(std::uint32_t workerCount) noexcept
+    {
+        m_WorkerCount = workerCount;
+
+        return *this;
+    }
+
+    SchedulerBuilder & SetPinWorkers(bool isPinned) noexcept
+    {
+        m_IsPinned = isPinned;
+
+        return *this;
+    }
+
+    [[nodiscard]] Scheduler Build() const
+    {
+        if (m_WorkerCount == 0)
+        {
+            throw std::runtime_error("Failed to create a job scheduler: at least one worker is required");
+        }
+
+        return Scheduler(m_WorkerCount, m_IsPinned);
+    }
+
+private:
+    std::uint32_t m_WorkerCount;
+    bool          m_IsPinned;
+};
+} // namespace CuEngine::Jobs::Impl
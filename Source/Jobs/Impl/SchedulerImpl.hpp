@@ -0,0 +1,375 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "CounterImpl.hpp"
+#include "WorkStealingDequeImpl.hpp"
+
+#include <CuEngine/Jobs/Scheduler.hpp>
+#include <CuEngine/Profiling/Profiler.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace CuEngine::Jobs::Impl
+{
+class Scheduler
+{
+    static constexpr auto noWorker  = ~0u;
+    static constexpr auto spinCount = 64u;
+
+    struct State
+    {
+        std::vector<std::unique_ptr<WorkStealingDeque<Job>>> deques;
+        std::mutex                                           injectionMutex;
+        std::deque<Job *>                                    injectionQueue;
+        std::atomic<std::size_t>                             injectionSize;
+        std::atomic<std::uint32_t>                           epoch;
+        std::atomic<std::uint32_t>                           sleepingCount;
+        std::atomic<bool>                                    isRunning;
+        std::vector<std::jthread>                            workers;
+    };
+
+    struct ThreadContext
+    {
+        const State * state;
+        std::uint32_t workerIndex;
+        std::uint32_t random;
+    };
+
+public:
+    explicit Scheduler(std::uint32_t workerCount, bool isPinned) : m_State(std::make_unique<State>())
+    {
+        m_State->isRunning.store(true, std::memory_order_relaxed);
+        m_State->deques.reserve(workerCount);
+        for (auto worker = 0u; worker < workerCount; ++worker)
+        {
+            m_State->deques.push_back(std::make_unique<WorkStealingDeque<Job>>());
+        }
+
+        auto hardwareThreadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+        m_State->workers.reserve(workerCount);
+        for (auto worker = 0u; worker < workerCount; ++worker)
+        {
+            m_State->workers.emplace_back(&Scheduler::RunWorker, m_State.get(), worker);
+            if (isPinned)
+            {
+                PinToCore(m_State->workers.back(), worker % hardwareThreadCount);
+            }
+        }
+    }
+
+    Scheduler(const Scheduler & other) = delete;
+
+    Scheduler(Scheduler && other) noexcept = default;
+
+    Scheduler & operator=(const Scheduler & other) = delete;
+
+    Scheduler & operator=(Scheduler && other) noexcept
+    {
+        if (this != &other)
+        {
+            std::swap(m_State, other.m_State);
+        }
+
+        return *this;
+    }
+
+    ~Scheduler() noexcept
+    {
+        if (!m_State)
+        {
+            return;
+        }
+
+        m_State->isRunning.store(false, std::memory_order_seq_cst);
+        m_State->epoch.fetch_add(1, std::memory_order_seq_cst);
+        m_State->epoch.notify_all();
+        m_State->workers.clear();
+
+        // Jobs that never ran are dropped, their counters never become done
+        for (auto && deque : m_State->deques)
+        {
+            while (auto job = deque->Steal())
+            {
+                delete job;
+            }
+        }
+        for (auto job : m_State->injectionQueue)
+        {
+            delete job;
+        }
+    }
+
+    [[nodiscard]] std::shared_ptr<CounterState> Schedule(std::uint32_t count,
+                                                         std::function<void(std::uint32_t)> function)
+    {
+        auto counter        = std::make_shared<CounterState>(count);
+        auto sharedFunction = std::make_shared<const std::function<void(std::uint32_t)>>(std::move(function));
+
+        for (auto index = 0u; index < count; ++index)
+        {
+            Push(*m_State, new Job{ .function = sharedFunction, .index = index, .counter = counter });
+        }
+
+        return counter;
+    }
+
+    [[nodiscard]] std::shared_ptr<CounterState> ScheduleAfter(const std::shared_ptr<CounterState> & dependency,
+                                                              std::function<void()> function)
+    {
+        auto counter = std::make_shared<CounterState>(1);
+        auto job     = new Job{ .function = std::make_shared<const std::function<void(std::uint32_t)>>(
+                                    [function = std::move(function)](std::uint32_t)
+                                    {
+                                        function();
+                                    }),
+                                .index    = 0,
+                                .counter  = counter };
+
+        {
+            auto lock = std::scoped_lock(dependency->mutex);
+            if (dependency->pending.load(std::memory_order_acquire) != 0)
+            {
+                dependency->continuations.push_back(job);
+                return counter;
+            }
+        }
+
+        Push(*m_State, job);
+
+        return counter;
+    }
+
+    void Wait(const std::shared_ptr<CounterState> & counter)
+    {
+        auto & context     = GetThreadContext();
+        auto   workerIndex = context.state == m_State.get() ? context.workerIndex : noWorker;
+
+        while (counter->pending.load(std::memory_order_acquire) != 0)
+        {
+            if (auto job = FindJob(*m_State, workerIndex))
+            {
+                Execute(*m_State, job);
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        auto lock = std::scoped_lock(counter->mutex);
+        if (counter->exception)
+        {
+            std::rethrow_exception(counter->exception);
+        }
+    }
+
+    [[nodiscard]] std::uint32_t GetWorkerCount() const noexcept
+    {
+        return static_cast<std::uint32_t>(m_State->deques.size());
+    }
+
+private:
+    [[nodiscard]] static ThreadContext & GetThreadContext() noexcept
+    {
+        thread_local auto context = ThreadContext{ .state = nullptr, .workerIndex = noWorker, .random = 0 };
+
+        return context;
+    }
+
+    static void PinToCore([[maybe_unused]] std::jthread & thread, [[maybe_unused]] std::uint32_t core) noexcept
+    {
+#if defined(_WIN32)
+        SetThreadAffinityMask(thread.native_handle(), DWORD_PTR(1) << (core % 64));
+#elif defined(__linux__)
+        auto cpuSet = cpu_set_t();
+        CPU_ZERO(&cpuSet);
+        CPU_SET(core, &cpuSet);
+        pthread_setaffinity_np(thread.native_handle(), sizeof(cpuSet), &cpuSet);
+#endif
+    }
+
+    static void RunWorker(State * state, std::uint32_t workerIndex)
+    {
+        GetThreadContext() = ThreadContext{ .state = state, .workerIndex = workerIndex, .random = workerIndex + 1 };
+        CU_PROFILE_THREAD("Job worker " + std::to_string(workerIndex));
+
+        while (state->isRunning.load(std::memory_order_acquire))
+        {
+            auto job = FindJob(*state, workerIndex);
+            for (auto spin = 0u; job == nullptr && spin < spinCount; ++spin)
+            {
+                std::this_thread::yield();
+                job = FindJob(*state, workerIndex);
+            }
+
+            if (job != nullptr)
+            {
+                Execute(*state, job);
+                continue;
+            }
+
+            // Pushers bump the epoch after publishing a job, so a job published after the last search wakes us up
+            auto epoch = state->epoch.load(std::memory_order_seq_cst);
+            state->sleepingCount.fetch_add(1, std::memory_order_seq_cst);
+            if (auto lateJob = FindJob(*state, workerIndex))
+            {
+                state->sleepingCount.fetch_sub(1, std::memory_order_seq_cst);
+                Execute(*state, lateJob);
+                continue;
+            }
+            if (state->isRunning.load(std::memory_order_seq_cst))
+            {
+                state->epoch.wait(epoch, std::memory_order_seq_cst);
+            }
+            state->sleepingCount.fetch_sub(1, std::memory_order_seq_cst);
+        }
+    }
+
+    static void Push(State & state, Job * job)
+    {
+        auto & context = GetThreadContext();
+        if (context.state == &state)
+        {
+            state.deques[context.workerIndex]->Push(job);
+        }
+        else
+        {
+            auto lock = std::scoped_lock(state.injectionMutex);
+            state.injectionQueue.push_back(job);
+            state.injectionSize.fetch_add(1, std::memory_order_release);
+        }
+
+        state.epoch.fetch_add(1, std::memory_order_seq_cst);
+        if (state.sleepingCount.load(std::memory_order_seq_cst) != 0)
+        {
+            state.epoch.notify_one();
+        }
+    }
+
+    [[nodiscard]] static Job * FindJob(State & state, std::uint32_t workerIndex) noexcept
+    {
+        if (workerIndex != noWorker)
+        {
+            if (auto job = state.deques[workerIndex]->Pop())
+            {
+                return job;
+            }
+        }
+
+        if (state.injectionSize.load(std::memory_order_acquire) != 0)
+        {
+            auto lock = std::scoped_lock(state.injectionMutex);
+            if (!state.injectionQueue.empty())
+            {
+                auto job = state.injectionQueue.front();
+                state.injectionQueue.pop_front();
+                state.injectionSize.fetch_sub(1, std::memory_order_relaxed);
+
+                return job;
+            }
+        }
+
+        // Start at a random victim so thieves do not all pile onto worker zero
+        auto & random = GetThreadContext().random;
+        random        = random * 1664525u + 1013904223u;
+
+        auto dequeCount = static_cast<std::uint32_t>(state.deques.size());
+        for (auto offset = 0u; offset < dequeCount; ++offset)
+        {
+            auto victim = (random + offset) % dequeCount;
+            if (victim == workerIndex)
+            {
+                continue;
+            }
+
+            if (auto job = state.deques[victim]->Steal())
+            {
+                return job;
+            }
+        }
+
+        return nullptr;
+    }
+
+    static void Execute(State & state, Job * job)
+    {
+        CU_PROFILE_SCOPE("Job");
+
+        auto counter = std::move(job->counter);
+        try
+        {
+            (*job->function)(job->index);
+        }
+        catch (...)
+        {
+            auto lock = std::scoped_lock(counter->mutex);
+            if (!counter->exception)
+            {
+                counter->exception = std::current_exception();
+            }
+        }
+        delete job;
+
+        if (counter->pending.fetch_sub(1, std::memory_order_acq_rel) != 1)
+        {
+            return;
+        }
+
+        auto continuations = std::vector<Job *>();
+        {
+            auto lock = std::scoped_lock(counter->mutex);
+            continuations.swap(counter->continuations);
+        }
+
+        for (auto continuation : continuations)
+        {
+            Push(state, continuation);
+        }
+    }
+
+private:
+    std::unique_ptr<State> m_State;
+};
+} // namespace CuEngine::Jobs::Impl
@@ -0,0 +1,175 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace CuEngine::Jobs::Impl
+{
+// Chase-Lev deque: the owner pushes and pops at the bottom, thieves take from the top
+template <typename T>
+class WorkStealingDeque
+{
+    class Ring
+    {
+    public:
+        explicit Ring(std::int64_t capacity)
+            : m_Mask(capacity - 1), m_Items(std::make_unique<std::atomic<T *>[]>(static_cast<std::size_t>(capacity)))
+        {}
+
+        [[nodiscard]] std::int64_t GetCapacity() const noexcept
+        {
+            return m_Mask + 1;
+        }
+
+        [[nodiscard]] T * Load(std::int64_t index) const noexcept
+        {
+            return m_Items[static_cast<std::size_t>(index & m_Mask)].load(std::memory_order_acquire);
+        }
+
+        void Store(std::int64_t index, T * item) noexcept
+        {
+            m_Items[static_cast<std::size_t>(index & m_Mask)].store(item, std::memory_order_release);
+        }
+
+    private:
+        std::int64_t                         m_Mask;
+        std::unique_ptr<std::atomic<T *>[]> m_Items;
+    };
+
+public:
+    explicit WorkStealingDeque(std::int64_t capacity = 1024) : m_Top(0), m_Bottom(0), m_Ring(nullptr), m_Rings()
+    {
+        m_Rings.push_back(std::make_unique<Ring>(capacity));
+        m_Ring.store(m_Rings.back().get(), std::memory_order_relaxed);
+    }
+
+    WorkStealingDeque(const WorkStealingDeque & other) = delete;
+
+    WorkStealingDeque(WorkStealingDeque && other) noexcept = delete;
+
+    WorkStealingDeque & operator=(const WorkStealingDeque & other) = delete;
+
+    WorkStealingDeque & operator=(WorkStealingDeque && other) noexcept = delete;
+
+    ~WorkStealingDeque() noexcept = default;
+
+    // Owner thread only
+    void Push(T * item)
+    {
+        auto bottom = m_Bottom.load(std::memory_order_relaxed);
+        auto top    = m_Top.load(std::memory_order_acquire);
+        auto ring   = m_Ring.load(std::memory_order_relaxed);
+
+        if (bottom - top > ring->GetCapacity() - 1)
+        {
+            ring = Grow(ring, top, bottom);
+        }
+
+        ring->Store(bottom, item);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+
+    // Owner thread only
+    [[nodiscard]] T * Pop() noexcept
+    {
+        auto bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+        auto ring   = m_Ring.load(std::memory_order_relaxed);
+        m_Bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto top = m_Top.load(std::memory_order_relaxed);
+
+        if (top > bottom)
+        {
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        auto item = ring->Load(bottom);
+        if (top == bottom)
+        {
+            // Last item, race the thieves for it
+            if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                item = nullptr;
+            }
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+
+        return item;
+    }
+
+    // Any thread
+    [[nodiscard]] T * Steal() noexcept
+    {
+        auto top = m_Top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto bottom = m_Bottom.load(std::memory_order_acquire);
+
+        if (top >= bottom)
+        {
+            return nullptr;
+        }
+
+        auto item = m_Ring.load(std::memory_order_acquire)->Load(top);
+        if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            return nullptr;
+        }
+
+        return item;
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept
+    {
+        return m_Top.load(std::memory_order_relaxed) >= m_Bottom.load(std::memory_order_relaxed);
+    }
+
+private:
+    [[nodiscard]] Ring * Grow(Ring * ring, std::int64_t top, std::int64_t bottom)
+    {
+        auto grown = std::make_unique<Ring>(ring->GetCapacity() * 2);
+        for (auto index = top; index < bottom; ++index)
+        {
+            grown->Store(index, ring->Load(index));
+        }
+
+        // Thieves may still read the old ring, so it is only released together with the deque
+        auto result = grown.get();
+        m_Rings.push_back(std::move(grown));
+        m_Ring.store(result, std::memory_order_release);
+
+        return result;
+    }
+
+private:
+    alignas(64) std::atomic<std::int64_t> m_Top;
+    alignas(64) std::atomic<std::int64_t> m_Bottom;
+    std::atomic<Ring *>                   m_Ring;
+    std::vector<std::unique_ptr<Ring>>    m_Rings;
+};
+} // namespace CuEngine::Jobs::Impl
@@ -0,0 +1,71 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Impl/SchedulerImpl.hpp"
+
+namespace CuEngine::Jobs
+{
+
+Scheduler::Scheduler(Impl::Scheduler && scheduler) noexcept : m_Pimpl(std::move(scheduler))
+{}
+
+Scheduler::Scheduler(Scheduler && other) noexcept = default;
+
+Scheduler & Scheduler::operator=(Scheduler && other) noexcept = default;
+
+Scheduler::~Scheduler() noexcept = default;
+
+Counter Scheduler::Schedule(std::function<void()> job)
+{
+    return Counter(Impl::Counter(m_Pimpl->Schedule(1,
+                                                   [job = std::move(job)](std::uint32_t)
+                                                   {
+                                                       job();
+                                                   })));
+}
+
+Counter Scheduler::Schedule(std::uint32_t count, std::function<void(std::uint32_t)> job)
+{
+    return Counter(Impl::Counter(m_Pimpl->Schedule(count, std::move(job))));
+}
+
+Counter Scheduler::ScheduleAfter(const Counter & dependency, std::function<void()> job)
+{
+    return Counter(Impl::Counter(m_Pimpl->ScheduleAfter(dependency.GetImpl().GetState(), std::move(job))));
+}
+
+void Scheduler::Wait(const Counter & counter)
+{
+    m_Pimpl->Wait(counter.GetImpl().GetState());
+}
+
+std::uint32_t Scheduler::GetWorkerCount() const noexcept
+{
+    return m_Pimpl->GetWorkerCount();
+}
+
+Impl::Scheduler & Scheduler::GetImpl() noexcept
+{
+    return *m_Pimpl;
+}
+
+} // namespace CuEngine::Jobs
@@ -0,0 +1,63 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Impl/SchedulerBuilderImpl.hpp"
+
+namespace CuEngine::Jobs
+{
+SchedulerBuilder::SchedulerBuilder() = default;
+
+SchedulerBuilder::SchedulerBuilder(const SchedulerBuilder & other) = default;
+
+SchedulerBuilder::SchedulerBuilder(SchedulerBuilder && other) noexcept = default;
+
+SchedulerBuilder & SchedulerBuilder::operator=(const SchedulerBuilder & other) = default;
+
+SchedulerBuilder & SchedulerBuilder::operator=(SchedulerBuilder && other) noexcept = default;
+
+SchedulerBuilder::~SchedulerBuilder() noexcept = default;
+
+SchedulerBuilder & SchedulerBuilder::SetWorkerCount(std::uint32_t workerCount) noexcept
+{
+    m_Pimpl->SetWorkerCount(workerCount);
+
+    return *this;
+}
+
+SchedulerBuilder & SchedulerBuilder::SetPinWorkers(bool isPinned) noexcept
+{
+    m_Pimpl->SetPinWorkers(isPinned);
+
+    return *this;
+}
+
+Scheduler SchedulerBuilder::Build() const
+{
+    return Scheduler(m_Pimpl->Build());
+}
+
+Impl::SchedulerBuilder & SchedulerBuilder::GetImpl() noexcept
+{
+    return *m_Pimpl;
+}
+
+} // namespace CuEngine::Jobs
@@ -0,0 +1,397 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <CuEngine/Math/Batch.hpp>
+
+#include <algorithm>
+#include <cstddef>
+
+namespace CuEngine::Math
+{
+namespace
+{
+std::size_t GetCount(const ConstPointArrays & points, const PointArrays & result) noexcept
+{
+    return std::min({ points.x.size(), points.y.size(), points.z.size(), result.x.size(), result.y.size(),
+                      result.z.size() });
+}
+
+// Into a temporary first so the result may alias either input
+void MultiplyScalar(const Mat4 & left, const Mat4 & right, Mat4 & result) noexcept
+{
+    const auto & [l0, l1, l2, l3] = left.columns;
+
+    Mat4 product;
+    for (auto column = 0; column < 4; ++column)
+    {
+        const auto & r = right.columns[column];
+
+        product.columns[column] = { l0.x * r.x + l1.x * r.y + l2.x * r.z + l3.x * r.w,
+                                    l0.y * r.x + l1.y * r.y + l2.y * r.z + l3.y * r.w,
+                                    l0.z * r.x + l1.z * r.y + l2.z * r.z + l3.z * r.w,
+                                    l0.w * r.x + l1.w * r.y + l2.w * r.z + l3.w * r.w };
+    }
+    result = product;
+}
+
+void Multiply(const Mat4 & left, const Mat4 & right, Mat4 & result) noexcept
+{
+#if defined(CU_MATH_AVX2)
+    // Two result columns per register: the left columns are repeated in both halves and each half of the right
+    // register broadcasts its own column's elements
+    auto left0 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(&left.columns[0].x));
+    auto left1 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(&left.columns[1].x));
+    auto left2 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(&left.columns[2].x));
+    auto left3 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(&left.columns[3].x));
+
+    // Two adjacent columns per load, both read before anything is stored so the result may alias either input
+    auto right01 = _mm256_loadu_ps(&right.columns[0].x);
+    auto right23 = _mm256_loadu_ps(&right.columns[2].x);
+
+    auto multiply = [&](__m256 columns)
+    {
+        auto value = _mm256_mul_ps(left0, _mm256_shuffle_ps(columns, columns, _MM_SHUFFLE(0, 0, 0, 0)));
+        value      = _mm256_fmadd_ps(left1, _mm256_shuffle_ps(columns, columns, _MM_SHUFFLE(1, 1, 1, 1)), value);
+        value      = _mm256_fmadd_ps(left2, _mm256_shuffle_ps(columns, columns, _MM_SHUFFLE(2, 2, 2, 2)), value);
+
+        return _mm256_fmadd_ps(left3, _mm256_shuffle_ps(columns, columns, _MM_SHUFFLE(3, 3, 3, 3)), value);
+    };
+
+    _mm256_storeu_ps(&result.columns[0].x, multiply(right01));
+    _mm256_storeu_ps(&result.columns[2].x, multiply(right23));
+#elif defined(CU_MATH_SSE41)
+    auto left0 = Detail::Load(left.columns[0]);
+    auto left1 = Detail::Load(left.columns[1]);
+    auto left2 = Detail::Load(left.columns[2]);
+    auto left3 = Detail::Load(left.columns[3]);
+
+    // Both matrices are read in full before anything is stored so the result may alias either input
+    auto right0 = Detail::Load(right.columns[0]);
+    auto right1 = Detail::Load(right.columns[1]);
+    auto right2 = Detail::Load(right.columns[2]);
+    auto right3 = Detail::Load(right.columns[3]);
+
+    _mm_store_ps(&result.columns[0].x, Detail::MultiplyColumn(left0, left1, left2, left3, right0));
+    _mm_store_ps(&result.columns[1].x, Detail::MultiplyColumn(left0, left1, left2, left3, right1));
+    _mm_store_ps(&result.columns[2].x, Detail::MultiplyColumn(left0, left1, left2, left3, right2));
+    _mm_store_ps(&result.columns[3].x, Detail::MultiplyColumn(left0, left1, left2, left3, right3));
+#else
+    MultiplyScalar(left, right, result);
+#endif
+}
+
+// Into a temporary first so the result may alias either input
+void MultiplyBlockScalar(const Mat4Block & left, const Mat4Block & right, Mat4Block & result) noexcept
+{
+    const auto & l = left.elements;
+    const auto & r = right.elements;
+
+    // Left uninitialized, every element is written below
+    float product[16][Mat4Block::matrixCount];
+    for (auto column = 0; column < 4; ++column)
+    {
+        for (auto row = 0; row < 4; ++row)
+        {
+            for (auto lane = 0u; lane < Mat4Block::matrixCount; ++lane)
+            {
+                product[column * 4 + row][lane] = l[row][lane] * r[column * 4][lane]
+                                                + l[4 + row][lane] * r[column * 4 + 1][lane]
+                                                + l[8 + row][lane] * r[column * 4 + 2][lane]
+                                                + l[12 + row][lane] * r[column * 4 + 3][lane];
+            }
+        }
+    }
+
+    for (auto element = 0; element < 16; ++element)
+    {
+        std::ranges::copy(product[element], result.elements[element]);
+    }
+}
+
+#if defined(CU_MATH_AVX2)
+using BlockRegister = __m256;
+
+BlockRegister LoadBlock(const float * elements) noexcept
+{
+    return _mm256_load_ps(elements);
+}
+
+void StoreBlock(float * elements, BlockRegister value) noexcept
+{
+    _mm256_store_ps(elements, value);
+}
+
+// left0 * right0 + left1 * right1 + left2 * right2 + left3 * right3 per lane
+BlockRegister Dot(BlockRegister left0, BlockRegister left1, BlockRegister left2, BlockRegister left3,
+                  BlockRegister right0, BlockRegister right1, BlockRegister right2, BlockRegister right3) noexcept
+{
+    auto value = _mm256_mul_ps(left0, right0);
+    value      = _mm256_fmadd_ps(left1, right1, value);
+    value      = _mm256_fmadd_ps(left2, right2, value);
+
+    return _mm256_fmadd_ps(left3, right3, value);
+}
+#elif defined(CU_MATH_SSE41)
+using BlockRegister = __m128;
+
+BlockRegister LoadBlock(const float * elements) noexcept
+{
+    return _mm_load_ps(elements);
+}
+
+void StoreBlock(float * elements, BlockRegister value) noexcept
+{
+    _mm_store_ps(elements, value);
+}
+
+BlockRegister Dot(BlockRegister left0, BlockRegister left1, BlockRegister left2, BlockRegister left3,
+                  BlockRegister right0, BlockRegister right1, BlockRegister right2, BlockRegister right3) noexcept
+{
+    return _mm_add_ps(_mm_add_ps(_mm_mul_ps(left0, right0), _mm_mul_ps(left1, right1)),
+                      _mm_add_ps(_mm_mul_ps(left2, right2), _mm_mul_ps(left3, right3)));
+}
+#endif
+
+void MultiplyBlock(const Mat4Block & left, const Mat4Block & right, Mat4Block & result) noexcept
+{
+#if defined(CU_MATH_SIMD)
+    // One register per element, each holding that element of the whole block under AVX2 and of half of it under
+    // SSE4.1. The left elements are all read and every right column before its result column is stored, so the result
+    // may alias either input
+    constexpr auto laneCount = std::uint32_t(sizeof(BlockRegister) / sizeof(float));
+
+    for (auto lane = 0u; lane < Mat4Block::matrixCount; lane += laneCount)
+    {
+        auto element = [lane](auto & block, int column, int row) { return block.elements[column * 4 + row] + lane; };
+
+        // lRC is row R of column C
+        auto l00 = LoadBlock(element(left, 0, 0)), l01 = LoadBlock(element(left, 1, 0));
+        auto l02 = LoadBlock(element(left, 2, 0)), l03 = LoadBlock(element(left, 3, 0));
+        auto l10 = LoadBlock(element(left, 0, 1)), l11 = LoadBlock(element(left, 1, 1));
+        auto l12 = LoadBlock(element(left, 2, 1)), l13 = LoadBlock(element(left, 3, 1));
+        auto l20 = LoadBlock(element(left, 0, 2)), l21 = LoadBlock(element(left, 1, 2));
+        auto l22 = LoadBlock(element(left, 2, 2)), l23 = LoadBlock(element(left, 3, 2));
+        auto l30 = LoadBlock(element(left, 0, 3)), l31 = LoadBlock(element(left, 1, 3));
+        auto l32 = LoadBlock(element(left, 2, 3)), l33 = LoadBlock(element(left, 3, 3));
+
+        for (auto column = 0; column < 4; ++column)
+        {
+            auto r0 = LoadBlock(element(right, column, 0));
+            auto r1 = LoadBlock(element(right, column, 1));
+            auto r2 = LoadBlock(element(right, column, 2));
+            auto r3 = LoadBlock(element(right, column, 3));
+
+            StoreBlock(element(result, column, 0), Dot(l00, l01, l02, l03, r0, r1, r2, r3));
+            StoreBlock(element(result, column, 1), Dot(l10, l11, l12, l13, r0, r1, r2, r3));
+            StoreBlock(element(result, column, 2), Dot(l20, l21, l22, l23, r0, r1, r2, r3));
+            StoreBlock(element(result, column, 3), Dot(l30, l31, l32, l33, r0, r1, r2, r3));
+        }
+    }
+#else
+    MultiplyBlockScalar(left, right, result);
+#endif
+}
+} // namespace
+
+void TransformPoints(const Mat4 & matrix, const ConstPointArrays & points, const PointArrays & result) noexcept
+{
+#if defined(CU_MATH_SIMD)
+    auto count = GetCount(points, result);
+    auto index = std::size_t(0);
+
+    const auto & [c0, c1, c2, c3] = matrix.columns;
+
+#if defined(CU_MATH_AVX2)
+    // Eight points per iteration, every matrix element broadcast once up front
+    auto m00 = _mm256_set1_ps(c0.x), m01 = _mm256_set1_ps(c1.x), m02 = _mm256_set1_ps(c2.x), m03 = _mm256_set1_ps(c3.x);
+    auto m10 = _mm256_set1_ps(c0.y), m11 = _mm256_set1_ps(c1.y), m12 = _mm256_set1_ps(c2.y), m13 = _mm256_set1_ps(c3.y);
+    auto m20 = _mm256_set1_ps(c0.z), m21 = _mm256_set1_ps(c1.z), m22 = _mm256_set1_ps(c2.z), m23 = _mm256_set1_ps(c3.z);
+
+    for (; index + 8 <= count; index += 8)
+    {
+        auto x = _mm256_loadu_ps(points.x.data() + index);
+        auto y = _mm256_loadu_ps(points.y.data() + index);
+        auto z = _mm256_loadu_ps(points.z.data() + index);
+
+        auto resultX = _mm256_fmadd_ps(m02, z, _mm256_fmadd_ps(m01, y, _mm256_fmadd_ps(m00, x, m03)));
+        auto resultY = _mm256_fmadd_ps(m12, z, _mm256_fmadd_ps(m11, y, _mm256_fmadd_ps(m10, x, m13)));
+        auto resultZ = _mm256_fmadd_ps(m22, z, _mm256_fmadd_ps(m21, y, _mm256_fmadd_ps(m20, x, m23)));
+
+        _mm256_storeu_ps(result.x.data() + index, resultX);
+        _mm256_storeu_ps(result.y.data() + index, resultY);
+        _mm256_storeu_ps(result.z.data() + index, resultZ);
+    }
+#else
+    // Four points per iteration, every matrix element broadcast once up front
+    auto m00 = _mm_set1_ps(c0.x), m01 = _mm_set1_ps(c1.x), m02 = _mm_set1_ps(c2.x), m03 = _mm_set1_ps(c3.x);
+    auto m10 = _mm_set1_ps(c0.y), m11 = _mm_set1_ps(c1.y), m12 = _mm_set1_ps(c2.y), m13 = _mm_set1_ps(c3.y);
+    auto m20 = _mm_set1_ps(c0.z), m21 = _mm_set1_ps(c1.z), m22 = _mm_set1_ps(c2.z), m23 = _mm_set1_ps(c3.z);
+
+    for (; index + 4 <= count; index += 4)
+    {
+        auto x = _mm_loadu_ps(points.x.data() + index);
+        auto y = _mm_loadu_ps(points.y.data() + index);
+        auto z = _mm_loadu_ps(points.z.data() + index);
+
+        auto resultX = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m00, x), _mm_mul_ps(m01, y)),
+                                  _mm_add_ps(_mm_mul_ps(m02, z), m03));
+        auto resultY = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m10, x), _mm_mul_ps(m11, y)),
+                                  _mm_add_ps(_mm_mul_ps(m12, z), m13));
+        auto resultZ = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m20, x), _mm_mul_ps(m21, y)),
+                                  _mm_add_ps(_mm_mul_ps(m22, z), m23));
+
+        _mm_storeu_ps(result.x.data() + index, resultX);
+        _mm_storeu_ps(result.y.data() + index, resultY);
+        _mm_storeu_ps(result.z.data() + index, resultZ);
+    }
+#endif
+
+    // The tail shorter than a register
+    Scalar::TransformPoints(matrix,
+                            { points.x.subspan(index, count - index), points.y.subspan(index, count - index),
+                              points.z.subspan(index, count - index) },
+                            { result.x.subspan(index, count - index), result.y.subspan(index, count - index),
+                              result.z.subspan(index, count - index) });
+#else
+    Scalar::TransformPoints(matrix, points, result);
+#endif
+}
+
+void MultiplyMatrices(std::span<const Mat4> left, std::span<const Mat4> right, std::span<Mat4> result) noexcept
+{
+    auto count = std::min({ left.size(), right.size(), result.size() });
+    for (auto index = std::size_t(0); index < count; ++index)
+    {
+        Multiply(left[index], right[index], result[index]);
+    }
+}
+
+void PackMatrices(std::span<const Mat4> matrices, std::span<Mat4Block> blocks) noexcept
+{
+    auto count     = std::min(matrices.size(), blocks.size() * Mat4Block::matrixCount);
+    auto laneCount = GetBlockCount(count) * Mat4Block::matrixCount;
+
+    for (auto index = std::size_t(0); index < laneCount; ++index)
+    {
+        auto   matrix = index < count ? matrices[index] : Mat4 {};
+        auto & block  = blocks[index / Mat4Block::matrixCount];
+        auto   lane   = index % Mat4Block::matrixCount;
+
+        for (auto column = 0; column < 4; ++column)
+        {
+            const auto & [x, y, z, w] = matrix.columns[column];
+
+            block.elements[column * 4][lane]     = x;
+            block.elements[column * 4 + 1][lane] = y;
+            block.elements[column * 4 + 2][lane] = z;
+            block.elements[column * 4 + 3][lane] = w;
+        }
+    }
+}
+
+void UnpackMatrices(std::span<const Mat4Block> blocks, std::span<Mat4> matrices) noexcept
+{
+    auto count = std::min(matrices.size(), blocks.size() * Mat4Block::matrixCount);
+    for (auto index = std::size_t(0); index < count; ++index)
+    {
+        const auto & elements = blocks[index / Mat4Block::matrixCount].elements;
+        auto         lane     = index % Mat4Block::matrixCount;
+
+        for (auto column = 0; column < 4; ++column)
+        {
+            matrices[index].columns[column] = { elements[column * 4][lane], elements[column * 4 + 1][lane],
+                                                elements[column * 4 + 2][lane], elements[column * 4 + 3][lane] };
+        }
+    }
+}
+
+void MultiplyMatrices(std::span<const Mat4Block> left, std::span<const Mat4Block> right,
+                      std::span<Mat4Block> result) noexcept
+{
+    auto count = std::min({ left.size(), right.size(), result.size() });
+    for (auto index = std::size_t(0); index < count; ++index)
+    {
+        MultiplyBlock(left[index], right[index], result[index]);
+    }
+}
+
+void MultiplyMatrices(std::span<const Mat4> left, std::span<const std::uint32_t> leftIndices,
+                      std::span<const Mat4> right, std::span<Mat4> result) noexcept
+{
+    auto count = std::min({ leftIndices.size(), right.size(), result.size() });
+    for (auto index = std::size_t(0); index < count; ++index)
+    {
+        Multiply(left[leftIndices[index]], right[index], result[index]);
+    }
+}
+
+namespace Scalar
+{
+void TransformPoints(const Mat4 & matrix, const ConstPointArrays & points, const PointArrays & result) noexcept
+{
+    auto count = GetCount(points, result);
+
+    const auto & [c0, c1, c2, c3] = matrix.columns;
+
+    for (auto index = std::size_t(0); index < count; ++index)
+    {
+        auto x = points.x[index];
+        auto y = points.y[index];
+        auto z = points.z[index];
+
+        result.x[index] = c0.x * x + c1.x * y + c2.x * z + c3.x;
+        result.y[index] = c0.y * x + c1.y * y + c2.y * z + c3.y;
+        result.z[index] = c0.z * x + c1.z * y + c2.z * z + c3.z;
+    }
+}
+
+void MultiplyMatrices(std::span<const Mat4> left, std::span<const Mat4> right, std::span<Mat4> result) noexcept
+{
+    auto count = std::min({ left.size(), right.size(), result.size() });
+    for (auto index = std::size_t(0); index < count; ++index)
+    {
+        MultiplyScalar(left[index], right[index], result[index]);
+    }
+}
+
+void MultiplyMatrices(std::span<const Mat4Block> left, std::span<const Mat4Block> right,
+                      std::span<Mat4Block> result) noexcept
+{
+    auto count = std::min({ left.size(), right.size(), result.size() });
+    for (auto index = std::size_t(0); index < count; ++index)
+    {
+        MultiplyBlockScalar(left[index], right[index], result[index]);
+    }
+}
+
+void MultiplyMatrices(std::span<const Mat4> left, std::span<const std::uint32_t> leftIndices,
+                      std::span<const Mat4> right, std::span<Mat4> result) noexcept
+{
+    auto count = std::min({ leftIndices.size(), right.size(), result.size() });
+    for (auto index = std::size_t(0); index < count; ++index)
+    {
+        MultiplyScalar(left[leftIndices[index]], right[index], result[index]);
+    }
+}
+
+} // namespace Scalar
+} // namespace CuEngine::Math
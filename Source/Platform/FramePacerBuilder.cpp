@@ -0,0 +1,87 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Impl/FramePacerBuilderImpl.hpp"
+
+namespace CuEngine::Platform
+{
+FramePacerBuilder::FramePacerBuilder() : m_Pimpl()
+{}
+
+FramePacerBuilder::FramePacerBuilder(const FramePacerBuilder & other) = default;
+
+FramePacerBuilder::FramePacerBuilder(FramePacerBuilder && other) noexcept : m_Pimpl(std::move(other.m_Pimpl))
+{}
+
+FramePacerBuilder & FramePacerBuilder::operator=(const FramePacerBuilder & other) = default;
+
+FramePacerBuilder & FramePacerBuilder::operator=(FramePacerBuilder && other) noexcept
+{
+    if (this != &other)
+    {
+        m_Pimpl = std::move(other.m_Pimpl);
+    }
+
+    return *this;
+}
+
+FramePacerBuilder::~FramePacerBuilder() noexcept = default;
+
+FramePacerBuilder & FramePacerBuilder::SetMode(FramePacingMode mode) noexcept
+{
+    m_Pimpl->SetMode(mode);
+
+    return *this;
+}
+
+FramePacerBuilder & FramePacerBuilder::SetTargetFrameRate(double frameRate) noexcept
+{
+    m_Pimpl->SetTargetFrameRate(frameRate);
+
+    return *this;
+}
+
+FramePacerBuilder & FramePacerBuilder::SetBackgroundFrameRate(double frameRate) noexcept
+{
+    m_Pimpl->SetBackgroundFrameRate(frameRate);
+
+    return *this;
+}
+
+FramePacerBuilder & FramePacerBuilder::SetIdleTimeout(std::chrono::milliseconds timeout) noexcept
+{
+    m_Pimpl->SetIdleTimeout(timeout);
+
+    return *this;
+}
+
+FramePacer FramePacerBuilder::Build() const
+{
+    return FramePacer(m_Pimpl->Build());
+}
+
+Impl::FramePacerBuilder & FramePacerBuilder::GetImpl() noexcept
+{
+    return *m_Pimpl;
+}
+
+} // namespace CuEngine::Platform
@@ -0,0 +1,112 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "FramePacerImpl.hpp"
+
+#include <CuEngine/Platform/FramePacerBuilder.hpp>
+
+#include <chrono>
+#include <memory>
+
+namespace CuEngine::Platform::Impl
+{
+class FramePacerBuilder
+{
+public:
+    FramePacerBuilder() noexcept
+        : m_FramePeriod(FramePacer::Clock::duration::zero()),
+          m_BackgroundFramePeriod(FramePacer::Clock::duration::zero()), m_IdleTimeout(std::chrono::milliseconds(100)),
+          m_Mode(FramePacingMode::Uncapped)
+    {}
+
+    FramePacerBuilder(const FramePacerBuilder &) = default;
+
+    FramePacerBuilder(FramePacerBuilder && other) noexcept = default;
+
+    FramePacerBuilder & operator=(const FramePacerBuilder &) = default;
+
+    FramePacerBuilder & operator=(FramePacerBuilder && other) noexcept = default;
+
+    ~FramePacerBuilder() noexcept = default;
+
+    FramePacerBuilder & SetMode(FramePacingMode mode) noexcept
+    {
+        m_Mode = mode;
+
+        return *this;
+    }
+
+    FramePacerBuilder & SetTargetFrameRate(double frameRate) noexcept
+    {
+        m_FramePeriod = ToFramePeriod(frameRate);
+
+        return *this;
+    }
+
+    FramePacerBuilder & SetBackgroundFrameRate(double frameRate) noexcept
+    {
+        m_BackgroundFramePeriod = ToFramePeriod(frameRate);
+
+        return *this;
+    }
+
+    FramePacerBuilder & SetIdleTimeout(std::chrono::milliseconds timeout) noexcept
+    {
+        m_IdleTimeout = timeout;
+
+        return *this;
+    }
+
+    [[nodiscard]] FramePacer Build() const
+    {
+        auto state                   = std::make_unique<FramePacer::State>();
+        state->mode                  = m_Mode;
+        state->framePeriod           = m_Mode == FramePacingMode::Uncapped ? FramePacer::Clock::duration::zero()
+                                                                           : m_FramePeriod;
+        state->backgroundFramePeriod = m_BackgroundFramePeriod;
+        state->idleTimeout           = m_IdleTimeout;
+        state->nextFrameTime         = FramePacer::Clock::now();
+        state->isRedrawRequested     = true;
+        state->window                = nullptr;
+
+        return FramePacer(std::move(state));
+    }
+
+private:
+    static FramePacer::Clock::duration ToFramePeriod(double frameRate) noexcept
+    {
+        if (frameRate <= 0.0)
+        {
+            return FramePacer::Clock::duration::zero();
+        }
+
+        return std::chrono::duration_cast<FramePacer::Clock::duration>(std::chrono::duration<double>(1.0 / frameRate));
+    }
+
+    FramePacer::Clock::duration m_FramePeriod;
+    FramePacer::Clock::duration m_BackgroundFramePeriod;
+    FramePacer::Clock::duration m_IdleTimeout;
+    FramePacingMode             m_Mode;
+};
+} // namespace CuEngine::Platform::Impl
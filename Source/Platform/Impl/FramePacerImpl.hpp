@@ -0,0 +1,177 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "WindowImpl.hpp"
+
+#include <CuEngine/Platform/FramePacer.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <utility>
+
+namespace CuEngine::Platform::Impl
+{
+class FramePacer
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct State
+    {
+        FramePacingMode       mode;
+        Clock::duration       framePeriod;
+        Clock::duration       backgroundFramePeriod;
+        Clock::duration       idleTimeout;
+        Clock::time_point     nextFrameTime;
+        std::atomic<bool>     isRedrawRequested;
+        std::atomic<Window *> window;
+    };
+
+    explicit FramePacer(std::unique_ptr<State> state) noexcept : m_State(std::move(state))
+    {}
+
+    FramePacer(const FramePacer &) = delete;
+
+    FramePacer(FramePacer && other) noexcept = default;
+
+    FramePacer & operator=(const FramePacer &) = delete;
+
+    FramePacer & operator=(FramePacer && other) noexcept
+    {
+        if (this != &other)
+        {
+            std::swap(m_State, other.m_State);
+        }
+
+        return *this;
+    }
+
+    ~FramePacer() noexcept = default;
+
+    [[nodiscard]] bool WaitForFrame(Window & window)
+    {
+        m_State->window.store(&window);
+
+        // Nothing can be presented, so the loop only wakes up for events and its periodic work
+        if (window.IsMinimized())
+        {
+            window.WaitForActivity(m_State->idleTimeout);
+            static_cast<void>(window.ConsumeActivity());
+
+            return false;
+        }
+
+        if (m_State->mode == FramePacingMode::OnDemand && !ConsumeRedraw(window))
+        {
+            window.WaitForActivity(m_State->idleTimeout);
+            if (!ConsumeRedraw(window))
+            {
+                return false;
+            }
+        }
+
+        auto framePeriod = m_State->framePeriod;
+        if (!window.IsFocused())
+        {
+            framePeriod = std::max(framePeriod, m_State->backgroundFramePeriod);
+        }
+
+        Pace(framePeriod);
+
+        return true;
+    }
+
+    [[nodiscard]] bool WaitForFrame()
+    {
+        Pace(m_State->framePeriod);
+
+        return true;
+    }
+
+    void RequestRedraw() noexcept
+    {
+        m_State->isRedrawRequested.store(true);
+
+        // The window's activity flag is what the render thread sleeps on
+        if (auto * window = m_State->window.load())
+        {
+            window->NotifyActivity();
+        }
+    }
+
+    [[nodiscard]] FramePacingMode GetMode() const noexcept
+    {
+        return m_State->mode;
+    }
+
+private:
+    [[nodiscard]] bool ConsumeRedraw(Window & window) noexcept
+    {
+        auto hasActivity = window.ConsumeActivity();
+
+        return m_State->isRedrawRequested.exchange(false) || hasActivity;
+    }
+
+    void Pace(Clock::duration framePeriod) noexcept
+    {
+        if (framePeriod == Clock::duration::zero())
+        {
+            return;
+        }
+
+        auto now = Clock::now();
+        if (now < m_State->nextFrameTime)
+        {
+            SleepUntil(m_State->nextFrameTime);
+            m_State->nextFrameTime += framePeriod;
+        }
+        else
+        {
+            // A late frame starts a new period instead of rushing the following ones to catch up
+            m_State->nextFrameTime = now + framePeriod;
+        }
+    }
+
+    static void SleepUntil(Clock::time_point deadline) noexcept
+    {
+        // Sleeping overshoots by up to a scheduler tick, so the last stretch is spun
+        constexpr auto spinThreshold = std::chrono::microseconds(1500);
+
+        if (auto sleepTime = deadline - Clock::now() - spinThreshold; sleepTime > Clock::duration::zero())
+        {
+            std::this_thread::sleep_for(sleepTime);
+        }
+
+        while (Clock::now() < deadline)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    std::unique_ptr<State> m_State;
+};
+} // namespace CuEngine::Platform::Impl
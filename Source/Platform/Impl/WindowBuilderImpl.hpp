@@ -34,7 +34,7 @@ namespace CuEngine::Platform::Impl
 class WindowBuilder
 {
 public:
-    WindowBuilder() : m_Width(640), m_Height(480), m_Title("No Title")
+    WindowBuilder() : m_Width(640), m_Height(480), m_Title("No Title"), m_IsResizable(false)
     {}
 
     WindowBuilder(const WindowBuilder &) = default;
@@ -75,10 +75,17 @@ public:
         return *this;
     }
 
+    WindowBuilder & SetResizable(bool isResizable) noexcept
+    {
+        m_IsResizable = isResizable;
+
+        return *this;
+    }
+
     [[nodiscard]] Window Build() const
     {
         glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
-        glfwWindowHint(GLFW_RESIZABLE, GLFW_FALSE);
+        glfwWindowHint(GLFW_RESIZABLE, m_IsResizable ? GLFW_TRUE : GLFW_FALSE);
 
         auto window =
             glfwCreateWindow(static_cast<int>(m_Width), static_cast<int>(m_Height), m_Title.c_str(), nullptr, nullptr);
@@ -95,5 +102,6 @@ private:
     std::size_t m_Width;
     std::size_t m_Height;
     std::string m_Title;
+    bool        m_IsResizable;
 };
 } // namespace CuEngine::Platform::Impl
@@ -24,23 +24,134 @@
 
 #include <GLFW/glfw3.h>
 
+#include <CuEngine/Platform/InputEvent.hpp>
 #include <CuEngine/Platform/Window.hpp>
+#include <CuEngine/Utility/SpscQueue.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
+#include <utility>
 
 namespace CuEngine::Platform::Impl
 {
+// Events are pumped on the main thread, everything else may be queried from the render and simulation threads
 class Window
 {
+    // Owned on the heap so the GLFW user pointer survives moves of the wrapper
+    struct State
+    {
+        GLFWwindow *                                      window;
+        std::atomic<bool>                                 isMinimized;
+        std::atomic<bool>                                 isFocused;
+        std::atomic<std::uint32_t>                        width;
+        std::atomic<std::uint32_t>                        height;
+        std::atomic<std::uint64_t>                        droppedInputEventCount;
+        std::mutex                                        activityMutex;
+        std::condition_variable                           activityCondition;
+        bool                                              hasActivity;
+        bool                                              hasPendingResize;
+        bool                                              isDispatchedMinimized;
+        std::function<void(std::uint32_t, std::uint32_t)> resizeCallback;
+        std::function<void(bool)>                         minimizeCallback;
+        SpscQueue<InputEvent>                             inputEvents;
+    };
+
 public:
-    explicit Window(GLFWwindow * window) : m_Window(window)
-    {}
+    explicit Window(GLFWwindow * window) : m_State(std::make_unique<State>())
+    {
+        auto width  = 0;
+        auto height = 0;
+        glfwGetFramebufferSize(window, &width, &height);
+
+        m_State->window                 = window;
+        m_State->isMinimized            = glfwGetWindowAttrib(window, GLFW_ICONIFIED) == GLFW_TRUE;
+        m_State->isFocused              = glfwGetWindowAttrib(window, GLFW_FOCUSED) == GLFW_TRUE;
+        m_State->width                  = static_cast<std::uint32_t>(width);
+        m_State->height                 = static_cast<std::uint32_t>(height);
+        m_State->droppedInputEventCount = 0;
+        m_State->hasActivity            = true;
+        m_State->hasPendingResize       = false;
+        m_State->isDispatchedMinimized  = m_State->isMinimized;
+
+        glfwSetWindowUserPointer(window, m_State.get());
+
+        // Anything that can change what is on screen counts, render-on-demand loops redraw after it
+        glfwSetKeyCallback(window,
+                           [](GLFWwindow * handle, int key, int scancode, int action, int modifiers)
+                           {
+                               PushInputEvent(handle, { .type      = InputEventType::Key,
+                                                        .code      = key,
+                                                        .scancode  = scancode,
+                                                        .action    = action,
+                                                        .modifiers = modifiers });
+                           });
+        glfwSetCharCallback(window,
+                            [](GLFWwindow * handle, unsigned int codepoint)
+                            {
+                                PushInputEvent(handle, { .type = InputEventType::Character,
+                                                         .code = static_cast<std::int32_t>(codepoint) });
+                            });
+        glfwSetMouseButtonCallback(window,
+                                   [](GLFWwindow * handle, int button, int action, int modifiers)
+                                   {
+                                       PushInputEvent(handle, { .type      = InputEventType::MouseButton,
+                                                                .code      = button,
+                                                                .action    = action,
+                                                                .modifiers = modifiers });
+                                   });
+        glfwSetCursorPosCallback(window,
+                                 [](GLFWwindow * handle, double x, double y)
+                                 {
+                                     PushInputEvent(handle, { .type = InputEventType::CursorPosition, .x = x, .y = y });
+                                 });
+        glfwSetScrollCallback(window,
+                              [](GLFWwindow * handle, double x, double y)
+                              {
+                                  PushInputEvent(handle, { .type = InputEventType::Scroll, .x = x, .y = y });
+                              });
+        glfwSetFramebufferSizeCallback(window,
+                                       [](GLFWwindow * handle, int width, int height)
+                                       {
+                                           auto & state = GetState(handle);
+
+                                           state.width.store(static_cast<std::uint32_t>(width));
+                                           state.height.store(static_cast<std::uint32_t>(height));
+                                           state.hasPendingResize = true;
+                                           NotifyActivity(state);
+                                       });
+        glfwSetWindowRefreshCallback(window,
+                                     [](GLFWwindow * handle)
+                                     {
+                                         NotifyActivity(GetState(handle));
+                                     });
+        glfwSetWindowFocusCallback(window,
+                                   [](GLFWwindow * handle, int isFocused)
+                                   {
+                                       auto & state = GetState(handle);
+
+                                       state.isFocused.store(isFocused == GLFW_TRUE);
+                                       NotifyActivity(state);
+                                   });
+        glfwSetWindowIconifyCallback(window,
+                                     [](GLFWwindow * handle, int isIconified)
+                                     {
+                                         auto & state = GetState(handle);
+
+                                         state.isMinimized.store(isIconified == GLFW_TRUE);
+                                         NotifyActivity(state);
+                                     });
+    }
 
     Window(const Window &) noexcept = delete;
 
-    Window(Window && other) noexcept : m_Window(std::exchange(other.m_Window, nullptr))
-    {}
+    Window(Window && other) noexcept = default;
 
     Window & operator=(const Window &) noexcept = delete;
 
@@ -48,7 +159,7 @@ public:
     {
         if (this != &other)
         {
-            std::swap(m_Window, other.m_Window);
+            std::swap(m_State, other.m_State);
         }
 
         return *this;
@@ -56,28 +167,164 @@ public:
 
     ~Window() noexcept
     {
-        if (m_Window)
+        if (!m_State)
         {
-            glfwDestroyWindow(m_Window);
+            return;
         }
+
+        glfwDestroyWindow(m_State->window);
     }
 
+    // Any thread, GLFW only sets a flag
     [[nodiscard]] bool ShouldClose() const noexcept
     {
-        return glfwWindowShouldClose(m_Window);
+        return glfwWindowShouldClose(m_State->window);
     }
 
-    void PollEvents() const noexcept
+    void RequestClose() noexcept
+    {
+        glfwSetWindowShouldClose(m_State->window, GLFW_TRUE);
+        glfwPostEmptyEvent();
+    }
+
+    // Main thread only
+    void PollEvents()
     {
         glfwPollEvents();
+        DispatchCallbacks();
+    }
+
+    // Main thread only
+    void WaitEvents(std::chrono::nanoseconds timeout)
+    {
+        glfwWaitEventsTimeout(std::chrono::duration<double>(timeout).count());
+        DispatchCallbacks();
+    }
+
+    // Any thread, wakes the main thread out of WaitEvents
+    static void PostEmptyEvent() noexcept
+    {
+        glfwPostEmptyEvent();
+    }
+
+    void SetResizeCallback(std::function<void(std::uint32_t, std::uint32_t)> callback) noexcept
+    {
+        m_State->resizeCallback = std::move(callback);
+    }
+
+    void SetMinimizeCallback(std::function<void(bool)> callback) noexcept
+    {
+        m_State->minimizeCallback = std::move(callback);
+    }
+
+    // Single consumer thread only
+    [[nodiscard]] bool PopInputEvent(InputEvent & event) noexcept
+    {
+        return m_State->inputEvents.TryPop(event);
+    }
+
+    [[nodiscard]] std::uint64_t GetDroppedInputEventCount() const noexcept
+    {
+        return m_State->droppedInputEventCount.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::uint32_t GetWidth() const noexcept
+    {
+        return m_State->width.load();
+    }
+
+    [[nodiscard]] std::uint32_t GetHeight() const noexcept
+    {
+        return m_State->height.load();
+    }
+
+    [[nodiscard]] bool IsMinimized() const noexcept
+    {
+        return m_State->isMinimized.load();
+    }
+
+    [[nodiscard]] bool IsFocused() const noexcept
+    {
+        return m_State->isFocused.load();
+    }
+
+    // Returns early once events arrive or someone else notifies, without consuming the activity
+    void WaitForActivity(std::chrono::nanoseconds timeout) const
+    {
+        auto lock = std::unique_lock(m_State->activityMutex);
+        m_State->activityCondition.wait_for(lock, timeout,
+                                            [this]()
+                                            {
+                                                return m_State->hasActivity;
+                                            });
+    }
+
+    void NotifyActivity() noexcept
+    {
+        NotifyActivity(*m_State);
+    }
+
+    [[nodiscard]] bool ConsumeActivity() noexcept
+    {
+        auto lock = std::scoped_lock(m_State->activityMutex);
+
+        return std::exchange(m_State->hasActivity, false);
     }
 
     [[nodiscard]] GLFWwindow * GetWindow() const noexcept
     {
-        return m_Window;
+        return m_State->window;
     }
 
 private:
-    GLFWwindow * m_Window;
+    static State & GetState(GLFWwindow * window) noexcept
+    {
+        return *static_cast<State *>(glfwGetWindowUserPointer(window));
+    }
+
+    static void NotifyActivity(State & state) noexcept
+    {
+        {
+            auto lock         = std::scoped_lock(state.activityMutex);
+            state.hasActivity = true;
+        }
+
+        state.activityCondition.notify_all();
+    }
+
+    static void PushInputEvent(GLFWwindow * window, InputEvent event) noexcept
+    {
+        auto & state    = GetState(window);
+        event.timestamp = std::chrono::steady_clock::now();
+
+        // The OS pump must never wait on the consumer, a stalled consumer loses events instead
+        if (!state.inputEvents.TryPush(event))
+        {
+            state.droppedInputEventCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        NotifyActivity(state);
+    }
+
+    // A drag over many events ends up as a single call with the final size
+    void DispatchCallbacks()
+    {
+        auto isMinimized = m_State->isMinimized.load();
+        if (isMinimized != m_State->isDispatchedMinimized)
+        {
+            m_State->isDispatchedMinimized = isMinimized;
+            if (m_State->minimizeCallback)
+            {
+                m_State->minimizeCallback(isMinimized);
+            }
+        }
+
+        if (std::exchange(m_State->hasPendingResize, false) && m_State->resizeCallback)
+        {
+            m_State->resizeCallback(m_State->width.load(), m_State->height.load());
+        }
+    }
+
+    std::unique_ptr<State> m_State;
 };
 } // namespace CuEngine::Platform::Impl
@@ -42,11 +42,81 @@ bool Window::ShouldClose() const noexcept
     return m_Pimpl->ShouldClose();
 }
 
-void Window::PollEvents() noexcept
+void Window::RequestClose() noexcept
+{
+    m_Pimpl->RequestClose();
+}
+
+void Window::PollEvents()
 {
     m_Pimpl->PollEvents();
 }
 
+void Window::WaitEvents(std::chrono::nanoseconds timeout)
+{
+    m_Pimpl->WaitEvents(timeout);
+}
+
+void Window::PostEmptyEvent() noexcept
+{
+    Impl::Window::PostEmptyEvent();
+}
+
+void Window::SetResizeCallback(std::function<void(std::uint32_t width, std::uint32_t height)> callback) noexcept
+{
+    m_Pimpl->SetResizeCallback(std::move(callback));
+}
+
+void Window::SetMinimizeCallback(std::function<void(bool isMinimized)> callback) noexcept
+{
+    m_Pimpl->SetMinimizeCallback(std::move(callback));
+}
+
+bool Window::PopInputEvent(InputEvent & event) noexcept
+{
+    return m_Pimpl->PopInputEvent(event);
+}
+
+std::uint64_t Window::GetDroppedInputEventCount() const noexcept
+{
+    return m_Pimpl->GetDroppedInputEventCount();
+}
+
+std::uint32_t Window::GetWidth() const noexcept
+{
+    return m_Pimpl->GetWidth();
+}
+
+std::uint32_t Window::GetHeight() const noexcept
+{
+    return m_Pimpl->GetHeight();
+}
+
+bool Window::IsMinimized() const noexcept
+{
+    return m_Pimpl->IsMinimized();
+}
+
+bool Window::IsFocused() const noexcept
+{
+    return m_Pimpl->IsFocused();
+}
+
+void Window::WaitForActivity(std::chrono::nanoseconds timeout) const
+{
+    m_Pimpl->WaitForActivity(timeout);
+}
+
+void Window::NotifyActivity() noexcept
+{
+    m_Pimpl->NotifyActivity();
+}
+
+bool Window::ConsumeActivity() noexcept
+{
+    return m_Pimpl->ConsumeActivity();
+}
+
 Impl::Window & Window::GetImpl() noexcept
 {
     return *m_Pimpl;
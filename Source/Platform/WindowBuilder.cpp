@@ -76,6 +76,13 @@ WindowBuilder & WindowBuilder::SetTitle(const std::string & title) noexcept
     return *this;
 }
 
+WindowBuilder & WindowBuilder::SetResizable(bool isResizable) noexcept
+{
+    m_Pimpl->SetResizable(isResizable);
+
+    return *this;
+}
+
 Window WindowBuilder::Build() const
 {
     return Window(m_Pimpl->Build());
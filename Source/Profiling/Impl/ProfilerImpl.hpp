@@ -0,0 +1,263 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "ThreadBufferImpl.hpp"
+
+#include <CuEngine/Profiling/Profiler.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CuEngine::Profiling::Impl
+{
+class Profiler
+{
+    struct Capture
+    {
+        std::filesystem::path path;
+        std::uint32_t         remainingFrames;
+        std::uint64_t         begin;
+    };
+
+public:
+    [[nodiscard]] static Profiler & GetInstance()
+    {
+        static auto profiler = Profiler();
+        return profiler;
+    }
+
+    void Record(const char * name, std::uint64_t begin, std::uint64_t end) noexcept
+    {
+        GetThreadBuffer().Push(name, begin, end);
+    }
+
+    void SetThreadName(std::string_view name)
+    {
+        auto & threadBuffer = GetThreadBuffer();
+
+        auto lock = std::lock_guard(m_Mutex);
+        threadBuffer.GetName() = name;
+    }
+
+    void MarkFrame()
+    {
+        auto & threadBuffer = GetThreadBuffer();
+        auto   timestamp    = GetTimestamp();
+        if (threadBuffer.GetLastFrame() != 0)
+        {
+            threadBuffer.Push("Frame", threadBuffer.GetLastFrame(), timestamp);
+        }
+        threadBuffer.SetLastFrame(timestamp);
+
+        if (!m_IsCapturing.load(std::memory_order_acquire))
+        {
+            return;
+        }
+
+        auto lock = std::unique_lock(m_Mutex);
+        if (m_IsCapturing.load(std::memory_order_relaxed) && --m_Capture.remainingFrames == 0)
+        {
+            FinishCapture(std::move(lock), timestamp);
+        }
+    }
+
+    void CaptureFrames(std::uint32_t frameCount, std::filesystem::path path)
+    {
+        if (frameCount == 0 || frameCount > ThreadBuffer::capacity)
+        {
+            throw std::runtime_error("Failed to start a profiler capture: invalid frame count");
+        }
+
+        auto lock = std::lock_guard(m_Mutex);
+        if (m_IsCapturing.load(std::memory_order_relaxed))
+        {
+            throw std::runtime_error("Failed to start a profiler capture: a capture is already running");
+        }
+
+        m_Capture = Capture{ .path = std::move(path), .remainingFrames = frameCount, .begin = GetTimestamp() };
+        m_IsCapturing.store(true, std::memory_order_release);
+    }
+
+    void FlushCapture()
+    {
+        auto lock = std::unique_lock(m_Mutex);
+        if (m_IsCapturing.load(std::memory_order_relaxed))
+        {
+            FinishCapture(std::move(lock), GetTimestamp());
+        }
+    }
+
+    [[nodiscard]] bool IsCapturing() const noexcept
+    {
+        return m_IsCapturing.load(std::memory_order_acquire);
+    }
+
+private:
+    struct CollectedThread
+    {
+        std::uint32_t               threadId;
+        std::string                 name;
+        std::vector<CollectedEvent> events;
+    };
+
+    explicit Profiler()
+        : m_IsCapturing(false),
+          m_Capture{ .path = {}, .remainingFrames = 0, .begin = 0 },
+          m_CalibrationTimestamp(GetTimestamp()),
+          m_CalibrationTime(std::chrono::steady_clock::now())
+    {}
+
+    // Buffers are shared with the registry so that events of exited threads still make it into a capture
+    [[nodiscard]] ThreadBuffer & GetThreadBuffer()
+    {
+        thread_local auto threadBuffer = std::shared_ptr<ThreadBuffer>();
+        if (!threadBuffer)
+        {
+            auto lock    = std::lock_guard(m_Mutex);
+            threadBuffer = std::make_shared<ThreadBuffer>(static_cast<std::uint32_t>(m_ThreadBuffers.size()));
+            m_ThreadBuffers.push_back(threadBuffer);
+        }
+
+        return *threadBuffer;
+    }
+
+    // Events are gathered under the lock, the file is written after it is released
+    void FinishCapture(std::unique_lock<std::mutex> lock, std::uint64_t end)
+    {
+        auto capture = std::move(m_Capture);
+        m_IsCapturing.store(false, std::memory_order_release);
+        auto threads = CollectThreads(capture.begin, end);
+        lock.unlock();
+
+        Write(capture.path, capture.begin, GetTicksPerMicrosecond(), threads);
+    }
+
+    // Time stamp counters tick at a constant rate, so the time since start-up is enough to calibrate them
+    [[nodiscard]] double GetTicksPerMicrosecond() const
+    {
+        auto ticks        = GetTimestamp() - m_CalibrationTimestamp;
+        auto microseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now()
+                                                                      - m_CalibrationTime)
+                                .count();
+
+        return microseconds > 0.0 ? static_cast<double>(ticks) / microseconds : 1.0;
+    }
+
+    [[nodiscard]] std::vector<CollectedThread> CollectThreads(std::uint64_t begin, std::uint64_t end) const
+    {
+        auto threads = std::vector<CollectedThread>();
+        for (auto && threadBuffer : m_ThreadBuffers)
+        {
+            auto thread = CollectedThread{ .threadId = threadBuffer->GetThreadId(),
+                                           .name     = threadBuffer->GetName(),
+                                           .events   = {} };
+            threadBuffer->Collect(begin, end, thread.events);
+            threads.push_back(std::move(thread));
+        }
+
+        return threads;
+    }
+
+    static void Write(const std::filesystem::path & path, std::uint64_t begin, double ticksPerMicrosecond,
+                      const std::vector<CollectedThread> & threads)
+    {
+        auto file = std::ofstream(path, std::ios::trunc);
+        if (!file)
+        {
+            throw std::runtime_error("Failed to open a profiler capture file");
+        }
+
+        auto toMicroseconds = [begin, ticksPerMicrosecond](std::uint64_t timestamp)
+        {
+            return static_cast<double>(timestamp - begin) / ticksPerMicrosecond;
+        };
+
+        file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        auto separator = "";
+        for (auto && thread : threads)
+        {
+            file << separator << R"({"name":"thread_name","ph":"M","pid":0,"tid":)" << thread.threadId
+                 << R"(,"args":{"name":)";
+            WriteString(file, thread.name);
+            file << "}}";
+            separator = ",";
+
+            for (auto && event : thread.events)
+            {
+                file << ",\n{\"name\":";
+                WriteString(file, event.name);
+                file << R"(,"ph":"X","pid":0,"tid":)" << thread.threadId << ",\"ts\":" << toMicroseconds(event.begin)
+                     << ",\"dur\":" << toMicroseconds(event.end) - toMicroseconds(event.begin) << "}";
+            }
+        }
+        file << "]}\n";
+
+        if (!file)
+        {
+            throw std::runtime_error("Failed to write a profiler capture file");
+        }
+    }
+
+    static void WriteString(std::ofstream & file, std::string_view string)
+    {
+        constexpr auto hexDigits = "0123456789abcdef";
+
+        file << '"';
+        for (auto character : string)
+        {
+            if (character == '"' || character == '\\')
+            {
+                file << '\\' << character;
+            }
+            else if (static_cast<unsigned char>(character) < 0x20)
+            {
+                file << "\\u00" << hexDigits[character >> 4] << hexDigits[character & 0xF];
+            }
+            else
+            {
+                file << character;
+            }
+        }
+        file << '"';
+    }
+
+private:
+    std::mutex                                 m_Mutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> m_ThreadBuffers;
+    std::atomic<bool>                          m_IsCapturing;
+    Capture                                    m_Capture;
+    std::uint64_t                              m_CalibrationTimestamp;
+    std::chrono::steady_clock::time_point      m_CalibrationTime;
+};
+} // namespace CuEngine::Profiling::Impl
@@ -0,0 +1,137 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Profiling/Profiler.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace CuEngine::Profiling::Impl
+{
+struct CollectedEvent
+{
+    const char *  name;
+    std::uint64_t begin;
+    std::uint64_t end;
+};
+
+// Written by its thread only, the oldest events are overwritten once the ring is full
+class ThreadBuffer
+{
+public:
+    static constexpr auto capacity = std::uint64_t(1) << 15;
+
+private:
+    struct Event
+    {
+        std::atomic<const char *>  name;
+        std::atomic<std::uint64_t> begin;
+        std::atomic<std::uint64_t> end;
+    };
+
+public:
+    explicit ThreadBuffer(std::uint32_t threadId)
+        : m_ThreadId(threadId),
+          m_Name("Thread " + std::to_string(threadId)),
+          m_LastFrame(0),
+          m_Head(0),
+          m_Events(std::make_unique<Event[]>(capacity))
+    {}
+
+    void Push(const char * name, std::uint64_t begin, std::uint64_t end) noexcept
+    {
+        auto head = m_Head.load(std::memory_order_relaxed);
+
+        // Orders the slot stores after the previous head store, readers then see the reuse when they re-read the head
+        std::atomic_thread_fence(std::memory_order_release);
+
+        auto & event = m_Events[head & (capacity - 1)];
+        event.name.store(name, std::memory_order_relaxed);
+        event.begin.store(begin, std::memory_order_relaxed);
+        event.end.store(end, std::memory_order_relaxed);
+        m_Head.store(head + 1, std::memory_order_release);
+    }
+
+    // Appends the events that lie within [begin, end], skipping the slots the thread reused while they were copied
+    void Collect(std::uint64_t begin, std::uint64_t end, std::vector<CollectedEvent> & events) const
+    {
+        auto head  = m_Head.load(std::memory_order_acquire);
+        auto first = head > capacity ? head - capacity : 0;
+
+        auto copies = std::vector<CollectedEvent>();
+        copies.reserve(head - first);
+        for (auto index = first; index < head; ++index)
+        {
+            auto & event = m_Events[index & (capacity - 1)];
+            copies.push_back(CollectedEvent{ .name  = event.name.load(std::memory_order_relaxed),
+                                             .begin = event.begin.load(std::memory_order_relaxed),
+                                             .end   = event.end.load(std::memory_order_relaxed) });
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        auto reusedHead = m_Head.load(std::memory_order_relaxed);
+        auto valid      = reusedHead >= capacity ? reusedHead - capacity + 1 : 0;
+        for (auto index = std::max(first, valid); index < head; ++index)
+        {
+            const auto & event = copies[index - first];
+            if (event.begin >= begin && event.end <= end)
+            {
+                events.push_back(event);
+            }
+        }
+    }
+
+    [[nodiscard]] std::uint32_t GetThreadId() const noexcept
+    {
+        return m_ThreadId;
+    }
+
+    // Guarded by the profiler's mutex
+    [[nodiscard]] std::string & GetName() noexcept
+    {
+        return m_Name;
+    }
+
+    [[nodiscard]] std::uint64_t GetLastFrame() const noexcept
+    {
+        return m_LastFrame;
+    }
+
+    void SetLastFrame(std::uint64_t lastFrame) noexcept
+    {
+        m_LastFrame = lastFrame;
+    }
+
+private:
+    std::uint32_t              m_ThreadId;
+    std::string                m_Name;
+    std::uint64_t              m_LastFrame;
+    std::atomic<std::uint64_t> m_Head;
+    std::unique_ptr<Event[]>   m_Events;
+};
+} // namespace CuEngine::Profiling::Impl
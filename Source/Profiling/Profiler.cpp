@@ -0,0 +1,58 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Impl/ProfilerImpl.hpp"
+
+namespace CuEngine::Profiling
+{
+
+void Record(const char * name, std::uint64_t begin, std::uint64_t end) noexcept
+{
+    Impl::Profiler::GetInstance().Record(name, begin, end);
+}
+
+void SetThreadName(std::string_view name)
+{
+    Impl::Profiler::GetInstance().SetThreadName(name);
+}
+
+void MarkFrame()
+{
+    Impl::Profiler::GetInstance().MarkFrame();
+}
+
+void CaptureFrames(std::uint32_t frameCount, std::filesystem::path path)
+{
+    Impl::Profiler::GetInstance().CaptureFrames(frameCount, std::move(path));
+}
+
+void FlushCapture()
+{
+    Impl::Profiler::GetInstance().FlushCapture();
+}
+
+bool IsCapturing() noexcept
+{
+    return Impl::Profiler::GetInstance().IsCapturing();
+}
+
+} // namespace CuEngine::Profiling
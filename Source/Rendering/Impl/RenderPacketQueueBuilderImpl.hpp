@@ -0,0 +1,79 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "RenderPacketQueueImpl.hpp"
+
+#include <CuEngine/Rendering/RenderPacketQueueBuilder.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+
+namespace CuEngine::Rendering::Impl
+{
+class RenderPacketQueueBuilder
+{
+public:
+    RenderPacketQueueBuilder() noexcept : m_DrawCapacity(4096), m_InstanceDataCapacity(1024 * 1024)
+    {}
+
+    RenderPacketQueueBuilder(const RenderPacketQueueBuilder &) noexcept = default;
+
+    RenderPacketQueueBuilder(RenderPacketQueueBuilder && other) noexcept = default;
+
+    RenderPacketQueueBuilder & operator=(const RenderPacketQueueBuilder &) noexcept = default;
+
+    RenderPacketQueueBuilder & operator=(RenderPacketQueueBuilder && other) noexcept = default;
+
+    ~RenderPacketQueueBuilder() noexcept = default;
+
+    RenderPacketQueueBuilder & SetDrawCapacity(std::uint32_t drawCapacity) noexcept
+    {
+        m_DrawCapacity = drawCapacity;
+
+        return *this;
+    }
+
+    RenderPacketQueueBuilder & SetInstanceDataCapacity(std::uint32_t instanceDataCapacity) noexcept
+    {
+        m_InstanceDataCapacity = instanceDataCapacity;
+
+        return *this;
+    }
+
+    [[nodiscard]] RenderPacketQueue Build() const
+    {
+        if (m_DrawCapacity == 0)
+        {
+            throw std::runtime_error("Render packets require room for at least one draw");
+        }
+
+        return RenderPacketQueue(std::make_unique<RenderPacketQueue::State>(m_DrawCapacity, m_InstanceDataCapacity));
+    }
+
+private:
+    std::uint32_t m_DrawCapacity;
+    std::uint32_t m_InstanceDataCapacity;
+};
+} // namespace CuEngine::Rendering::Impl
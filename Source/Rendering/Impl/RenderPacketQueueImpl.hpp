@@ -0,0 +1,180 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Profiling/Profiler.hpp>
+#include <CuEngine/Rendering/RenderPacketQueue.hpp>
+
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <utility>
+
+namespace CuEngine::Rendering::Impl
+{
+class RenderPacketQueue
+{
+public:
+    static constexpr auto packetCount = std::uint64_t(2);
+
+    struct State
+    {
+        explicit State(std::uint32_t drawCapacity, std::uint32_t instanceDataCapacity)
+            : packets{ RenderPacket(drawCapacity, instanceDataCapacity),
+                       RenderPacket(drawCapacity, instanceDataCapacity) },
+              writtenCount(0), readCount(0), readWaitCount(0), writeWaitCount(0), isClosed(false)
+        {}
+
+        std::array<RenderPacket, packetCount> packets;
+        std::uint64_t                         writtenCount;
+        std::uint64_t                         readCount;
+        std::uint64_t                         readWaitCount;
+        std::uint64_t                         writeWaitCount;
+        bool                                  isClosed;
+        mutable std::mutex                    mutex;
+        std::condition_variable_any           condition;
+    };
+
+    explicit RenderPacketQueue(std::unique_ptr<State> state) noexcept : m_State(std::move(state))
+    {}
+
+    RenderPacketQueue(const RenderPacketQueue &) = delete;
+
+    RenderPacketQueue(RenderPacketQueue && other) noexcept = default;
+
+    RenderPacketQueue & operator=(const RenderPacketQueue &) = delete;
+
+    RenderPacketQueue & operator=(RenderPacketQueue && other) noexcept
+    {
+        if (this != &other)
+        {
+            std::swap(m_State, other.m_State);
+        }
+
+        return *this;
+    }
+
+    ~RenderPacketQueue() noexcept = default;
+
+    [[nodiscard]] RenderPacket * BeginWrite(std::uint64_t frame, std::stop_token stopToken)
+    {
+        CU_PROFILE_SCOPE("WaitForRenderPacket");
+
+        auto lock    = std::unique_lock(m_State->mutex);
+        auto isReady = [this]()
+        {
+            return m_State->isClosed || m_State->writtenCount - m_State->readCount < packetCount;
+        };
+        if (!isReady())
+        {
+            ++m_State->writeWaitCount;
+            if (!m_State->condition.wait(lock, stopToken, isReady))
+            {
+                return nullptr;
+            }
+        }
+        if (m_State->isClosed)
+        {
+            return nullptr;
+        }
+
+        // The render thread is done with this packet, it never touches the one being written
+        auto & packet = m_State->packets[m_State->writtenCount % packetCount];
+        lock.unlock();
+
+        packet.Reset(frame);
+
+        return &packet;
+    }
+
+    void EndWrite() noexcept
+    {
+        {
+            auto lock = std::lock_guard(m_State->mutex);
+            ++m_State->writtenCount;
+        }
+        m_State->condition.notify_all();
+    }
+
+    [[nodiscard]] const RenderPacket * BeginRead(std::stop_token stopToken)
+    {
+        auto lock    = std::unique_lock(m_State->mutex);
+        auto isReady = [this]()
+        {
+            return m_State->isClosed || m_State->readCount < m_State->writtenCount;
+        };
+        if (!isReady())
+        {
+            ++m_State->readWaitCount;
+            if (!m_State->condition.wait(lock, stopToken, isReady))
+            {
+                return nullptr;
+            }
+        }
+        if (m_State->readCount == m_State->writtenCount)
+        {
+            return nullptr;
+        }
+
+        return &m_State->packets[m_State->readCount % packetCount];
+    }
+
+    void EndRead() noexcept
+    {
+        {
+            auto lock = std::lock_guard(m_State->mutex);
+            ++m_State->readCount;
+        }
+        m_State->condition.notify_all();
+    }
+
+    void Close() noexcept
+    {
+        {
+            auto lock         = std::lock_guard(m_State->mutex);
+            m_State->isClosed = true;
+        }
+        m_State->condition.notify_all();
+    }
+
+    [[nodiscard]] std::uint64_t GetReadWaitCount() const noexcept
+    {
+        auto lock = std::lock_guard(m_State->mutex);
+
+        return m_State->readWaitCount;
+    }
+
+    [[nodiscard]] std::uint64_t GetWriteWaitCount() const noexcept
+    {
+        auto lock = std::lock_guard(m_State->mutex);
+
+        return m_State->writeWaitCount;
+    }
+
+private:
+    std::unique_ptr<State> m_State;
+};
+} // namespace CuEngine::Rendering::Impl
@@ -0,0 +1,77 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Impl/RenderPacketQueueImpl.hpp"
+
+namespace CuEngine::Rendering
+{
+RenderPacketQueue::RenderPacketQueue(Impl::RenderPacketQueue && renderPacketQueue) noexcept
+    : m_Pimpl(std::move(renderPacketQueue))
+{}
+
+RenderPacketQueue::RenderPacketQueue(RenderPacketQueue && other) noexcept = default;
+
+RenderPacketQueue & RenderPacketQueue::operator=(RenderPacketQueue && other) noexcept = default;
+
+RenderPacketQueue::~RenderPacketQueue() noexcept = default;
+
+RenderPacket * RenderPacketQueue::BeginWrite(std::uint64_t frame, std::stop_token stopToken)
+{
+    return m_Pimpl->BeginWrite(frame, std::move(stopToken));
+}
+
+void RenderPacketQueue::EndWrite() noexcept
+{
+    m_Pimpl->EndWrite();
+}
+
+const RenderPacket * RenderPacketQueue::BeginRead(std::stop_token stopToken)
+{
+    return m_Pimpl->BeginRead(std::move(stopToken));
+}
+
+void RenderPacketQueue::EndRead() noexcept
+{
+    m_Pimpl->EndRead();
+}
+
+void RenderPacketQueue::Close() noexcept
+{
+    m_Pimpl->Close();
+}
+
+std::uint64_t RenderPacketQueue::GetReadWaitCount() const noexcept
+{
+    return m_Pimpl->GetReadWaitCount();
+}
+
+std::uint64_t RenderPacketQueue::GetWriteWaitCount() const noexcept
+{
+    return m_Pimpl->GetWriteWaitCount();
+}
+
+Impl::RenderPacketQueue & RenderPacketQueue::GetImpl() noexcept
+{
+    return *m_Pimpl;
+}
+
+} // namespace CuEngine::Rendering
@@ -0,0 +1,76 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Impl/RenderPacketQueueBuilderImpl.hpp"
+
+namespace CuEngine::Rendering
+{
+RenderPacketQueueBuilder::RenderPacketQueueBuilder() noexcept : m_Pimpl()
+{}
+
+RenderPacketQueueBuilder::RenderPacketQueueBuilder(const RenderPacketQueueBuilder & other) noexcept = default;
+
+RenderPacketQueueBuilder::RenderPacketQueueBuilder(RenderPacketQueueBuilder && other) noexcept
+    : m_Pimpl(std::move(other.m_Pimpl))
+{}
+
+RenderPacketQueueBuilder & RenderPacketQueueBuilder::operator=(
+    const RenderPacketQueueBuilder & other) noexcept = default;
+
+RenderPacketQueueBuilder & RenderPacketQueueBuilder::operator=(RenderPacketQueueBuilder && other) noexcept
+{
+    if (this != &other)
+    {
+        m_Pimpl = std::move(other.m_Pimpl);
+    }
+
+    return *this;
+}
+
+RenderPacketQueueBuilder::~RenderPacketQueueBuilder() noexcept = default;
+
+RenderPacketQueueBuilder & RenderPacketQueueBuilder::SetDrawCapacity(std::uint32_t drawCapacity) noexcept
+{
+    m_Pimpl->SetDrawCapacity(drawCapacity);
+
+    return *this;
+}
+
+RenderPacketQueueBuilder & RenderPacketQueueBuilder::SetInstanceDataCapacity(
+    std::uint32_t instanceDataCapacity) noexcept
+{
+    m_Pimpl->SetInstanceDataCapacity(instanceDataCapacity);
+
+    return *this;
+}
+
+RenderPacketQueue RenderPacketQueueBuilder::Build() const
+{
+    return RenderPacketQueue(m_Pimpl->Build());
+}
+
+Impl::RenderPacketQueueBuilder & RenderPacketQueueBuilder::GetImpl() noexcept
+{
+    return *m_Pimpl;
+}
+
+} // namespace CuEngine::Rendering
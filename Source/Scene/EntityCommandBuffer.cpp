@@ -0,0 +1,71 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Impl/EntityCommandBufferImpl.hpp"
+
+namespace CuEngine::Scene
+{
+EntityCommandBuffer::EntityCommandBuffer() : m_Pimpl()
+{}
+
+EntityCommandBuffer::EntityCommandBuffer(EntityCommandBuffer && other) noexcept = default;
+
+EntityCommandBuffer & EntityCommandBuffer::operator=(EntityCommandBuffer && other) noexcept = default;
+
+EntityCommandBuffer::~EntityCommandBuffer() noexcept = default;
+
+void EntityCommandBuffer::CreateEntity(std::span<const ComponentInfo * const> infos, std::span<void * const> values)
+{
+    m_Pimpl->CreateEntity(infos, values);
+}
+
+void EntityCommandBuffer::DestroyEntity(Entity entity)
+{
+    m_Pimpl->DestroyEntity(entity);
+}
+
+void EntityCommandBuffer::AddComponent(Entity entity, const ComponentInfo & info, void * value)
+{
+    m_Pimpl->AddComponent(entity, info, value);
+}
+
+void EntityCommandBuffer::RemoveComponent(Entity entity, const ComponentInfo & info)
+{
+    m_Pimpl->RemoveComponent(entity, info);
+}
+
+void EntityCommandBuffer::Playback(World & world)
+{
+    m_Pimpl->Playback(world.GetImpl());
+}
+
+std::uint32_t EntityCommandBuffer::GetCommandCount() const noexcept
+{
+    return m_Pimpl->GetCommandCount();
+}
+
+Impl::EntityCommandBuffer & EntityCommandBuffer::GetImpl() noexcept
+{
+    return *m_Pimpl;
+}
+
+} // namespace CuEngine::Scene
@@ -0,0 +1,254 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Scene/ChunkView.hpp>
+#include <CuEngine/Scene/Component.hpp>
+#include <CuEngine/Scene/Entity.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace CuEngine::Scene::Impl
+{
+// Small enough that a chunk stays in L1 while a query walks its columns
+inline constexpr auto chunkSize = std::size_t(16 * 1024);
+
+struct alignas(maxComponentAlignment) ChunkMemory
+{
+    std::byte bytes[chunkSize];
+};
+
+struct Chunk
+{
+    std::unique_ptr<ChunkMemory> memory;
+    std::uint32_t                entityCount;
+};
+
+// Every chunk but the last is full: removal moves the archetype's last entity into the hole, so queries never see gaps
+class Archetype
+{
+public:
+    Archetype(const ComponentMask & mask, std::vector<const ComponentInfo *> && components)
+        : m_Mask(mask), m_Components(std::move(components)), m_ColumnOffsets(), m_ComponentSizes(), m_EntityOffset(0),
+          m_Capacity(0), m_Chunks(), m_SpareMemory(), m_AddTransitions(), m_RemoveTransitions()
+    {
+        m_ColumnOffsets.fill(ChunkView::missingColumn);
+        m_AddTransitions.fill(nullptr);
+        m_RemoveTransitions.fill(nullptr);
+
+        auto rowSize = sizeof(Entity);
+        for (auto * component : m_Components)
+        {
+            rowSize += component->size;
+        }
+
+        // Padding between the columns can push the estimate over the chunk, so it is trimmed until it fits
+        m_Capacity = static_cast<std::uint32_t>(chunkSize / rowSize);
+        while (m_Capacity != 0 && Layout(m_Capacity) > chunkSize)
+        {
+            --m_Capacity;
+        }
+        if (m_Capacity == 0)
+        {
+            throw std::runtime_error("Failed to create an archetype, a single entity does not fit a chunk");
+        }
+
+        static_cast<void>(Layout(m_Capacity));
+    }
+
+    Archetype(const Archetype &) = delete;
+
+    Archetype(Archetype &&) = delete;
+
+    Archetype & operator=(const Archetype &) = delete;
+
+    Archetype & operator=(Archetype &&) = delete;
+
+    ~Archetype() noexcept
+    {
+        for (auto && chunk : m_Chunks)
+        {
+            for (auto row = std::uint32_t(0); row < chunk.entityCount; ++row)
+            {
+                for (auto * component : m_Components)
+                {
+                    component->destroy(GetComponent(chunk, row, *component));
+                }
+            }
+        }
+    }
+
+    // The new row is uninitialized apart from its entity, the caller constructs every component in it
+    [[nodiscard]] std::pair<std::uint32_t, std::uint32_t> AllocateRow(Entity entity)
+    {
+        if (m_Chunks.empty() || m_Chunks.back().entityCount == m_Capacity)
+        {
+            auto memory = m_SpareMemory ? std::move(m_SpareMemory) : std::make_unique_for_overwrite<ChunkMemory>();
+            m_Chunks.push_back(Chunk{ .memory = std::move(memory), .entityCount = 0 });
+        }
+
+        auto   chunkIndex       = static_cast<std::uint32_t>(m_Chunks.size() - 1);
+        auto & chunk            = m_Chunks.back();
+        auto   row              = chunk.entityCount++;
+        GetEntities(chunk)[row] = entity;
+
+        return { chunkIndex, row };
+    }
+
+    // Returns the entity that moved into the row to keep the chunks dense, if any. Without destroying, the caller has
+    // already moved the components out
+    [[nodiscard]] Entity RemoveRow(std::uint32_t chunkIndex, std::uint32_t row, bool isDestroying) noexcept
+    {
+        auto & chunk = m_Chunks[chunkIndex];
+        if (isDestroying)
+        {
+            for (auto * component : m_Components)
+            {
+                component->destroy(GetComponent(chunk, row, *component));
+            }
+        }
+
+        auto & lastChunk = m_Chunks.back();
+        auto   lastRow   = lastChunk.entityCount - 1;
+        auto   moved     = nullEntity;
+        if (&chunk != &lastChunk || row != lastRow)
+        {
+            for (auto * component : m_Components)
+            {
+                auto * source = GetComponent(lastChunk, lastRow, *component);
+                component->moveConstruct(GetComponent(chunk, row, *component), source);
+                component->destroy(source);
+            }
+            moved                   = GetEntities(lastChunk)[lastRow];
+            GetEntities(chunk)[row] = moved;
+        }
+
+        // One empty chunk is kept, so an entity moving back and forth at a chunk boundary does not allocate each time
+        if (--lastChunk.entityCount == 0)
+        {
+            m_SpareMemory = std::move(lastChunk.memory);
+            m_Chunks.pop_back();
+        }
+
+        return moved;
+    }
+
+    [[nodiscard]] void * GetComponent(const Chunk & chunk, std::uint32_t row, const ComponentInfo & info) const noexcept
+    {
+        return chunk.memory->bytes + m_ColumnOffsets[info.id] + std::size_t(row) * info.size;
+    }
+
+    [[nodiscard]] void * FindComponent(std::uint32_t chunkIndex, std::uint32_t row, ComponentId id) const noexcept
+    {
+        auto offset = m_ColumnOffsets[id];
+        if (offset == ChunkView::missingColumn)
+        {
+            return nullptr;
+        }
+
+        return m_Chunks[chunkIndex].memory->bytes + offset + std::size_t(row) * m_ComponentSizes[id];
+    }
+
+    [[nodiscard]] Chunk & GetChunk(std::uint32_t chunkIndex) noexcept
+    {
+        return m_Chunks[chunkIndex];
+    }
+
+    [[nodiscard]] const std::vector<Chunk> & GetChunks() const noexcept
+    {
+        return m_Chunks;
+    }
+
+    [[nodiscard]] ChunkView GetChunkView(const Chunk & chunk) const noexcept
+    {
+        return ChunkView(chunk.memory->bytes, m_ColumnOffsets, m_EntityOffset, chunk.entityCount);
+    }
+
+    [[nodiscard]] const ComponentMask & GetMask() const noexcept
+    {
+        return m_Mask;
+    }
+
+    [[nodiscard]] const std::vector<const ComponentInfo *> & GetComponents() const noexcept
+    {
+        return m_Components;
+    }
+
+    [[nodiscard]] std::uint32_t GetCapacity() const noexcept
+    {
+        return m_Capacity;
+    }
+
+    // Adding or removing a given component always leads to the same archetype, so the lookup is cached per id
+    [[nodiscard]] Archetype *& GetAddTransition(ComponentId id) noexcept
+    {
+        return m_AddTransitions[id];
+    }
+
+    [[nodiscard]] Archetype *& GetRemoveTransition(ComponentId id) noexcept
+    {
+        return m_RemoveTransitions[id];
+    }
+
+private:
+    // Entities first, then the components in id order, every column aligned for its type. Returns the size used
+    std::size_t Layout(std::uint32_t capacity) noexcept
+    {
+        m_EntityOffset = 0;
+
+        auto offset = sizeof(Entity) * capacity;
+        for (auto * component : m_Components)
+        {
+            auto alignment                  = std::size_t(component->alignment);
+            offset                          = (offset + alignment - 1) / alignment * alignment;
+            m_ColumnOffsets[component->id]  = static_cast<std::uint32_t>(offset);
+            m_ComponentSizes[component->id] = component->size;
+            offset                         += std::size_t(component->size) * capacity;
+        }
+
+        return offset;
+    }
+
+    [[nodiscard]] Entity * GetEntities(Chunk & chunk) const noexcept
+    {
+        return reinterpret_cast<Entity *>(chunk.memory->bytes + m_EntityOffset);
+    }
+
+    ComponentMask                                    m_Mask;
+    std::vector<const ComponentInfo *>               m_Components;
+    ChunkView::ColumnOffsets                         m_ColumnOffsets;
+    std::array<std::uint32_t, maxComponentTypeCount> m_ComponentSizes;
+    std::uint32_t                                    m_EntityOffset;
+    std::uint32_t                                    m_Capacity;
+    std::vector<Chunk>                               m_Chunks;
+    std::unique_ptr<ChunkMemory>                     m_SpareMemory;
+    std::array<Archetype *, maxComponentTypeCount>   m_AddTransitions;
+    std::array<Archetype *, maxComponentTypeCount>   m_RemoveTransitions;
+};
+} // namespace CuEngine::Scene::Impl
@@ -0,0 +1,268 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "ArchetypeImpl.hpp"
+#include "WorldImpl.hpp"
+
+#include <CuEngine/Scene/EntityCommandBuffer.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace CuEngine::Scene::Impl
+{
+class EntityCommandBuffer
+{
+public:
+    enum class CommandType : std::uint8_t
+    {
+        CreateEntity,
+        DestroyEntity,
+        AddComponent,
+        RemoveComponent
+    };
+
+    struct Command
+    {
+        CommandType           type;
+        Entity                entity;
+        const ComponentInfo * info;
+        std::uint32_t         firstValue;
+        std::uint32_t         valueCount;
+    };
+
+    // Recorded components live in chunk-sized blocks, which are kept and reused from one playback to the next
+    struct Value
+    {
+        const ComponentInfo * info;
+        void *                component;
+    };
+
+    struct State
+    {
+        std::vector<Command>                      commands;
+        std::vector<Value>                        values;
+        std::vector<std::unique_ptr<ChunkMemory>> blocks;
+        std::uint32_t                             blockIndex;
+        std::size_t                               blockOffset;
+        std::uint32_t                             destroyedValueCount;
+        std::vector<const ComponentInfo *>        infos;
+        std::vector<void *>                       components;
+        mutable std::mutex                        mutex;
+    };
+
+    EntityCommandBuffer() : m_State(std::make_unique<State>())
+    {
+        m_State->blockIndex          = 0;
+        m_State->blockOffset         = 0;
+        m_State->destroyedValueCount = 0;
+    }
+
+    EntityCommandBuffer(const EntityCommandBuffer &) = delete;
+
+    EntityCommandBuffer(EntityCommandBuffer && other) noexcept = default;
+
+    EntityCommandBuffer & operator=(const EntityCommandBuffer &) = delete;
+
+    EntityCommandBuffer & operator=(EntityCommandBuffer && other) noexcept
+    {
+        if (this != &other)
+        {
+            std::swap(m_State, other.m_State);
+        }
+
+        return *this;
+    }
+
+    ~EntityCommandBuffer() noexcept
+    {
+        if (!m_State)
+        {
+            return;
+        }
+
+        Clear();
+    }
+
+    void CreateEntity(std::span<const ComponentInfo * const> infos, std::span<void * const> values)
+    {
+        auto lock       = std::lock_guard(m_State->mutex);
+        auto firstValue = static_cast<std::uint32_t>(m_State->values.size());
+        for (auto index = std::size_t(0); index < infos.size(); ++index)
+        {
+            StoreValue(*infos[index], values[index]);
+        }
+
+        m_State->commands.push_back(Command{ .type       = CommandType::CreateEntity,
+                                             .entity     = nullEntity,
+                                             .info       = nullptr,
+                                             .firstValue = firstValue,
+                                             .valueCount = static_cast<std::uint32_t>(infos.size()) });
+    }
+
+    void DestroyEntity(Entity entity)
+    {
+        auto lock = std::lock_guard(m_State->mutex);
+        m_State->commands.push_back(Command{
+            .type = CommandType::DestroyEntity, .entity = entity, .info = nullptr, .firstValue = 0, .valueCount = 0 });
+    }
+
+    void AddComponent(Entity entity, const ComponentInfo & info, void * value)
+    {
+        auto lock       = std::lock_guard(m_State->mutex);
+        auto firstValue = static_cast<std::uint32_t>(m_State->values.size());
+        StoreValue(info, value);
+
+        m_State->commands.push_back(Command{ .type       = CommandType::AddComponent,
+                                             .entity     = entity,
+                                             .info       = &info,
+                                             .firstValue = firstValue,
+                                             .valueCount = 1 });
+    }
+
+    void RemoveComponent(Entity entity, const ComponentInfo & info)
+    {
+        auto lock = std::lock_guard(m_State->mutex);
+        m_State->commands.push_back(Command{
+            .type = CommandType::RemoveComponent, .entity = entity, .info = &info, .firstValue = 0, .valueCount = 0 });
+    }
+
+    // Commands on entities destroyed in the meantime, e.g. by an earlier command, are dropped
+    void Playback(World & world)
+    {
+        auto lock = std::lock_guard(m_State->mutex);
+        try
+        {
+            for (auto && command : m_State->commands)
+            {
+                switch (command.type)
+                {
+                    case CommandType::CreateEntity:
+                        m_State->infos.clear();
+                        m_State->components.clear();
+                        for (auto index = command.firstValue; index < command.firstValue + command.valueCount; ++index)
+                        {
+                            m_State->infos.push_back(m_State->values[index].info);
+                            m_State->components.push_back(m_State->values[index].component);
+                        }
+                        static_cast<void>(world.CreateEntity(m_State->infos, m_State->components));
+                        break;
+                    case CommandType::DestroyEntity:
+                        world.DestroyEntity(command.entity);
+                        break;
+                    case CommandType::AddComponent:
+                        if (world.IsAlive(command.entity))
+                        {
+                            world.AddComponent(command.entity, *command.info,
+                                               m_State->values[command.firstValue].component);
+                        }
+                        break;
+                    case CommandType::RemoveComponent:
+                        if (world.IsAlive(command.entity))
+                        {
+                            world.RemoveComponent(command.entity, *command.info);
+                        }
+                        break;
+                }
+
+                DestroyValues(command.firstValue + command.valueCount);
+            }
+        }
+        catch (...)
+        {
+            Clear();
+            throw;
+        }
+
+        Clear();
+    }
+
+    [[nodiscard]] std::uint32_t GetCommandCount() const noexcept
+    {
+        auto lock = std::lock_guard(m_State->mutex);
+
+        return static_cast<std::uint32_t>(m_State->commands.size());
+    }
+
+private:
+    void StoreValue(const ComponentInfo & info, void * value)
+    {
+        if (info.size > chunkSize)
+        {
+            throw std::runtime_error("Failed to record a component, it is larger than a chunk");
+        }
+
+        auto offset = (m_State->blockOffset + info.alignment - 1) / info.alignment * info.alignment;
+        if (m_State->blocks.empty() || offset + info.size > chunkSize)
+        {
+            if (!m_State->blocks.empty())
+            {
+                ++m_State->blockIndex;
+            }
+            if (m_State->blockIndex == m_State->blocks.size())
+            {
+                m_State->blocks.push_back(std::make_unique_for_overwrite<ChunkMemory>());
+            }
+            offset = 0;
+        }
+
+        // Recorded before constructing, so a failing push_back cannot leave a component behind that nobody destroys
+        auto * component = m_State->blocks[m_State->blockIndex]->bytes + offset;
+        m_State->values.push_back(Value{ .info = &info, .component = component });
+        info.moveConstruct(component, value);
+        m_State->blockOffset = offset + info.size;
+    }
+
+    // Values are consumed in recording order, so everything before the end has been moved into the world
+    void DestroyValues(std::uint32_t end) noexcept
+    {
+        for (auto index = m_State->destroyedValueCount; index < end; ++index)
+        {
+            auto & value = m_State->values[index];
+            value.info->destroy(value.component);
+        }
+        m_State->destroyedValueCount = std::max(m_State->destroyedValueCount, end);
+    }
+
+    void Clear() noexcept
+    {
+        DestroyValues(static_cast<std::uint32_t>(m_State->values.size()));
+
+        m_State->commands.clear();
+        m_State->values.clear();
+        m_State->blockIndex          = 0;
+        m_State->blockOffset         = 0;
+        m_State->destroyedValueCount = 0;
+    }
+
+    std::unique_ptr<State> m_State;
+};
+} // namespace CuEngine::Scene::Impl
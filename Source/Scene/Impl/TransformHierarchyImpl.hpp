@@ -0,0 +1,558 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Jobs/Scheduler.hpp>
+#include <CuEngine/Math/Batch.hpp>
+#include <CuEngine/Math/Matrix.hpp>
+#include <CuEngine/Scene/TransformHierarchy.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace CuEngine::Scene::Impl
+{
+class TransformHierarchy
+{
+public:
+    static constexpr auto invalidIndex = Scene::TransformHierarchy::invalidIndex;
+
+    // Below this many dirty nodes a level is cheaper to update than to hand out to workers
+    static constexpr auto minParallelCount = std::uint32_t(4096);
+    static constexpr auto batchSize        = std::uint32_t(1024);
+
+    struct State
+    {
+        // Indexed by slot, which is what node handles refer to and which never moves
+        std::vector<std::uint32_t> generations;
+        std::vector<std::uint32_t> slotIndices;
+        std::vector<std::uint32_t> slotParents;
+        std::vector<std::uint32_t> freeSlots;
+
+        // Destroyed slots are only reused once the layout no longer refers to them
+        std::vector<std::uint32_t> destroyedSlots;
+
+        // Indexed by position in the layout, destroyed nodes leave an invalid slot behind until it is re-sorted
+        std::vector<std::uint32_t>  slots;
+        std::vector<std::uint32_t>  parents;
+        std::vector<std::uint32_t>  firstChildren;
+        std::vector<std::uint32_t>  childCounts;
+        std::vector<LocalTransform> locals;
+        std::vector<Math::Mat4>     worlds;
+        std::vector<std::uint8_t>   dirtyFlags;
+        std::vector<std::uint32_t>  dirtyIndices;
+
+        // Level n covers the indices from levelOffsets[n] up to levelOffsets[n + 1]
+        std::vector<std::uint32_t> levelOffsets;
+
+        // Reused by every update
+        std::vector<std::vector<TransformRange>> levelRanges;
+        std::vector<TransformRange>              batchPieces;
+        std::vector<std::uint32_t>               batchOffsets;
+        std::vector<std::uint32_t>               childOffsets;
+        std::vector<std::uint32_t>               childSlots;
+        std::vector<std::uint32_t>               orderedSlots;
+
+        std::vector<TransformRange> changedRanges;
+        std::uint32_t               nodeCount;
+        std::uint32_t               updatedCount;
+        bool                        isLayoutDirty;
+    };
+
+    TransformHierarchy() : m_State(std::make_unique<State>())
+    {
+        m_State->levelOffsets  = { 0 };
+        m_State->nodeCount     = 0;
+        m_State->updatedCount  = 0;
+        m_State->isLayoutDirty = false;
+    }
+
+    TransformHierarchy(const TransformHierarchy &) = delete;
+
+    TransformHierarchy(TransformHierarchy && other) noexcept = default;
+
+    TransformHierarchy & operator=(const TransformHierarchy &) = delete;
+
+    TransformHierarchy & operator=(TransformHierarchy && other) noexcept
+    {
+        if (this != &other)
+        {
+            std::swap(m_State, other.m_State);
+        }
+
+        return *this;
+    }
+
+    ~TransformHierarchy() noexcept = default;
+
+    [[nodiscard]] TransformNode CreateNode(TransformNode parent, const LocalTransform & local)
+    {
+        if (parent != nullTransformNode && !IsAlive(parent))
+        {
+            throw std::runtime_error("Failed to create a transform node, the parent is destroyed");
+        }
+
+        auto slot = std::uint32_t(0);
+        if (!m_State->freeSlots.empty())
+        {
+            slot = m_State->freeSlots.back();
+            m_State->freeSlots.pop_back();
+        }
+        else
+        {
+            slot = static_cast<std::uint32_t>(m_State->generations.size());
+            m_State->generations.push_back(0);
+            m_State->slotIndices.push_back(invalidIndex);
+            m_State->slotParents.push_back(invalidIndex);
+        }
+
+        // Appended for now, the next update sorts it in below its parent
+        m_State->slotIndices[slot] = static_cast<std::uint32_t>(m_State->slots.size());
+        m_State->slotParents[slot] = parent == nullTransformNode ? invalidIndex : parent.index;
+        m_State->slots.push_back(slot);
+        m_State->parents.push_back(invalidIndex);
+        m_State->firstChildren.push_back(0);
+        m_State->childCounts.push_back(0);
+        m_State->locals.push_back(local);
+        m_State->worlds.emplace_back();
+        m_State->dirtyFlags.push_back(0);
+
+        ++m_State->nodeCount;
+        m_State->isLayoutDirty = true;
+
+        return TransformNode{ .index = slot, .generation = m_State->generations[slot] };
+    }
+
+    void DestroyNode(TransformNode node) noexcept
+    {
+        if (!IsAlive(node))
+        {
+            return;
+        }
+
+        auto & index = m_State->slotIndices[node.index];
+        m_State->slots[index] = invalidIndex;
+        index                 = invalidIndex;
+
+        ++m_State->generations[node.index];
+        m_State->destroyedSlots.push_back(node.index);
+
+        --m_State->nodeCount;
+        m_State->isLayoutDirty = true;
+    }
+
+    void SetParent(TransformNode node, TransformNode parent)
+    {
+        if (!IsAlive(node) || (parent != nullTransformNode && !IsAlive(parent)))
+        {
+            throw std::runtime_error("Failed to reparent a transform node, a node is destroyed");
+        }
+
+        auto parentSlot = parent == nullTransformNode ? invalidIndex : parent.index;
+        for (auto ancestor = parentSlot; ancestor != invalidIndex; ancestor = m_State->slotParents[ancestor])
+        {
+            if (ancestor == node.index)
+            {
+                throw std::runtime_error("Failed to reparent a transform node, the parent is one of its descendants");
+            }
+        }
+
+        if (m_State->slotParents[node.index] != parentSlot)
+        {
+            m_State->slotParents[node.index] = parentSlot;
+            m_State->isLayoutDirty           = true;
+        }
+    }
+
+    void SetLocalTransform(TransformNode node, const LocalTransform & local)
+    {
+        if (!IsAlive(node))
+        {
+            throw std::runtime_error("Failed to set the local transform of a destroyed node");
+        }
+
+        auto index             = m_State->slotIndices[node.index];
+        m_State->locals[index] = local;
+
+        // A pending layout change recomputes everything anyway
+        if (!m_State->isLayoutDirty && m_State->dirtyFlags[index] == 0)
+        {
+            m_State->dirtyFlags[index] = 1;
+            m_State->dirtyIndices.push_back(index);
+        }
+    }
+
+    [[nodiscard]] const LocalTransform * GetLocalTransform(TransformNode node) const noexcept
+    {
+        return IsAlive(node) ? &m_State->locals[m_State->slotIndices[node.index]] : nullptr;
+    }
+
+    [[nodiscard]] bool IsAlive(TransformNode node) const noexcept
+    {
+        return node.index < m_State->generations.size() && m_State->generations[node.index] == node.generation;
+    }
+
+    void Update(Jobs::Scheduler * scheduler)
+    {
+        if (m_State->isLayoutDirty)
+        {
+            RebuildLayout();
+        }
+        else
+        {
+            CollectDirtyNodes();
+        }
+
+        m_State->updatedCount = 0;
+
+        auto levelCount = GetLevelCount();
+        for (auto level = std::uint32_t(0); level < levelCount; ++level)
+        {
+            auto & ranges = m_State->levelRanges[level];
+            if (ranges.empty())
+            {
+                continue;
+            }
+
+            // A node can be dirty on its own and below a dirty parent, it must still be computed only once
+            Coalesce(ranges);
+            UpdateLevel(level, ranges, scheduler);
+
+            // Children of consecutive parents are consecutive themselves, so the next level gets long runs
+            if (level + 1 < levelCount)
+            {
+                auto & next = m_State->levelRanges[level + 1];
+                for (auto range : ranges)
+                {
+                    for (auto index = range.first; index < range.first + range.count; ++index)
+                    {
+                        if (m_State->childCounts[index] != 0)
+                        {
+                            Append(next, { m_State->firstChildren[index], m_State->childCounts[index] });
+                        }
+                    }
+                }
+            }
+
+            for (auto range : ranges)
+            {
+                m_State->updatedCount += range.count;
+                m_State->changedRanges.push_back(range);
+            }
+            ranges.clear();
+        }
+
+        Coalesce(m_State->changedRanges);
+    }
+
+    [[nodiscard]] const Math::Mat4 * GetWorldMatrix(TransformNode node) const noexcept
+    {
+        return IsAlive(node) ? &m_State->worlds[m_State->slotIndices[node.index]] : nullptr;
+    }
+
+    [[nodiscard]] std::uint32_t GetMatrixIndex(TransformNode node) const noexcept
+    {
+        return IsAlive(node) ? m_State->slotIndices[node.index] : invalidIndex;
+    }
+
+    [[nodiscard]] std::span<const Math::Mat4> GetWorldMatrices() const noexcept
+    {
+        return m_State->worlds;
+    }
+
+    [[nodiscard]] std::span<const TransformRange> GetChangedRanges() const noexcept
+    {
+        return m_State->changedRanges;
+    }
+
+    void ClearChangedRanges() noexcept
+    {
+        m_State->changedRanges.clear();
+    }
+
+    [[nodiscard]] std::uint32_t GetNodeCount() const noexcept
+    {
+        return m_State->nodeCount;
+    }
+
+    [[nodiscard]] std::uint32_t GetLevelCount() const noexcept
+    {
+        return static_cast<std::uint32_t>(m_State->levelOffsets.size() - 1);
+    }
+
+    [[nodiscard]] std::uint32_t GetUpdatedCount() const noexcept
+    {
+        return m_State->updatedCount;
+    }
+
+private:
+    // Sorts the ranges and merges the overlapping and adjacent ones
+    static void Coalesce(std::vector<TransformRange> & ranges) noexcept
+    {
+        std::ranges::sort(ranges, {}, &TransformRange::first);
+
+        auto count = std::size_t(0);
+        for (auto range : ranges)
+        {
+            if (count != 0 && range.first <= ranges[count - 1].first + ranges[count - 1].count)
+            {
+                auto & last = ranges[count - 1];
+                last.count  = std::max(last.first + last.count, range.first + range.count) - last.first;
+            }
+            else
+            {
+                ranges[count++] = range;
+            }
+        }
+        ranges.resize(count);
+    }
+
+    static void Append(std::vector<TransformRange> & ranges, TransformRange range)
+    {
+        if (!ranges.empty() && ranges.back().first + ranges.back().count == range.first)
+        {
+            ranges.back().count += range.count;
+        }
+        else
+        {
+            ranges.push_back(range);
+        }
+    }
+
+    // Files every explicitly dirty node under its level
+    void CollectDirtyNodes()
+    {
+        auto & offsets = m_State->levelOffsets;
+        for (auto index : m_State->dirtyIndices)
+        {
+            auto level = std::upper_bound(offsets.begin() + 1, offsets.end(), index) - (offsets.begin() + 1);
+            m_State->levelRanges[level].push_back({ index, 1 });
+            m_State->dirtyFlags[index] = 0;
+        }
+        m_State->dirtyIndices.clear();
+    }
+
+    void UpdateLevel(std::uint32_t level, std::span<const TransformRange> ranges, Jobs::Scheduler * scheduler)
+    {
+        auto update = [this, level](TransformRange range) noexcept
+        {
+            auto & locals = m_State->locals;
+            auto & worlds = m_State->worlds;
+            for (auto index = range.first; index < range.first + range.count; ++index)
+            {
+                worlds[index] = Math::Compose(locals[index].translation, locals[index].rotation, locals[index].scale);
+            }
+
+            // Parents sit on earlier levels, so the gathered matrices are never the ones being written
+            if (level != 0)
+            {
+                auto results = std::span(worlds).subspan(range.first, range.count);
+                Math::MultiplyMatrices(worlds, std::span(m_State->parents).subspan(range.first, range.count), results,
+                                       results);
+            }
+        };
+
+        auto count = std::uint32_t(0);
+        for (auto range : ranges)
+        {
+            count += range.count;
+        }
+
+        if (scheduler == nullptr || scheduler->GetWorkerCount() <= 1 || count < minParallelCount)
+        {
+            for (auto range : ranges)
+            {
+                update(range);
+            }
+            return;
+        }
+
+        // Each job gets about a batch worth of nodes, long ranges are split and short ones share a job
+        auto & pieces       = m_State->batchPieces;
+        auto & batchOffsets = m_State->batchOffsets;
+        pieces.clear();
+        batchOffsets.assign(1, 0);
+        auto batchCount = std::uint32_t(0);
+        for (auto range : ranges)
+        {
+            for (auto first = range.first; first < range.first + range.count;)
+            {
+                auto pieceCount = std::min(batchSize - batchCount, range.first + range.count - first);
+                pieces.push_back({ first, pieceCount });
+                first += pieceCount;
+                batchCount += pieceCount;
+                if (batchCount == batchSize)
+                {
+                    batchOffsets.push_back(static_cast<std::uint32_t>(pieces.size()));
+                    batchCount = 0;
+                }
+            }
+        }
+        if (batchCount != 0)
+        {
+            batchOffsets.push_back(static_cast<std::uint32_t>(pieces.size()));
+        }
+
+        auto counter = scheduler->Schedule(static_cast<std::uint32_t>(batchOffsets.size() - 1),
+                                           [&pieces, &batchOffsets, &update](std::uint32_t batch)
+                                           {
+                                               for (auto piece = batchOffsets[batch]; piece < batchOffsets[batch + 1];
+                                                    ++piece)
+                                               {
+                                                   update(pieces[piece]);
+                                               }
+                                           });
+        scheduler->Wait(counter);
+    }
+
+    // Breadth-first from the roots, which sorts by depth and then by parent. Nodes the roots no longer reach were
+    // below a destroyed one and go as well
+    void RebuildLayout()
+    {
+        auto & state     = *m_State;
+        auto   slotCount = static_cast<std::uint32_t>(state.generations.size());
+
+        auto isLive = [&state](std::uint32_t slot)
+        {
+            return slot != invalidIndex && state.slotIndices[slot] != invalidIndex;
+        };
+
+        // Children grouped by parent slot
+        state.childOffsets.assign(slotCount + 1, 0);
+        for (auto slot : state.slots)
+        {
+            if (isLive(slot) && isLive(state.slotParents[slot]))
+            {
+                ++state.childOffsets[state.slotParents[slot] + 1];
+            }
+        }
+        for (auto slot = std::uint32_t(0); slot < slotCount; ++slot)
+        {
+            state.childOffsets[slot + 1] += state.childOffsets[slot];
+        }
+        state.childSlots.resize(state.childOffsets[slotCount]);
+        {
+            auto cursors = std::vector<std::uint32_t>(state.childOffsets.begin(), state.childOffsets.end() - 1);
+            for (auto slot : state.slots)
+            {
+                if (isLive(slot) && isLive(state.slotParents[slot]))
+                {
+                    state.childSlots[cursors[state.slotParents[slot]]++] = slot;
+                }
+            }
+        }
+
+        auto & ordered = state.orderedSlots;
+        ordered.clear();
+        for (auto slot : state.slots)
+        {
+            if (isLive(slot) && state.slotParents[slot] == invalidIndex)
+            {
+                ordered.push_back(slot);
+            }
+        }
+
+        auto firstChildren = std::vector<std::uint32_t>();
+        auto childCounts   = std::vector<std::uint32_t>();
+        firstChildren.reserve(state.slots.size());
+        childCounts.reserve(state.slots.size());
+
+        state.levelOffsets = { 0 };
+        for (auto begin = std::size_t(0); begin < ordered.size();)
+        {
+            auto end = ordered.size();
+            for (auto position = begin; position < end; ++position)
+            {
+                auto slot  = ordered[position];
+                auto first = state.childOffsets[slot];
+                auto last  = state.childOffsets[slot + 1];
+                firstChildren.push_back(static_cast<std::uint32_t>(ordered.size()));
+                childCounts.push_back(last - first);
+                ordered.insert(ordered.end(), state.childSlots.begin() + first, state.childSlots.begin() + last);
+            }
+            state.levelOffsets.push_back(static_cast<std::uint32_t>(end));
+            begin = end;
+        }
+
+        // Moves the local transforms into the new order and clears the reached nodes from the old layout
+        auto locals = std::vector<LocalTransform>(ordered.size());
+        for (auto position = std::size_t(0); position < ordered.size(); ++position)
+        {
+            auto & index       = state.slotIndices[ordered[position]];
+            locals[position]   = state.locals[index];
+            state.slots[index] = invalidIndex;
+            index              = static_cast<std::uint32_t>(position);
+        }
+
+        // What is left of the old layout was only reachable through a destroyed node
+        for (auto slot : state.slots)
+        {
+            if (slot != invalidIndex)
+            {
+                state.slotIndices[slot] = invalidIndex;
+                ++state.generations[slot];
+                state.freeSlots.push_back(slot);
+                --state.nodeCount;
+            }
+        }
+        state.freeSlots.insert(state.freeSlots.end(), state.destroyedSlots.begin(), state.destroyedSlots.end());
+        state.destroyedSlots.clear();
+
+        auto count = ordered.size();
+        state.slots.assign(ordered.begin(), ordered.end());
+        state.parents.resize(count);
+        for (auto index = std::size_t(0); index < count; ++index)
+        {
+            auto parentSlot      = state.slotParents[ordered[index]];
+            state.parents[index] = parentSlot == invalidIndex ? invalidIndex : state.slotIndices[parentSlot];
+        }
+        state.firstChildren = std::move(firstChildren);
+        state.childCounts   = std::move(childCounts);
+        state.locals        = std::move(locals);
+        state.worlds.resize(count);
+        state.dirtyFlags.assign(count, 0);
+        state.dirtyIndices.clear();
+
+        // Every index may have moved, so everything is recomputed and counts as changed
+        auto levelCount = state.levelOffsets.size() - 1;
+        state.levelRanges.resize(levelCount);
+        for (auto & ranges : state.levelRanges)
+        {
+            ranges.clear();
+        }
+        if (levelCount != 0)
+        {
+            state.levelRanges[0].push_back({ 0, state.levelOffsets[1] });
+        }
+        state.changedRanges.clear();
+        state.isLayoutDirty = false;
+    }
+
+    std::unique_ptr<State> m_State;
+};
+} // namespace CuEngine::Scene::Impl
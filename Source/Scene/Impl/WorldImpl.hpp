@@ -0,0 +1,330 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "ArchetypeImpl.hpp"
+
+#include <CuEngine/Scene/World.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace CuEngine::Scene::Impl
+{
+class World
+{
+public:
+    struct EntityRecord
+    {
+        Archetype *   archetype;
+        std::uint32_t chunkIndex;
+        std::uint32_t row;
+        std::uint32_t generation;
+    };
+
+    struct State
+    {
+        std::vector<EntityRecord>                      records;
+        std::vector<std::uint32_t>                     freeIndices;
+        std::vector<std::unique_ptr<Archetype>>        archetypes;
+        std::unordered_map<ComponentMask, Archetype *> archetypesByMask;
+        std::uint32_t                                  entityCount;
+    };
+
+    World() : m_State(std::make_unique<State>())
+    {
+        m_State->entityCount = 0;
+    }
+
+    World(const World &) = delete;
+
+    World(World && other) noexcept = default;
+
+    World & operator=(const World &) = delete;
+
+    World & operator=(World && other) noexcept
+    {
+        if (this != &other)
+        {
+            std::swap(m_State, other.m_State);
+        }
+
+        return *this;
+    }
+
+    ~World() noexcept = default;
+
+    Entity CreateEntity(std::span<const ComponentInfo * const> infos, std::span<void * const> values)
+    {
+        auto mask = ComponentMask();
+        for (auto * info : infos)
+        {
+            if (mask.test(info->id))
+            {
+                throw std::runtime_error("Failed to create an entity, a component type is given twice");
+            }
+            mask.set(info->id);
+        }
+
+        auto * archetype = FindArchetype(mask, infos);
+        auto   entity    = AllocateEntity();
+        auto [chunkIndex, row] = archetype->AllocateRow(entity);
+        auto & chunk           = archetype->GetChunk(chunkIndex);
+        for (auto index = std::size_t(0); index < infos.size(); ++index)
+        {
+            infos[index]->moveConstruct(archetype->GetComponent(chunk, row, *infos[index]), values[index]);
+        }
+
+        m_State->records[entity.index] = EntityRecord{
+            .archetype = archetype, .chunkIndex = chunkIndex, .row = row, .generation = entity.generation
+        };
+
+        return entity;
+    }
+
+    void DestroyEntity(Entity entity) noexcept
+    {
+        if (!IsAlive(entity))
+        {
+            return;
+        }
+
+        auto & record = m_State->records[entity.index];
+        UpdateMovedEntity(*record.archetype, record.archetype->RemoveRow(record.chunkIndex, record.row, true),
+                          record.chunkIndex, record.row);
+
+        record.archetype = nullptr;
+        ++record.generation;
+        m_State->freeIndices.push_back(entity.index);
+        --m_State->entityCount;
+    }
+
+    void AddComponent(Entity entity, const ComponentInfo & info, void * value)
+    {
+        if (!IsAlive(entity))
+        {
+            throw std::runtime_error("Failed to add a component to a destroyed entity");
+        }
+
+        auto & record = m_State->records[entity.index];
+        auto & source = *record.archetype;
+        if (source.GetMask().test(info.id))
+        {
+            auto * component = source.GetComponent(source.GetChunk(record.chunkIndex), record.row, info);
+            info.destroy(component);
+            info.moveConstruct(component, value);
+            return;
+        }
+
+        auto *& transition = source.GetAddTransition(info.id);
+        if (transition == nullptr)
+        {
+            auto components = source.GetComponents();
+            components.push_back(&info);
+            transition = FindArchetype(ComponentMask(source.GetMask()).set(info.id), components);
+        }
+
+        MoveEntity(entity, *transition);
+        auto & target = *transition;
+        info.moveConstruct(target.GetComponent(target.GetChunk(record.chunkIndex), record.row, info), value);
+    }
+
+    void RemoveComponent(Entity entity, const ComponentInfo & info)
+    {
+        if (!IsAlive(entity))
+        {
+            throw std::runtime_error("Failed to remove a component from a destroyed entity");
+        }
+
+        auto & record = m_State->records[entity.index];
+        auto & source = *record.archetype;
+        if (!source.GetMask().test(info.id))
+        {
+            return;
+        }
+
+        auto *& transition = source.GetRemoveTransition(info.id);
+        if (transition == nullptr)
+        {
+            auto components = source.GetComponents();
+            std::erase(components, &info);
+            transition = FindArchetype(ComponentMask(source.GetMask()).reset(info.id), components);
+        }
+
+        info.destroy(source.GetComponent(source.GetChunk(record.chunkIndex), record.row, info));
+        MoveEntity(entity, *transition);
+    }
+
+    [[nodiscard]] void * GetComponent(Entity entity, ComponentId id) noexcept
+    {
+        if (!IsAlive(entity))
+        {
+            return nullptr;
+        }
+
+        auto & record = m_State->records[entity.index];
+
+        return record.archetype->FindComponent(record.chunkIndex, record.row, id);
+    }
+
+    [[nodiscard]] bool IsAlive(Entity entity) const noexcept
+    {
+        if (entity.index >= m_State->records.size())
+        {
+            return false;
+        }
+
+        auto & record = m_State->records[entity.index];
+
+        return record.archetype != nullptr && record.generation == entity.generation;
+    }
+
+    void CollectChunks(const ComponentMask & required, const ComponentMask & excluded,
+                       std::vector<ChunkView> & chunks) const
+    {
+        for (auto && archetype : m_State->archetypes)
+        {
+            auto & mask = archetype->GetMask();
+            if ((mask & required) != required || (mask & excluded).any())
+            {
+                continue;
+            }
+
+            for (auto && chunk : archetype->GetChunks())
+            {
+                chunks.push_back(archetype->GetChunkView(chunk));
+            }
+        }
+    }
+
+    [[nodiscard]] std::uint32_t GetEntityCount() const noexcept
+    {
+        return m_State->entityCount;
+    }
+
+    [[nodiscard]] std::uint32_t GetArchetypeCount() const noexcept
+    {
+        return static_cast<std::uint32_t>(m_State->archetypes.size());
+    }
+
+    [[nodiscard]] std::uint32_t GetChunkCount() const noexcept
+    {
+        auto chunkCount = std::size_t(0);
+        for (auto && archetype : m_State->archetypes)
+        {
+            chunkCount += archetype->GetChunks().size();
+        }
+
+        return static_cast<std::uint32_t>(chunkCount);
+    }
+
+private:
+    [[nodiscard]] Archetype * FindArchetype(const ComponentMask & mask, std::span<const ComponentInfo * const> infos)
+    {
+        if (auto archetypeIt = m_State->archetypesByMask.find(mask); archetypeIt != m_State->archetypesByMask.end())
+        {
+            return archetypeIt->second;
+        }
+
+        // Columns in id order, so the same set of components always has the same layout
+        auto components = std::vector<const ComponentInfo *>(infos.begin(), infos.end());
+        std::ranges::sort(components,
+                          [](const ComponentInfo * left, const ComponentInfo * right)
+                          {
+                              return left->id < right->id;
+                          });
+
+        auto & archetype = m_State->archetypes.emplace_back(std::make_unique<Archetype>(mask, std::move(components)));
+        m_State->archetypesByMask.emplace(mask, archetype.get());
+
+        return archetype.get();
+    }
+
+    [[nodiscard]] Entity AllocateEntity()
+    {
+        ++m_State->entityCount;
+        if (!m_State->freeIndices.empty())
+        {
+            auto index = m_State->freeIndices.back();
+            m_State->freeIndices.pop_back();
+
+            return Entity{ .index = index, .generation = m_State->records[index].generation };
+        }
+
+        m_State->records.push_back(
+            EntityRecord{ .archetype = nullptr, .chunkIndex = 0, .row = 0, .generation = 0 });
+
+        return Entity{ .index = static_cast<std::uint32_t>(m_State->records.size() - 1), .generation = 0 };
+    }
+
+    // Moves every component both archetypes have, the caller handles the one that differs
+    void MoveEntity(Entity entity, Archetype & target)
+    {
+        auto & record = m_State->records[entity.index];
+        auto & source = *record.archetype;
+        auto [chunkIndex, row] = target.AllocateRow(entity);
+
+        auto & sourceChunk = source.GetChunk(record.chunkIndex);
+        auto & targetChunk = target.GetChunk(chunkIndex);
+        for (auto * component : source.GetComponents())
+        {
+            if (!target.GetMask().test(component->id))
+            {
+                continue;
+            }
+
+            auto * sourceComponent = source.GetComponent(sourceChunk, record.row, *component);
+            component->moveConstruct(target.GetComponent(targetChunk, row, *component), sourceComponent);
+            component->destroy(sourceComponent);
+        }
+
+        UpdateMovedEntity(source, source.RemoveRow(record.chunkIndex, record.row, false), record.chunkIndex,
+                          record.row);
+
+        record.archetype  = &target;
+        record.chunkIndex = chunkIndex;
+        record.row        = row;
+    }
+
+    void UpdateMovedEntity(Archetype & archetype, Entity moved, std::uint32_t chunkIndex, std::uint32_t row) noexcept
+    {
+        if (moved == nullEntity)
+        {
+            return;
+        }
+
+        auto & record     = m_State->records[moved.index];
+        record.archetype  = &archetype;
+        record.chunkIndex = chunkIndex;
+        record.row        = row;
+    }
+
+    std::unique_ptr<State> m_State;
+};
+} // namespace CuEngine::Scene::Impl
@@ -0,0 +1,121 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Impl/TransformHierarchyImpl.hpp"
+
+namespace CuEngine::Scene
+{
+TransformHierarchy::TransformHierarchy() : m_Pimpl()
+{}
+
+TransformHierarchy::TransformHierarchy(TransformHierarchy && other) noexcept = default;
+
+TransformHierarchy & TransformHierarchy::operator=(TransformHierarchy && other) noexcept = default;
+
+TransformHierarchy::~TransformHierarchy() noexcept = default;
+
+TransformNode TransformHierarchy::CreateNode(TransformNode parent, const LocalTransform & local)
+{
+    return m_Pimpl->CreateNode(parent, local);
+}
+
+void TransformHierarchy::DestroyNode(TransformNode node) noexcept
+{
+    m_Pimpl->DestroyNode(node);
+}
+
+void TransformHierarchy::SetParent(TransformNode node, TransformNode parent)
+{
+    m_Pimpl->SetParent(node, parent);
+}
+
+void TransformHierarchy::SetLocalTransform(TransformNode node, const LocalTransform & local)
+{
+    m_Pimpl->SetLocalTransform(node, local);
+}
+
+const LocalTransform * TransformHierarchy::GetLocalTransform(TransformNode node) const noexcept
+{
+    return m_Pimpl->GetLocalTransform(node);
+}
+
+bool TransformHierarchy::IsAlive(TransformNode node) const noexcept
+{
+    return m_Pimpl->IsAlive(node);
+}
+
+void TransformHierarchy::Update()
+{
+    m_Pimpl->Update(nullptr);
+}
+
+void TransformHierarchy::Update(Jobs::Scheduler & scheduler)
+{
+    m_Pimpl->Update(&scheduler);
+}
+
+const Math::Mat4 * TransformHierarchy::GetWorldMatrix(TransformNode node) const noexcept
+{
+    return m_Pimpl->GetWorldMatrix(node);
+}
+
+std::uint32_t TransformHierarchy::GetMatrixIndex(TransformNode node) const noexcept
+{
+    return m_Pimpl->GetMatrixIndex(node);
+}
+
+std::span<const Math::Mat4> TransformHierarchy::GetWorldMatrices() const noexcept
+{
+    return m_Pimpl->GetWorldMatrices();
+}
+
+std::span<const TransformRange> TransformHierarchy::GetChangedRanges() const noexcept
+{
+    return m_Pimpl->GetChangedRanges();
+}
+
+void TransformHierarchy::ClearChangedRanges() noexcept
+{
+    m_Pimpl->ClearChangedRanges();
+}
+
+std::uint32_t TransformHierarchy::GetNodeCount() const noexcept
+{
+    return m_Pimpl->GetNodeCount();
+}
+
+std::uint32_t TransformHierarchy::GetLevelCount() const noexcept
+{
+    return m_Pimpl->GetLevelCount();
+}
+
+std::uint32_t TransformHierarchy::GetUpdatedCount() const noexcept
+{
+    return m_Pimpl->GetUpdatedCount();
+}
+
+Impl::TransformHierarchy & TransformHierarchy::GetImpl() noexcept
+{
+    return *m_Pimpl;
+}
+
+} // namespace CuEngine::Scene
@@ -0,0 +1,92 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Impl/WorldImpl.hpp"
+
+namespace CuEngine::Scene
+{
+World::World() : m_Pimpl()
+{}
+
+World::World(World && other) noexcept = default;
+
+World & World::operator=(World && other) noexcept = default;
+
+World::~World() noexcept = default;
+
+Entity World::CreateEntity(std::span<const ComponentInfo * const> infos, std::span<void * const> values)
+{
+    return m_Pimpl->CreateEntity(infos, values);
+}
+
+void World::DestroyEntity(Entity entity) noexcept
+{
+    m_Pimpl->DestroyEntity(entity);
+}
+
+void World::AddComponent(Entity entity, const ComponentInfo & info, void * value)
+{
+    m_Pimpl->AddComponent(entity, info, value);
+}
+
+void World::RemoveComponent(Entity entity, const ComponentInfo & info)
+{
+    m_Pimpl->RemoveComponent(entity, info);
+}
+
+void * World::GetComponent(Entity entity, ComponentId id) noexcept
+{
+    return m_Pimpl->GetComponent(entity, id);
+}
+
+bool World::IsAlive(Entity entity) const noexcept
+{
+    return m_Pimpl->IsAlive(entity);
+}
+
+void World::CollectChunks(const ComponentMask & required, const ComponentMask & excluded,
+                          std::vector<ChunkView> & chunks) const
+{
+    m_Pimpl->CollectChunks(required, excluded, chunks);
+}
+
+std::uint32_t World::GetEntityCount() const noexcept
+{
+    return m_Pimpl->GetEntityCount();
+}
+
+std::uint32_t World::GetArchetypeCount() const noexcept
+{
+    return m_Pimpl->GetArchetypeCount();
+}
+
+std::uint32_t World::GetChunkCount() const noexcept
+{
+    return m_Pimpl->GetChunkCount();
+}
+
+Impl::World & World::GetImpl() noexcept
+{
+    return *m_Pimpl;
+}
+
+} // namespace CuEngine::Scene
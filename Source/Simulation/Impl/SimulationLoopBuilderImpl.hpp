@@ -0,0 +1,114 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "SimulationLoopImpl.hpp"
+
+#include <CuEngine/Simulation/SimulationLoopBuilder.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace CuEngine::Simulation::Impl
+{
+class SimulationLoopBuilder
+{
+public:
+    SimulationLoopBuilder() : m_TickPeriod(ToTickPeriod(60.0)), m_MaxCatchUpTicks(5), m_TickFunction()
+    {}
+
+    SimulationLoopBuilder(const SimulationLoopBuilder &) = default;
+
+    SimulationLoopBuilder(SimulationLoopBuilder && other) noexcept = default;
+
+    SimulationLoopBuilder & operator=(const SimulationLoopBuilder &) = default;
+
+    SimulationLoopBuilder & operator=(SimulationLoopBuilder && other) noexcept = default;
+
+    ~SimulationLoopBuilder() noexcept = default;
+
+    SimulationLoopBuilder & SetTickRate(double tickRate) noexcept
+    {
+        m_TickPeriod = ToTickPeriod(tickRate);
+
+        return *this;
+    }
+
+    SimulationLoopBuilder & SetMaxCatchUpTicks(std::uint32_t maxCatchUpTicks) noexcept
+    {
+        m_MaxCatchUpTicks = maxCatchUpTicks;
+
+        return *this;
+    }
+
+    SimulationLoopBuilder & SetTickFunction(SimulationLoop::TickFunction tickFunction) noexcept
+    {
+        m_TickFunction = std::move(tickFunction);
+
+        return *this;
+    }
+
+    [[nodiscard]] SimulationLoop Build() const
+    {
+        if (m_TickPeriod <= SimulationLoop::Clock::duration::zero())
+        {
+            throw std::runtime_error("Simulation tick rate has to be positive");
+        }
+
+        if (!m_TickFunction)
+        {
+            throw std::runtime_error("Simulation loop requires a tick function");
+        }
+
+        auto state              = std::make_unique<SimulationLoop::State>();
+        state->tickPeriod       = m_TickPeriod;
+        state->maxCatchUpTicks  = m_MaxCatchUpTicks;
+        state->tickFunction     = m_TickFunction;
+        state->isRunning        = true;
+        state->tickCount        = 0;
+        state->skippedTickCount = 0;
+
+        return SimulationLoop(std::move(state));
+    }
+
+private:
+    static SimulationLoop::Clock::duration ToTickPeriod(double tickRate) noexcept
+    {
+        if (tickRate <= 0.0)
+        {
+            return SimulationLoop::Clock::duration::zero();
+        }
+
+        using Seconds = std::chrono::duration<double>;
+
+        return std::chrono::duration_cast<SimulationLoop::Clock::duration>(Seconds(1.0 / tickRate));
+    }
+
+    SimulationLoop::Clock::duration m_TickPeriod;
+    std::uint32_t                   m_MaxCatchUpTicks;
+    SimulationLoop::TickFunction    m_TickFunction;
+};
+} // namespace CuEngine::Simulation::Impl
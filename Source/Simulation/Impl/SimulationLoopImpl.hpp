@@ -0,0 +1,188 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Profiling/Profiler.hpp>
+#include <CuEngine/Simulation/SimulationLoop.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <utility>
+
+namespace CuEngine::Simulation::Impl
+{
+class SimulationLoop
+{
+public:
+    using Clock        = std::chrono::steady_clock;
+    using TickFunction = std::function<void(std::uint64_t, Clock::time_point)>;
+
+    struct State
+    {
+        Clock::duration             tickPeriod;
+        std::uint32_t               maxCatchUpTicks;
+        TickFunction                tickFunction;
+        std::atomic<bool>           isRunning;
+        std::atomic<std::uint64_t>  tickCount;
+        std::atomic<std::uint64_t>  skippedTickCount;
+        std::exception_ptr          error;
+        std::mutex                  mutex;
+        std::condition_variable_any condition;
+        std::jthread                thread;
+    };
+
+    explicit SimulationLoop(std::unique_ptr<State> state) : m_State(std::move(state))
+    {
+        m_State->thread = std::jthread(
+            [state = m_State.get()](std::stop_token stopToken)
+            {
+                CU_PROFILE_THREAD("Simulation");
+                Run(*state, stopToken);
+            });
+    }
+
+    SimulationLoop(const SimulationLoop &) = delete;
+
+    SimulationLoop(SimulationLoop && other) noexcept = default;
+
+    SimulationLoop & operator=(const SimulationLoop &) = delete;
+
+    SimulationLoop & operator=(SimulationLoop && other) noexcept
+    {
+        if (this != &other)
+        {
+            std::swap(m_State, other.m_State);
+        }
+
+        return *this;
+    }
+
+    ~SimulationLoop() noexcept
+    {
+        if (!m_State)
+        {
+            return;
+        }
+
+        Stop();
+    }
+
+    void Stop() noexcept
+    {
+        if (m_State->thread.joinable())
+        {
+            m_State->thread.request_stop();
+            m_State->thread.join();
+        }
+    }
+
+    [[nodiscard]] bool IsRunning() const noexcept
+    {
+        return m_State->isRunning.load();
+    }
+
+    // Only read once the thread has stopped, isRunning orders it after the write
+    void RethrowIfFailed() const
+    {
+        if (!m_State->isRunning.load() && m_State->error)
+        {
+            std::rethrow_exception(m_State->error);
+        }
+    }
+
+    [[nodiscard]] Clock::duration GetTickPeriod() const noexcept
+    {
+        return m_State->tickPeriod;
+    }
+
+    [[nodiscard]] std::uint64_t GetTickCount() const noexcept
+    {
+        return m_State->tickCount.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::uint64_t GetSkippedTickCount() const noexcept
+    {
+        return m_State->skippedTickCount.load(std::memory_order_relaxed);
+    }
+
+private:
+    static void Run(State & state, std::stop_token stopToken)
+    {
+        try
+        {
+            auto tick     = std::uint64_t(0);
+            auto tickTime = Clock::now();
+            while (!stopToken.stop_requested())
+            {
+                // Wakes up right away when stopped instead of sleeping out the period
+                {
+                    auto lock = std::unique_lock(state.mutex);
+                    static_cast<void>(state.condition.wait_until(lock, stopToken, tickTime,
+                                                                 []()
+                                                                 {
+                                                                     return false;
+                                                                 }));
+                }
+
+                if (stopToken.stop_requested())
+                {
+                    break;
+                }
+
+                {
+                    CU_PROFILE_SCOPE("SimulationTick");
+                    state.tickFunction(tick, tickTime);
+                }
+
+                ++tick;
+                tickTime += state.tickPeriod;
+                state.tickCount.store(tick, std::memory_order_relaxed);
+
+                // A stall longer than the catch-up budget is dropped, the simulation resumes from now
+                auto lateTicks = (Clock::now() - tickTime) / state.tickPeriod;
+                if (lateTicks > static_cast<Clock::rep>(state.maxCatchUpTicks))
+                {
+                    state.skippedTickCount.fetch_add(static_cast<std::uint64_t>(lateTicks), std::memory_order_relaxed);
+                    tickTime += state.tickPeriod * lateTicks;
+                }
+            }
+        }
+        catch (...)
+        {
+            state.error = std::current_exception();
+        }
+
+        state.isRunning.store(false);
+    }
+
+    std::unique_ptr<State> m_State;
+};
+} // namespace CuEngine::Simulation::Impl
@@ -0,0 +1,71 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Impl/SimulationLoopImpl.hpp"
+
+namespace CuEngine::Simulation
+{
+SimulationLoop::SimulationLoop(Impl::SimulationLoop && simulationLoop) noexcept : m_Pimpl(std::move(simulationLoop))
+{}
+
+SimulationLoop::SimulationLoop(SimulationLoop && other) noexcept = default;
+
+SimulationLoop & SimulationLoop::operator=(SimulationLoop && other) noexcept = default;
+
+SimulationLoop::~SimulationLoop() noexcept = default;
+
+void SimulationLoop::Stop() noexcept
+{
+    m_Pimpl->Stop();
+}
+
+bool SimulationLoop::IsRunning() const noexcept
+{
+    return m_Pimpl->IsRunning();
+}
+
+void SimulationLoop::RethrowIfFailed() const
+{
+    m_Pimpl->RethrowIfFailed();
+}
+
+std::chrono::steady_clock::duration SimulationLoop::GetTickPeriod() const noexcept
+{
+    return m_Pimpl->GetTickPeriod();
+}
+
+std::uint64_t SimulationLoop::GetTickCount() const noexcept
+{
+    return m_Pimpl->GetTickCount();
+}
+
+std::uint64_t SimulationLoop::GetSkippedTickCount() const noexcept
+{
+    return m_Pimpl->GetSkippedTickCount();
+}
+
+Impl::SimulationLoop & SimulationLoop::GetImpl() noexcept
+{
+    return *m_Pimpl;
+}
+
+} // namespace CuEngine::Simulation
@@ -0,0 +1,81 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Impl/SimulationLoopBuilderImpl.hpp"
+
+namespace CuEngine::Simulation
+{
+SimulationLoopBuilder::SimulationLoopBuilder() : m_Pimpl()
+{}
+
+SimulationLoopBuilder::SimulationLoopBuilder(const SimulationLoopBuilder & other) = default;
+
+SimulationLoopBuilder::SimulationLoopBuilder(SimulationLoopBuilder && other) noexcept
+    : m_Pimpl(std::move(other.m_Pimpl))
+{}
+
+SimulationLoopBuilder & SimulationLoopBuilder::operator=(const SimulationLoopBuilder & other) = default;
+
+SimulationLoopBuilder & SimulationLoopBuilder::operator=(SimulationLoopBuilder && other) noexcept
+{
+    if (this != &other)
+    {
+        m_Pimpl = std::move(other.m_Pimpl);
+    }
+
+    return *this;
+}
+
+SimulationLoopBuilder::~SimulationLoopBuilder() noexcept = default;
+
+SimulationLoopBuilder & SimulationLoopBuilder::SetTickRate(double tickRate) noexcept
+{
+    m_Pimpl->SetTickRate(tickRate);
+
+    return *this;
+}
+
+SimulationLoopBuilder & SimulationLoopBuilder::SetMaxCatchUpTicks(std::uint32_t maxCatchUpTicks) noexcept
+{
+    m_Pimpl->SetMaxCatchUpTicks(maxCatchUpTicks);
+
+    return *this;
+}
+
+SimulationLoopBuilder & SimulationLoopBuilder::SetTickFunction(TickFunction tickFunction) noexcept
+{
+    m_Pimpl->SetTickFunction(std::move(tickFunction));
+
+    return *this;
+}
+
+SimulationLoop SimulationLoopBuilder::Build() const
+{
+    return SimulationLoop(m_Pimpl->Build());
+}
+
+Impl::SimulationLoopBuilder & SimulationLoopBuilder::GetImpl() noexcept
+{
+    return *m_Pimpl;
+}
+
+} // namespace CuEngine::Simulation
@@ -0,0 +1,95 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Impl/BufferBuilderImpl.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+namespace CuEngine::Vulkan
+{
+BufferBuilder::BufferBuilder() = default;
+
+BufferBuilder::BufferBuilder(const BufferBuilder & other) = default;
+
+BufferBuilder::BufferBuilder(BufferBuilder && other) noexcept = default;
+
+BufferBuilder & BufferBuilder::operator=(const BufferBuilder & other) = default;
+
+BufferBuilder & BufferBuilder::operator=(BufferBuilder && other) noexcept = default;
+
+BufferBuilder::~BufferBuilder() noexcept = default;
+
+BufferBuilder & BufferBuilder::SetDevice(Device & device) noexcept
+{
+    m_Pimpl->SetDevice(device.getImpl());
+
+    return *this;
+}
+
+BufferBuilder & BufferBuilder::SetSize(std::uint64_t size) noexcept
+{
+    m_Pimpl->SetSize(size);
+
+    return *this;
+}
+
+BufferBuilder & BufferBuilder::SetUsage(BufferUsage usage) noexcept
+{
+    m_Pimpl->SetUsage(usage);
+
+    return *this;
+}
+
+BufferBuilder & BufferBuilder::SetMemoryUsage(MemoryUsage memoryUsage) noexcept
+{
+    m_Pimpl->SetMemoryUsage(memoryUsage);
+
+    return *this;
+}
+
+BufferBuilder & BufferBuilder::SetQueueFamilies(const std::vector<QueueFamily> & queueFamilies)
+{
+    auto queueFamilyIndices = std::vector<std::uint32_t>();
+    queueFamilyIndices.reserve(queueFamilies.size());
+    std::ranges::transform(queueFamilies, std::back_inserter(queueFamilyIndices),
+                           [](const auto & queueFamily)
+                           {
+                               return queueFamily.GetIndex();
+                           });
+
+    m_Pimpl->SetQueueFamilyIndices(queueFamilyIndices);
+
+    return *this;
+}
+
+Buffer BufferBuilder::Build() const
+{
+    return Buffer(m_Pimpl->Build());
+}
+
+Impl::BufferBuilder & BufferBuilder::GetImpl() noexcept
+{
+    return *m_Pimpl;
+}
+
+} // namespace CuEngine::Vulkan
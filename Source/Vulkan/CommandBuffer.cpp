@@ -0,0 +1,83 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Impl/BufferImpl.hpp"
+#include "Impl/CommandBufferImpl.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+namespace CuEngine::Vulkan
+{
+
+CommandBuffer::CommandBuffer(Impl::CommandBuffer && commandBuffer) noexcept : m_Pimpl(std::move(commandBuffer))
+{}
+
+CommandBuffer::CommandBuffer(const CommandBuffer & other) noexcept = default;
+
+CommandBuffer::CommandBuffer(CommandBuffer && other) noexcept = default;
+
+CommandBuffer & CommandBuffer::operator=(const CommandBuffer & other) noexcept = default;
+
+CommandBuffer & CommandBuffer::operator=(CommandBuffer && other) noexcept = default;
+
+CommandBuffer::~CommandBuffer() noexcept = default;
+
+void CommandBuffer::End()
+{
+    m_Pimpl->End();
+}
+
+void CommandBuffer::ExecuteCommands(const std::vector<CommandBuffer> & secondaryCommandBuffers)
+{
+    auto handles = std::vector<VkCommandBuffer>();
+    handles.reserve(secondaryCommandBuffers.size());
+    std::ranges::transform(secondaryCommandBuffers, std::back_inserter(handles),
+                           [](const auto & commandBuffer)
+                           {
+                               return commandBuffer.GetImpl().GetHandle();
+                           });
+
+    m_Pimpl->ExecuteCommands(handles);
+}
+
+void CommandBuffer::ReleaseOwnership(const BufferOwnershipTransfer & transfer) noexcept
+{
+    m_Pimpl->ReleaseOwnership(transfer.buffer->GetImpl().GetHandle(), transfer);
+}
+
+void CommandBuffer::AcquireOwnership(const BufferOwnershipTransfer & transfer) noexcept
+{
+    m_Pimpl->AcquireOwnership(transfer.buffer->GetImpl().GetHandle(), transfer);
+}
+
+Impl::CommandBuffer & CommandBuffer::GetImpl() noexcept
+{
+    return *m_Pimpl;
+}
+
+const Impl::CommandBuffer & CommandBuffer::GetImpl() const noexcept
+{
+    return *m_Pimpl;
+}
+
+} // namespace CuEngine::Vulkan
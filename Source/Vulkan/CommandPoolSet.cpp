@@ -0,0 +1,88 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Impl/CommandBufferImpl.hpp"
+#include "Impl/CommandPoolSetImpl.hpp"
+
+namespace CuEngine::Vulkan
+{
+
+CommandPoolSet::CommandPoolSet(Impl::CommandPoolSet && commandPoolSet) noexcept : m_Pimpl(std::move(commandPoolSet))
+{}
+
+CommandPoolSet::CommandPoolSet(CommandPoolSet && other) noexcept = default;
+
+CommandPoolSet & CommandPoolSet::operator=(CommandPoolSet && other) noexcept = default;
+
+CommandPoolSet::~CommandPoolSet() noexcept = default;
+
+void CommandPoolSet::BeginFrame(std::uint32_t frameIndex)
+{
+    m_Pimpl->BeginFrame(frameIndex);
+}
+
+CommandBuffer CommandPoolSet::BeginPrimary()
+{
+    return CommandBuffer(Impl::CommandBuffer(m_Pimpl->BeginPrimary()));
+}
+
+CommandBuffer CommandPoolSet::BeginSecondary(std::uint32_t workerIndex, const SecondaryInheritance & inheritance)
+{
+    auto colorFormats    = std::vector<VkFormat>();
+    auto renderingInfo   = VkCommandBufferInheritanceRenderingInfo();
+    auto inheritanceInfo = Impl::CommandPoolSet::GetInheritanceInfo(inheritance, colorFormats, renderingInfo);
+
+    return CommandBuffer(Impl::CommandBuffer(m_Pimpl->BeginSecondary(workerIndex, inheritanceInfo)));
+}
+
+void CommandPoolSet::RecordSecondary(Jobs::Scheduler & scheduler, CommandBuffer & primary,
+                                     const SecondaryInheritance & inheritance, std::uint32_t taskCount,
+                                     const std::function<void(CommandBuffer &, std::uint32_t)> & record)
+{
+    auto colorFormats    = std::vector<VkFormat>();
+    auto renderingInfo   = VkCommandBufferInheritanceRenderingInfo();
+    auto inheritanceInfo = Impl::CommandPoolSet::GetInheritanceInfo(inheritance, colorFormats, renderingInfo);
+
+    m_Pimpl->RecordSecondary(scheduler, primary.GetImpl().GetHandle(), inheritanceInfo, taskCount,
+                             [&record](VkCommandBuffer handle, std::uint32_t task)
+                             {
+                                 auto commandBuffer = CommandBuffer(Impl::CommandBuffer(handle));
+                                 record(commandBuffer, task);
+                             });
+}
+
+std::uint32_t CommandPoolSet::GetFramesInFlight() const noexcept
+{
+    return m_Pimpl->GetFramesInFlight();
+}
+
+std::uint32_t CommandPoolSet::GetWorkerCount() const noexcept
+{
+    return m_Pimpl->GetWorkerCount();
+}
+
+Impl::CommandPoolSet & CommandPoolSet::GetImpl() noexcept
+{
+    return *m_Pimpl;
+}
+
+} // namespace CuEngine::Vulkan
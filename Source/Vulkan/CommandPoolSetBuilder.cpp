@@ -0,0 +1,77 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Impl/CommandPoolSetBuilderImpl.hpp"
+
+namespace CuEngine::Vulkan
+{
+CommandPoolSetBuilder::CommandPoolSetBuilder() = default;
+
+CommandPoolSetBuilder::CommandPoolSetBuilder(const CommandPoolSetBuilder & other) = default;
+
+CommandPoolSetBuilder::CommandPoolSetBuilder(CommandPoolSetBuilder && other) noexcept = default;
+
+CommandPoolSetBuilder & CommandPoolSetBuilder::operator=(const CommandPoolSetBuilder & other) = default;
+
+CommandPoolSetBuilder & CommandPoolSetBuilder::operator=(CommandPoolSetBuilder && other) noexcept = default;
+
+CommandPoolSetBuilder::~CommandPoolSetBuilder() noexcept = default;
+
+CommandPoolSetBuilder & CommandPoolSetBuilder::SetDevice(Device & device) noexcept
+{
+    m_Pimpl->SetDevice(device.getImpl());
+
+    return *this;
+}
+
+CommandPoolSetBuilder & CommandPoolSetBuilder::SetQueueFamily(const QueueFamily & queueFamily) noexcept
+{
+    m_Pimpl->SetQueueFamily(queueFamily.GetImpl());
+
+    return *this;
+}
+
+CommandPoolSetBuilder & CommandPoolSetBuilder::SetFramesInFlight(std::uint32_t framesInFlight) noexcept
+{
+    m_Pimpl->SetFramesInFlight(framesInFlight);
+
+    return *this;
+}
+
+CommandPoolSetBuilder & CommandPoolSetBuilder::SetWorkerCount(std::uint32_t workerCount) noexcept
+{
+    m_Pimpl->SetWorkerCount(workerCount);
+
+    return *this;
+}
+
+CommandPoolSet CommandPoolSetBuilder::Build() const
+{
+    return CommandPoolSet(m_Pimpl->Build());
+}
+
+Impl::CommandPoolSetBuilder & CommandPoolSetBuilder::GetImpl() noexcept
+{
+    return *m_Pimpl;
+}
+
+} // namespace CuEngine::Vulkan
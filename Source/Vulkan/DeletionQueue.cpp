@@ -0,0 +1,77 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Impl/DeletionQueueImpl.hpp"
+
+namespace CuEngine::Vulkan
+{
+
+DeletionQueue::DeletionQueue(Impl::DeletionQueue && deletionQueue) noexcept : m_Pimpl(std::move(deletionQueue))
+{}
+
+DeletionQueue::DeletionQueue(DeletionQueue && other) noexcept = default;
+
+DeletionQueue & DeletionQueue::operator=(DeletionQueue && other) noexcept = default;
+
+DeletionQueue::~DeletionQueue() noexcept = default;
+
+void DeletionQueue::Retire(Buffer && buffer, const TimelineSemaphore & semaphore, std::uint64_t value)
+{
+    m_Pimpl->Retire(std::move(buffer), semaphore, value);
+}
+
+void DeletionQueue::Retire(Image && image, const TimelineSemaphore & semaphore, std::uint64_t value)
+{
+    m_Pimpl->Retire(std::move(image), semaphore, value);
+}
+
+void DeletionQueue::Retire(RenderGraph && renderGraph, const TimelineSemaphore & semaphore, std::uint64_t value)
+{
+    m_Pimpl->Retire(std::move(renderGraph), semaphore, value);
+}
+
+void DeletionQueue::Retire(std::function<void()> destroy, const TimelineSemaphore & semaphore, std::uint64_t value)
+{
+    m_Pimpl->Retire(std::move(destroy), semaphore, value);
+}
+
+std::size_t DeletionQueue::Collect()
+{
+    return m_Pimpl->Collect();
+}
+
+void DeletionQueue::Flush() noexcept
+{
+    m_Pimpl->Flush();
+}
+
+std::size_t DeletionQueue::GetPendingCount() const noexcept
+{
+    return m_Pimpl->GetPendingCount();
+}
+
+Impl::DeletionQueue & DeletionQueue::GetImpl() noexcept
+{
+    return *m_Pimpl;
+}
+
+} // namespace CuEngine::Vulkan
@@ -34,6 +34,21 @@ Device & Device::operator=(Device && other) noexcept = default;
 
 Device::~Device() noexcept = default;
 
+PipelineCache & Device::GetPipelineCache() noexcept
+{
+    return m_Pimpl->GetPipelineCache();
+}
+
+MemoryAllocator & Device::GetMemoryAllocator() noexcept
+{
+    return m_Pimpl->GetMemoryAllocator();
+}
+
+DeletionQueue & Device::GetDeletionQueue() noexcept
+{
+    return m_Pimpl->GetDeletionQueue();
+}
+
 Impl::Device & Device::getImpl() noexcept
 {
     return *m_Pimpl;
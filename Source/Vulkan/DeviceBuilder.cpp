@@ -43,6 +43,13 @@ DeviceBuilder & DeviceBuilder::SetPhysicalDevice(PhysicalDevice & physicalDevice
     return *this;
 }
 
+DeviceBuilder & DeviceBuilder::SetHeadless(bool isHeadless) noexcept
+{
+    m_Pimpl->SetHeadless(isHeadless);
+
+    return *this;
+}
+
 DeviceBuilder & DeviceBuilder::AddQueues(const QueueFamily& queueFamily, const std::vector<float>& queuePriorities)
 {
     m_Pimpl->AddQueues(queueFamily.GetImpl(), queuePriorities);
@@ -50,6 +57,13 @@ DeviceBuilder & DeviceBuilder::AddQueues(const QueueFamily& queueFamily, const s
     return *this;
 }
 
+DeviceBuilder & DeviceBuilder::SetPipelineCachePath(const std::filesystem::path & path)
+{
+    m_Pimpl->SetPipelineCachePath(path);
+
+    return *this;
+}
+
 Device DeviceBuilder::Build() const
 {
     return Device(m_Pimpl->Build());
@@ -0,0 +1,220 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <CuEngine/Vulkan/DeviceSelection.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <compare>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace CuEngine::Vulkan
+{
+struct DeviceScore
+{
+    std::uint32_t typeRank;
+    std::uint32_t featureCount;
+    std::uint32_t dedicatedQueueFamilyCount;
+    std::uint64_t deviceLocalMemorySize;
+
+    auto operator<=>(const DeviceScore &) const noexcept = default;
+};
+
+// Unsuitable devices, e.g. without graphics or without presentation to the surface, are skipped entirely
+static std::optional<SuitableDevice> EvaluateDevice(PhysicalDevice & physicalDevice, Surface * surface)
+{
+    constexpr auto swapchainExtension = "VK_KHR_swapchain";
+
+    if (surface != nullptr && !physicalDevice.HasExtension(swapchainExtension))
+    {
+        return std::nullopt;
+    }
+
+    // Every submission and the upload queue synchronize through timeline semaphores, which implies Vulkan 1.2
+    if (!physicalDevice.HasTimelineSemaphoreSupport())
+    {
+        return std::nullopt;
+    }
+
+    auto queueFamilies             = QueueFamily::Enumerate(physicalDevice);
+    auto graphicsQueueFamilyIt     = std::ranges::find_if(queueFamilies,
+                                                          [](const auto & queueFamily)
+                                                          {
+                                                              return queueFamily.HasGraphicsSupport();
+                                                          });
+    auto presentationQueueFamilyIt = surface == nullptr
+                                         ? graphicsQueueFamilyIt
+                                         : std::ranges::find_if(queueFamilies,
+                                                                [&surface](const auto & queueFamily)
+                                                                {
+                                                                    return queueFamily.HasSurfaceSupport(*surface);
+                                                                });
+
+    if (std::end(queueFamilies) == graphicsQueueFamilyIt || std::end(queueFamilies) == presentationQueueFamilyIt)
+    {
+        return std::nullopt;
+    }
+    auto graphicsQueueFamily     = *graphicsQueueFamilyIt;
+    auto presentationQueueFamily = *presentationQueueFamilyIt;
+
+    // Prefer the copy engine, then any family without graphics, so uploads do not queue behind rendering
+    auto transferQueueFamilyIt = std::ranges::find_if(queueFamilies,
+                                                      [](const auto & queueFamily)
+                                                      {
+                                                          return queueFamily.IsTransferOnly();
+                                                      });
+    if (std::end(queueFamilies) == transferQueueFamilyIt)
+    {
+        transferQueueFamilyIt = std::ranges::find_if(queueFamilies,
+                                                     [](const auto & queueFamily)
+                                                     {
+                                                         return queueFamily.HasTransferSupport()
+                                                                && !queueFamily.HasGraphicsSupport();
+                                                     });
+    }
+    auto transferQueueFamily =
+        std::end(queueFamilies) == transferQueueFamilyIt ? graphicsQueueFamily : *transferQueueFamilyIt;
+
+    // Async compute overlaps with graphics only on a family of its own, otherwise it shares the graphics family
+    auto computeQueueFamilyIt = std::ranges::find_if(queueFamilies,
+                                                     [](const auto & queueFamily)
+                                                     {
+                                                         return queueFamily.IsComputeOnly();
+                                                     });
+    auto computeQueueFamily =
+        std::end(queueFamilies) == computeQueueFamilyIt ? graphicsQueueFamily : *computeQueueFamilyIt;
+
+    return SuitableDevice{ .physicalDevice          = physicalDevice,
+                           .graphicsQueueFamily     = graphicsQueueFamily,
+                           .presentationQueueFamily = presentationQueueFamily,
+                           .transferQueueFamily     = transferQueueFamily,
+                           .computeQueueFamily      = computeQueueFamily };
+}
+
+// Compared member by member, so the device type outweighs everything else and memory size only breaks ties
+static DeviceScore ScoreDevice(SuitableDevice & suitableDevice)
+{
+    auto & physicalDevice = suitableDevice.physicalDevice;
+
+    auto typeRank = std::uint32_t(0);
+    switch (physicalDevice.GetType())
+    {
+        case PhysicalDeviceType::DiscreteGpu:
+            typeRank = 4;
+            break;
+        case PhysicalDeviceType::IntegratedGpu:
+            typeRank = 3;
+            break;
+        case PhysicalDeviceType::VirtualGpu:
+            typeRank = 2;
+            break;
+        case PhysicalDeviceType::Cpu:
+            typeRank = 1;
+            break;
+        case PhysicalDeviceType::Other:
+            break;
+    }
+
+    constexpr auto pipelineCreationFeedbackExtension = "VK_EXT_pipeline_creation_feedback";
+
+    // Everything optional the engine makes use of when it is there
+    auto featureCount = static_cast<std::uint32_t>(physicalDevice.HasSynchronization2Support())
+                        + static_cast<std::uint32_t>(physicalDevice.HasPipelineStatisticsSupport())
+                        + static_cast<std::uint32_t>(physicalDevice.HasExtension(pipelineCreationFeedbackExtension));
+
+    // Separate transfer and compute families let uploads and async compute run beside rendering
+    auto graphicsIndex             = suitableDevice.graphicsQueueFamily.GetIndex();
+    auto dedicatedQueueFamilyCount = static_cast<std::uint32_t>(suitableDevice.transferQueueFamily.GetIndex()
+                                                                != graphicsIndex)
+                                     + static_cast<std::uint32_t>(suitableDevice.computeQueueFamily.GetIndex()
+                                                                  != graphicsIndex);
+
+    return { .typeRank                  = typeRank,
+             .featureCount              = featureCount,
+             .dedicatedQueueFamilyCount = dedicatedQueueFamilyCount,
+             .deviceLocalMemorySize     = physicalDevice.GetDeviceLocalMemorySize() };
+}
+
+// The override matches part of the device name or its whole UUID, ignoring case
+static bool MatchesDevice(PhysicalDevice & physicalDevice, std::string_view preferredDevice)
+{
+    auto toLower = [](std::string_view value)
+    {
+        auto result = std::string(value);
+        std::ranges::transform(result, result.begin(),
+                               [](unsigned char character)
+                               {
+                                   return static_cast<char>(std::tolower(character));
+                               });
+
+        return result;
+    };
+
+    auto preferred = toLower(preferredDevice);
+    auto uuid      = physicalDevice.GetUuid();
+
+    return toLower(physicalDevice.GetName()).find(preferred) != std::string::npos
+           || (!uuid.empty() && uuid == preferred);
+}
+
+SuitableDevice SelectDevice(Instance & instance, Surface * surface, std::string_view preferredDevice)
+{
+    auto bestDevice = std::optional<SuitableDevice>();
+    auto bestScore  = DeviceScore();
+    for (auto && physicalDevice : PhysicalDevice::Enumerate(instance))
+    {
+        if (!preferredDevice.empty() && !MatchesDevice(physicalDevice, preferredDevice))
+        {
+            continue;
+        }
+
+        auto suitableDevice = EvaluateDevice(physicalDevice, surface);
+        if (!suitableDevice)
+        {
+            continue;
+        }
+
+        auto score = ScoreDevice(*suitableDevice);
+        if (!bestDevice || bestScore < score)
+        {
+            bestDevice = std::move(suitableDevice);
+            bestScore  = score;
+        }
+    }
+
+    if (!bestDevice && !preferredDevice.empty())
+    {
+        throw std::runtime_error("Failed to find a suitable Vulkan device matching " + std::string(preferredDevice));
+    }
+    if (!bestDevice)
+    {
+        throw std::runtime_error("Failed to find a suitable Vulkan device");
+    }
+
+    return std::move(*bestDevice);
+}
+
+} // namespace CuEngine::Vulkan
@@ -0,0 +1,67 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Impl/GpuProfilerImpl.hpp"
+
+namespace CuEngine::Vulkan
+{
+
+GpuProfiler::GpuProfiler(Impl::GpuProfiler && gpuProfiler) noexcept : m_Pimpl(std::move(gpuProfiler))
+{}
+
+GpuProfiler::GpuProfiler(GpuProfiler && other) noexcept = default;
+
+GpuProfiler & GpuProfiler::operator=(GpuProfiler && other) noexcept = default;
+
+GpuProfiler::~GpuProfiler() noexcept = default;
+
+void GpuProfiler::BeginFrame(CommandBuffer & commandBuffer, std::uint32_t frameIndex)
+{
+    m_Pimpl->BeginFrame(commandBuffer.GetImpl().GetHandle(), frameIndex);
+}
+
+void GpuProfiler::BeginScope(CommandBuffer & commandBuffer, std::string_view name)
+{
+    m_Pimpl->BeginScope(commandBuffer.GetImpl().GetHandle(), name);
+}
+
+void GpuProfiler::EndScope(CommandBuffer & commandBuffer)
+{
+    m_Pimpl->EndScope(commandBuffer.GetImpl().GetHandle());
+}
+
+std::vector<GpuScopeStatistics> GpuProfiler::GetStatistics() const
+{
+    return m_Pimpl->GetStatistics();
+}
+
+bool GpuProfiler::HasPipelineStatistics() const noexcept
+{
+    return m_Pimpl->HasPipelineStatistics();
+}
+
+Impl::GpuProfiler & GpuProfiler::GetImpl() noexcept
+{
+    return *m_Pimpl;
+}
+
+} // namespace CuEngine::Vulkan
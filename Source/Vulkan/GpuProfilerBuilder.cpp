@@ -0,0 +1,91 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Impl/GpuProfilerBuilderImpl.hpp"
+
+namespace CuEngine::Vulkan
+{
+GpuProfilerBuilder::GpuProfilerBuilder() = default;
+
+GpuProfilerBuilder::GpuProfilerBuilder(const GpuProfilerBuilder & other) = default;
+
+GpuProfilerBuilder::GpuProfilerBuilder(GpuProfilerBuilder && other) noexcept = default;
+
+GpuProfilerBuilder & GpuProfilerBuilder::operator=(const GpuProfilerBuilder & other) = default;
+
+GpuProfilerBuilder & GpuProfilerBuilder::operator=(GpuProfilerBuilder && other) noexcept = default;
+
+GpuProfilerBuilder::~GpuProfilerBuilder() noexcept = default;
+
+GpuProfilerBuilder & GpuProfilerBuilder::SetPhysicalDevice(PhysicalDevice & physicalDevice) noexcept
+{
+    m_Pimpl->SetPhysicalDevice(physicalDevice.GetImpl());
+
+    return *this;
+}
+
+GpuProfilerBuilder & GpuProfilerBuilder::SetDevice(Device & device) noexcept
+{
+    m_Pimpl->SetDevice(device.getImpl());
+
+    return *this;
+}
+
+GpuProfilerBuilder & GpuProfilerBuilder::SetQueueFamily(const QueueFamily & queueFamily) noexcept
+{
+    m_Pimpl->SetQueueFamily(queueFamily.GetImpl());
+
+    return *this;
+}
+
+GpuProfilerBuilder & GpuProfilerBuilder::SetFramesInFlight(std::uint32_t framesInFlight) noexcept
+{
+    m_Pimpl->SetFramesInFlight(framesInFlight);
+
+    return *this;
+}
+
+GpuProfilerBuilder & GpuProfilerBuilder::SetMaxScopesPerFrame(std::uint32_t maxScopesPerFrame) noexcept
+{
+    m_Pimpl->SetMaxScopesPerFrame(maxScopesPerFrame);
+
+    return *this;
+}
+
+GpuProfilerBuilder & GpuProfilerBuilder::SetHistorySize(std::uint32_t historySize) noexcept
+{
+    m_Pimpl->SetHistorySize(historySize);
+
+    return *this;
+}
+
+GpuProfiler GpuProfilerBuilder::Build() const
+{
+    return GpuProfiler(m_Pimpl->Build());
+}
+
+Impl::GpuProfilerBuilder & GpuProfilerBuilder::GetImpl() noexcept
+{
+    return *m_Pimpl;
+}
+
+} // namespace CuEngine::Vulkan
@@ -0,0 +1,76 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "Impl/ImageBuilderImpl.hpp"
+
+namespace CuEngine::Vulkan
+{
+ImageBuilder::ImageBuilder() = default;
+
+ImageBuilder::ImageBuilder(const ImageBuilder & other) = default;
+
+ImageBuilder::ImageBuilder(ImageBuilder && other) noexcept = default;
+
+ImageBuilder & ImageBuilder::operator=(const ImageBuilder & other) = default;
+
+ImageBuilder & ImageBuilder::operator=(ImageBuilder && other) noexcept = default;
+
+ImageBuilder::~ImageBuilder() noexcept = default;
+
+ImageBuilder & ImageBuilder::SetDevice(Device & device) noexcept
+{
+    m_Pimpl->SetDevice(device.getImpl());
+
+    return *this;
+}
+
+ImageBuilder & ImageBuilder::SetFormat(Format format) noexcept
+{
+    m_Pimpl->SetFormat(format);
+
+    return *this;
+}
+
+ImageBuilder & ImageBuilder::SetExtent(std::uint32_t width, std::uint32_t height) noexcept
+{
+    m_Pimpl->SetExtent(VkExtent2D{ .width = width, .height = height });
+
+    return *this;
+}
+
+ImageBuilder & ImageBuilder::SetUsage(ImageUsage usage) noexcept
+{
+    m_Pimpl->SetUsage(usage);
+
+    return *this;
+}
+
+Image ImageBuilder::Build() const
+{
+    return Image(m_Pimpl->Build());
+}
+
+Impl::ImageBuilder & ImageBuilder::GetImpl() noexcept
+{
+    return *m_Pimpl;
+}
+
+} // namespace CuEngine::Vulkan
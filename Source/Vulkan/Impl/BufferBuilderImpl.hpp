@@ -0,0 +1,141 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include "BufferImpl.hpp"
+#include "DeviceImpl.hpp"
+#include "HostAllocatorImpl.hpp"
+#include "LoaderImpl.hpp"
+#include "MemoryAllocatorImpl.hpp"
+
+#include <CuEngine/Vulkan/BufferBuilder.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace CuEngine::Vulkan::Impl
+{
+class BufferBuilder
+{
+public:
+    explicit BufferBuilder() noexcept
+        : m_Device(VK_NULL_HANDLE), m_MemoryAllocator(nullptr), m_Size(0), m_Usage(0),
+          m_MemoryUsage(MemoryUsage::GpuOnly), m_QueueFamilyIndices()
+    {}
+
+    BufferBuilder(const BufferBuilder & other) = default;
+
+    BufferBuilder(BufferBuilder && other) noexcept = default;
+
+    BufferBuilder & operator=(const BufferBuilder & other) = default;
+
+    BufferBuilder & operator=(BufferBuilder && other) noexcept = default;
+
+    ~BufferBuilder() noexcept = default;
+
+    BufferBuilder & SetDevice(Device & device) noexcept
+    {
+        m_Device          = device.GetHandle();
+        m_MemoryAllocator = &device.GetMemoryAllocator().GetImpl();
+
+        return *this;
+    }
+
+    BufferBuilder & SetSize(VkDeviceSize size) noexcept
+    {
+        m_Size = size;
+
+        return *this;
+    }
+
+    BufferBuilder & SetUsage(BufferUsage usage) noexcept
+    {
+        m_Usage = static_cast<VkBufferUsageFlags>(usage);
+
+        return *this;
+    }
+
+    BufferBuilder & SetMemoryUsage(MemoryUsage memoryUsage) noexcept
+    {
+        m_MemoryUsage = memoryUsage;
+
+        return *this;
+    }
+
+    BufferBuilder & SetQueueFamilyIndices(const std::vector<std::uint32_t> & queueFamilyIndices)
+    {
+        m_QueueFamilyIndices = queueFamilyIndices;
+        std::ranges::sort(m_QueueFamilyIndices);
+        m_QueueFamilyIndices.erase(std::ranges::unique(m_QueueFamilyIndices).begin(), m_QueueFamilyIndices.end());
+
+        return *this;
+    }
+
+    [[nodiscard]] Buffer Build() const
+    {
+        if (m_MemoryAllocator == nullptr || m_Size == 0)
+        {
+            throw std::runtime_error("Failed to create a buffer: device and size have to be set");
+        }
+
+        auto isShared   = m_QueueFamilyIndices.size() > 1;
+        auto bufferInfo = VkBufferCreateInfo{
+            .sType                 = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+            .pNext                 = nullptr,
+            .flags                 = 0,
+            .size                  = m_Size,
+            .usage                 = m_Usage,
+            .sharingMode           = isShared ? VK_SHARING_MODE_CONCURRENT : VK_SHARING_MODE_EXCLUSIVE,
+            .queueFamilyIndexCount = isShared ? static_cast<std::uint32_t>(m_QueueFamilyIndices.size()) : 0,
+            .pQueueFamilyIndices   = isShared ? m_QueueFamilyIndices.data() : nullptr,
+        };
+
+        auto buffer = VkBuffer(VK_NULL_HANDLE);
+        if (vkCreateBuffer(m_Device, &bufferInfo, HostAllocator::GetCallbacks(), &buffer) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create a buffer");
+        }
+
+        try
+        {
+            return Buffer(m_Device, buffer, m_MemoryAllocator->AllocateForBuffer(buffer, m_MemoryUsage), m_Size);
+        }
+        catch (...)
+        {
+            vkDestroyBuffer(m_Device, buffer, HostAllocator::GetCallbacks());
+            throw;
+        }
+    }
+
+private:
+    VkDevice                   m_Device;
+    MemoryAllocator *          m_MemoryAllocator;
+    VkDeviceSize               m_Size;
+    VkBufferUsageFlags         m_Usage;
+    MemoryUsage                m_MemoryUsage;
+    std::vector<std::uint32_t> m_QueueFamilyIndices;
+};
+} // namespace CuEngine::Vulkan::Impl
@@ -0,0 +1,103 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include "HostAllocatorImpl.hpp"
+#include "LoaderImpl.hpp"
+#include "MemoryAllocatorImpl.hpp"
+
+#include <CuEngine/Vulkan/Buffer.hpp>
+
+#include <utility>
+
+namespace CuEngine::Vulkan::Impl
+{
+class Buffer
+{
+public:
+    explicit Buffer(VkDevice device, VkBuffer buffer, const MemoryAllocation & allocation, VkDeviceSize size) noexcept
+        : m_Device(device), m_Handle(buffer), m_Allocation(allocation), m_Size(size)
+    {}
+
+    Buffer(const Buffer & other) = delete;
+
+    Buffer(Buffer && other) noexcept
+        : m_Device(std::exchange(other.m_Device, VK_NULL_HANDLE)),
+          m_Handle(std::exchange(other.m_Handle, VK_NULL_HANDLE)),
+          m_Allocation(std::exchange(other.m_Allocation, MemoryAllocation())),
+          m_Size(std::exchange(other.m_Size, 0))
+    {}
+
+    Buffer & operator=(const Buffer & other) = delete;
+
+    Buffer & operator=(Buffer && other) noexcept
+    {
+        if (this != &other)
+        {
+            std::swap(m_Device, other.m_Device);
+            std::swap(m_Handle, other.m_Handle);
+            std::swap(m_Allocation, other.m_Allocation);
+            std::swap(m_Size, other.m_Size);
+        }
+
+        return *this;
+    }
+
+    ~Buffer() noexcept
+    {
+        if (m_Handle)
+        {
+            vkDestroyBuffer(m_Device, m_Handle, HostAllocator::GetCallbacks());
+            MemoryAllocator::Free(m_Allocation);
+        }
+    }
+
+    [[nodiscard]] VkBuffer GetHandle() const noexcept
+    {
+        return m_Handle;
+    }
+
+    [[nodiscard]] const MemoryAllocation & GetAllocation() const noexcept
+    {
+        return m_Allocation;
+    }
+
+    [[nodiscard]] VkDeviceSize GetSize() const noexcept
+    {
+        return m_Size;
+    }
+
+    [[nodiscard]] void * GetMappedData() const noexcept
+    {
+        return m_Allocation.mapped;
+    }
+
+private:
+    VkDevice         m_Device;
+    VkBuffer         m_Handle;
+    MemoryAllocation m_Allocation;
+    VkDeviceSize     m_Size;
+};
+} // namespace CuEngine::Vulkan::Impl
@@ -0,0 +1,117 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include "LoaderImpl.hpp"
+
+#include <CuEngine/Vulkan/CommandBuffer.hpp>
+#include <CuEngine/Vulkan/Synchronization.hpp>
+
+#include <stdexcept>
+
+namespace CuEngine::Vulkan::Impl
+{
+class CommandBuffer
+{
+public:
+    explicit CommandBuffer(VkCommandBuffer commandBuffer) noexcept : m_Handle(commandBuffer)
+    {}
+
+    void End()
+    {
+        if (vkEndCommandBuffer(m_Handle) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to end a command buffer");
+        }
+    }
+
+    void ExecuteCommands(const std::vector<VkCommandBuffer> & secondaryCommandBuffers) noexcept
+    {
+        if (!secondaryCommandBuffers.empty())
+        {
+            vkCmdExecuteCommands(m_Handle, static_cast<std::uint32_t>(secondaryCommandBuffers.size()),
+                                 secondaryCommandBuffers.data());
+        }
+    }
+
+    // Recorded on the source family's queue, the matching acquire has to be recorded on the destination family
+    void ReleaseOwnership(VkBuffer buffer, const BufferOwnershipTransfer & transfer) noexcept
+    {
+        if (transfer.sourceQueueFamily == transfer.destinationQueueFamily)
+        {
+            return;
+        }
+
+        RecordBufferBarrier(buffer, transfer.sourceQueueFamily, transfer.destinationQueueFamily,
+                            static_cast<VkPipelineStageFlags>(transfer.sourceStage),
+                            static_cast<VkAccessFlags>(transfer.sourceAccess), VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0);
+    }
+
+    // Within one family this degrades to an ordinary buffer barrier
+    void AcquireOwnership(VkBuffer buffer, const BufferOwnershipTransfer & transfer) noexcept
+    {
+        if (transfer.sourceQueueFamily == transfer.destinationQueueFamily)
+        {
+            RecordBufferBarrier(buffer, VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED,
+                                static_cast<VkPipelineStageFlags>(transfer.sourceStage),
+                                static_cast<VkAccessFlags>(transfer.sourceAccess),
+                                static_cast<VkPipelineStageFlags>(transfer.destinationStage),
+                                static_cast<VkAccessFlags>(transfer.destinationAccess));
+            return;
+        }
+
+        RecordBufferBarrier(buffer, transfer.sourceQueueFamily, transfer.destinationQueueFamily,
+                            VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, 0,
+                            static_cast<VkPipelineStageFlags>(transfer.destinationStage),
+                            static_cast<VkAccessFlags>(transfer.destinationAccess));
+    }
+
+    [[nodiscard]] VkCommandBuffer GetHandle() const noexcept
+    {
+        return m_Handle;
+    }
+
+private:
+    void RecordBufferBarrier(VkBuffer buffer, std::uint32_t sourceQueueFamily, std::uint32_t destinationQueueFamily,
+                             VkPipelineStageFlags sourceStage, VkAccessFlags sourceAccess,
+                             VkPipelineStageFlags destinationStage, VkAccessFlags destinationAccess) noexcept
+    {
+        auto barrier = VkBufferMemoryBarrier{ .sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+                                              .pNext               = nullptr,
+                                              .srcAccessMask       = sourceAccess,
+                                              .dstAccessMask       = destinationAccess,
+                                              .srcQueueFamilyIndex = sourceQueueFamily,
+                                              .dstQueueFamilyIndex = destinationQueueFamily,
+                                              .buffer              = buffer,
+                                              .offset              = 0,
+                                              .size                = VK_WHOLE_SIZE };
+
+        vkCmdPipelineBarrier(m_Handle, sourceStage, destinationStage, 0, 0, nullptr, 1, &barrier, 0, nullptr);
+    }
+
+private:
+    VkCommandBuffer m_Handle;
+};
+} // namespace CuEngine::Vulkan::Impl
@@ -0,0 +1,136 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include "CommandPoolSetImpl.hpp"
+#include "DeviceImpl.hpp"
+#include "HostAllocatorImpl.hpp"
+#include "LoaderImpl.hpp"
+#include "QueueFamilyImpl.hpp"
+
+#include <CuEngine/Vulkan/CommandPoolSetBuilder.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace CuEngine::Vulkan::Impl
+{
+class CommandPoolSetBuilder
+{
+public:
+    explicit CommandPoolSetBuilder() noexcept
+        : m_Device(VK_NULL_HANDLE), m_QueueFamilyIndex(0), m_FramesInFlight(2),
+          m_WorkerCount(std::max(std::thread::hardware_concurrency(), 1u))
+    {}
+
+    CommandPoolSetBuilder(const CommandPoolSetBuilder & other) = default;
+
+    CommandPoolSetBuilder(CommandPoolSetBuilder && other) noexcept = default;
+
+    CommandPoolSetBuilder & operator=(const CommandPoolSetBuilder & other) = default;
+
+    CommandPoolSetBuilder & operator=(CommandPoolSetBuilder && other) noexcept = default;
+
+    ~CommandPoolSetBuilder() noexcept = default;
+
+    CommandPoolSetBuilder & SetDevice(Device & device) noexcept
+    {
+        m_Device = device.GetHandle();
+
+        return *this;
+    }
+
+    CommandPoolSetBuilder & SetQueueFamily(const QueueFamily & queueFamily) noexcept
+    {
+        m_QueueFamilyIndex = queueFamily.GetIndex();
+
+        return *this;
+    }
+
+    CommandPoolSetBuilder & SetFramesInFlight(std::uint32_t framesInFlight) noexcept
+    {
+        m_FramesInFlight = framesInFlight;
+
+        return *this;
+    }
+
+    CommandPoolSetBuilder & SetWorkerCount(std::uint32_t workerCount) noexcept
+    {
+        m_WorkerCount = workerCount;
+
+        return *this;
+    }
+
+    [[nodiscard]] CommandPoolSet Build() const
+    {
+        if (m_Device == VK_NULL_HANDLE || m_FramesInFlight == 0 || m_WorkerCount == 0)
+        {
+            throw std::runtime_error("Failed to create a command pool set: invalid configuration");
+        }
+
+        auto primaryPools   = std::vector<CommandPoolSet::Pool>();
+        auto secondaryPools = std::vector<CommandPoolSet::Pool>();
+        primaryPools.reserve(m_FramesInFlight);
+        secondaryPools.reserve(m_FramesInFlight * m_WorkerCount);
+
+        try
+        {
+            for (auto frame = 0u; frame < m_FramesInFlight; ++frame)
+            {
+                primaryPools.push_back(
+                    CommandPoolSet::CreatePool(m_Device, m_QueueFamilyIndex, VK_COMMAND_BUFFER_LEVEL_PRIMARY));
+                for (auto worker = 0u; worker < m_WorkerCount; ++worker)
+                {
+                    secondaryPools.push_back(
+                        CommandPoolSet::CreatePool(m_Device, m_QueueFamilyIndex, VK_COMMAND_BUFFER_LEVEL_SECONDARY));
+                }
+            }
+        }
+        catch (...)
+        {
+            for (auto && pool : primaryPools)
+            {
+                vkDestroyCommandPool(m_Device, pool.handle, HostAllocator::GetCallbacks());
+            }
+            for (auto && pool : secondaryPools)
+            {
+                vkDestroyCommandPool(m_Device, pool.handle, HostAllocator::GetCallbacks());
+            }
+            throw;
+        }
+
+        return CommandPoolSet(m_Device, m_FramesInFlight, m_WorkerCount, std::move(primaryPools),
+                              std::move(secondaryPools));
+    }
+
+private:
+    VkDevice      m_Device;
+    std::uint32_t m_QueueFamilyIndex;
+    std::uint32_t m_FramesInFlight;
+    std::uint32_t m_WorkerCount;
+};
+} // namespace CuEngine::Vulkan::Impl
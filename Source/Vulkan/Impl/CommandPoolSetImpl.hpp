@@ -0,0 +1,324 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include "HostAllocatorImpl.hpp"
+#include "LoaderImpl.hpp"
+
+#include <CuEngine/Jobs/Scheduler.hpp>
+#include <CuEngine/Vulkan/CommandPoolSet.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace CuEngine::Vulkan::Impl
+{
+class CommandPoolSet
+{
+    static constexpr auto allocationBatchSize = 8u;
+
+public:
+    struct Pool
+    {
+        VkCommandPool                handle;
+        VkCommandBufferLevel         level;
+        std::uint32_t                usedCount;
+        std::vector<VkCommandBuffer> commandBuffers;
+    };
+
+    explicit CommandPoolSet(VkDevice device, std::uint32_t framesInFlight, std::uint32_t workerCount,
+                            std::vector<Pool> && primaryPools, std::vector<Pool> && secondaryPools) noexcept
+        : m_Device(device), m_FramesInFlight(framesInFlight), m_WorkerCount(workerCount), m_FrameIndex(0),
+          m_PrimaryPools(std::move(primaryPools)), m_SecondaryPools(std::move(secondaryPools))
+    {}
+
+    CommandPoolSet(const CommandPoolSet & other) = delete;
+
+    CommandPoolSet(CommandPoolSet && other) noexcept
+        : m_Device(std::exchange(other.m_Device, VK_NULL_HANDLE)),
+          m_FramesInFlight(std::exchange(other.m_FramesInFlight, 0)),
+          m_WorkerCount(std::exchange(other.m_WorkerCount, 0)), m_FrameIndex(std::exchange(other.m_FrameIndex, 0)),
+          m_PrimaryPools(std::move(other.m_PrimaryPools)), m_SecondaryPools(std::move(other.m_SecondaryPools))
+    {}
+
+    CommandPoolSet & operator=(const CommandPoolSet & other) = delete;
+
+    CommandPoolSet & operator=(CommandPoolSet && other) noexcept
+    {
+        if (this != &other)
+        {
+            std::swap(m_Device, other.m_Device);
+            std::swap(m_FramesInFlight, other.m_FramesInFlight);
+            std::swap(m_WorkerCount, other.m_WorkerCount);
+            std::swap(m_FrameIndex, other.m_FrameIndex);
+            std::swap(m_PrimaryPools, other.m_PrimaryPools);
+            std::swap(m_SecondaryPools, other.m_SecondaryPools);
+        }
+
+        return *this;
+    }
+
+    ~CommandPoolSet() noexcept
+    {
+        for (auto && pool : m_PrimaryPools)
+        {
+            vkDestroyCommandPool(m_Device, pool.handle, HostAllocator::GetCallbacks());
+        }
+
+        for (auto && pool : m_SecondaryPools)
+        {
+            vkDestroyCommandPool(m_Device, pool.handle, HostAllocator::GetCallbacks());
+        }
+    }
+
+    void BeginFrame(std::uint32_t frameIndex)
+    {
+        m_FrameIndex = frameIndex % m_FramesInFlight;
+
+        ResetPool(m_PrimaryPools[m_FrameIndex]);
+        for (auto worker = 0u; worker < m_WorkerCount; ++worker)
+        {
+            ResetPool(m_SecondaryPools[m_FrameIndex * m_WorkerCount + worker]);
+        }
+    }
+
+    [[nodiscard]] VkCommandBuffer BeginPrimary()
+    {
+        auto commandBuffer = AcquireCommandBuffer(m_PrimaryPools[m_FrameIndex]);
+
+        auto beginInfo = VkCommandBufferBeginInfo{ .sType            = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+                                                   .pNext            = nullptr,
+                                                   .flags            = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+                                                   .pInheritanceInfo = nullptr };
+        if (vkBeginCommandBuffer(commandBuffer, &beginInfo) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to begin a primary command buffer");
+        }
+
+        return commandBuffer;
+    }
+
+    // The inheritance info names the render pass or chains the dynamic rendering the secondary continues
+    [[nodiscard]] VkCommandBuffer BeginSecondary(std::uint32_t                          workerIndex,
+                                                 const VkCommandBufferInheritanceInfo & inheritanceInfo)
+    {
+        if (workerIndex >= m_WorkerCount)
+        {
+            throw std::runtime_error("Failed to begin a secondary command buffer: invalid worker index");
+        }
+
+        auto commandBuffer = AcquireCommandBuffer(m_SecondaryPools[m_FrameIndex * m_WorkerCount + workerIndex]);
+
+        auto flags = VkCommandBufferUsageFlags(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+        if (IsInsideRendering(inheritanceInfo))
+        {
+            flags |= VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+        }
+
+        auto beginInfo = VkCommandBufferBeginInfo{ .sType            = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+                                                   .pNext            = nullptr,
+                                                   .flags            = flags,
+                                                   .pInheritanceInfo = &inheritanceInfo };
+        if (vkBeginCommandBuffer(commandBuffer, &beginInfo) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to begin a secondary command buffer");
+        }
+
+        return commandBuffer;
+    }
+
+    void RecordSecondary(Jobs::Scheduler & scheduler, VkCommandBuffer primary,
+                         const VkCommandBufferInheritanceInfo & inheritanceInfo, std::uint32_t taskCount,
+                         const std::function<void(VkCommandBuffer, std::uint32_t)> & record)
+    {
+        if (taskCount == 0)
+        {
+            return;
+        }
+
+        auto secondaries = std::vector<VkCommandBuffer>(taskCount, VK_NULL_HANDLE);
+        auto nextTask    = std::atomic<std::uint32_t>(0);
+
+        auto recordTasks = [&](std::uint32_t workerIndex)
+        {
+            try
+            {
+                for (auto task = nextTask.fetch_add(1); task < taskCount; task = nextTask.fetch_add(1))
+                {
+                    auto commandBuffer = BeginSecondary(workerIndex, inheritanceInfo);
+                    record(commandBuffer, task);
+                    if (vkEndCommandBuffer(commandBuffer) != VK_SUCCESS)
+                    {
+                        throw std::runtime_error("Failed to end a secondary command buffer");
+                    }
+                    secondaries[task] = commandBuffer;
+                }
+            }
+            catch (...)
+            {
+                // The remaining jobs stop early, the scheduler rethrows the exception from Wait
+                nextTask = taskCount;
+                throw;
+            }
+        };
+
+        // One job per secondary pool, so a pool is never recorded into from two threads at once
+        auto jobCount = std::min({ taskCount, m_WorkerCount, std::max(scheduler.GetWorkerCount(), 1u) });
+        auto counter  = scheduler.Schedule(jobCount, recordTasks);
+        scheduler.Wait(counter);
+
+        vkCmdExecuteCommands(primary, taskCount, secondaries.data());
+    }
+
+    [[nodiscard]] std::uint32_t GetFramesInFlight() const noexcept
+    {
+        return m_FramesInFlight;
+    }
+
+    [[nodiscard]] std::uint32_t GetWorkerCount() const noexcept
+    {
+        return m_WorkerCount;
+    }
+
+    // Chained structures have to outlive the recording, so the caller owns the formats and the rendering info
+    [[nodiscard]] static VkCommandBufferInheritanceInfo GetInheritanceInfo(
+        const SecondaryInheritance & inheritance, std::vector<VkFormat> & colorFormats,
+        VkCommandBufferInheritanceRenderingInfo & renderingInfo) noexcept
+    {
+        colorFormats.resize(inheritance.colorFormats.size());
+        std::ranges::transform(inheritance.colorFormats, colorFormats.begin(),
+                               [](Format format)
+                               {
+                                   return static_cast<VkFormat>(format);
+                               });
+
+        renderingInfo = VkCommandBufferInheritanceRenderingInfo{
+            .sType                   = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO,
+            .pNext                   = nullptr,
+            .flags                   = {},
+            .viewMask                = 0,
+            .colorAttachmentCount    = static_cast<std::uint32_t>(colorFormats.size()),
+            .pColorAttachmentFormats = colorFormats.data(),
+            .depthAttachmentFormat   = static_cast<VkFormat>(inheritance.depthFormat),
+            .stencilAttachmentFormat = static_cast<VkFormat>(inheritance.stencilFormat),
+            .rasterizationSamples    = VK_SAMPLE_COUNT_1_BIT,
+        };
+
+        auto isInsideRendering = !colorFormats.empty() || inheritance.depthFormat != Format::Undefined
+                                 || inheritance.stencilFormat != Format::Undefined;
+
+        return VkCommandBufferInheritanceInfo{
+            .sType                = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO,
+            .pNext                = isInsideRendering ? &renderingInfo : nullptr,
+            .renderPass           = VK_NULL_HANDLE,
+            .subpass              = 0,
+            .framebuffer          = VK_NULL_HANDLE,
+            .occlusionQueryEnable = VK_FALSE,
+            .queryFlags           = 0,
+            .pipelineStatistics   = 0,
+        };
+    }
+
+    [[nodiscard]] static Pool CreatePool(VkDevice device, std::uint32_t queueFamilyIndex, VkCommandBufferLevel level)
+    {
+        auto poolInfo = VkCommandPoolCreateInfo{ .sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+                                                 .pNext            = nullptr,
+                                                 .flags            = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT,
+                                                 .queueFamilyIndex = queueFamilyIndex };
+
+        auto pool = Pool{ .handle = VK_NULL_HANDLE, .level = level, .usedCount = 0, .commandBuffers = {} };
+        if (vkCreateCommandPool(device, &poolInfo, HostAllocator::GetCallbacks(), &pool.handle) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create a command pool");
+        }
+
+        return pool;
+    }
+
+private:
+    [[nodiscard]] static bool IsInsideRendering(const VkCommandBufferInheritanceInfo & inheritanceInfo) noexcept
+    {
+        if (inheritanceInfo.renderPass != VK_NULL_HANDLE)
+        {
+            return true;
+        }
+
+        for (auto next = static_cast<const VkBaseInStructure *>(inheritanceInfo.pNext); next != nullptr;
+             next      = next->pNext)
+        {
+            if (next->sType == VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void ResetPool(Pool & pool)
+    {
+        if (vkResetCommandPool(m_Device, pool.handle, 0) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to reset a command pool");
+        }
+        pool.usedCount = 0;
+    }
+
+    [[nodiscard]] VkCommandBuffer AcquireCommandBuffer(Pool & pool)
+    {
+        if (pool.usedCount == pool.commandBuffers.size())
+        {
+            auto allocateInfo = VkCommandBufferAllocateInfo{
+                .sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+                .pNext              = nullptr,
+                .commandPool        = pool.handle,
+                .level              = pool.level,
+                .commandBufferCount = allocationBatchSize,
+            };
+
+            auto commandBuffers = std::vector<VkCommandBuffer>(allocationBatchSize);
+            if (vkAllocateCommandBuffers(m_Device, &allocateInfo, commandBuffers.data()) != VK_SUCCESS)
+            {
+                throw std::runtime_error("Failed to allocate command buffers");
+            }
+            pool.commandBuffers.insert(pool.commandBuffers.end(), commandBuffers.begin(), commandBuffers.end());
+        }
+
+        return pool.commandBuffers[pool.usedCount++];
+    }
+
+private:
+    VkDevice          m_Device;
+    std::uint32_t     m_FramesInFlight;
+    std::uint32_t     m_WorkerCount;
+    std::uint32_t     m_FrameIndex;
+    std::vector<Pool> m_PrimaryPools;
+    std::vector<Pool> m_SecondaryPools;
+};
+} // namespace CuEngine::Vulkan::Impl
@@ -0,0 +1,195 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Vulkan/Buffer.hpp>
+#include <CuEngine/Vulkan/DeletionQueue.hpp>
+#include <CuEngine/Vulkan/Image.hpp>
+#include <CuEngine/Vulkan/RenderGraph.hpp>
+#include <CuEngine/Vulkan/TimelineSemaphore.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace CuEngine::Vulkan::Impl
+{
+class DeletionQueue
+{
+    // Runs the destroy function when it goes away, like the wrappers do in their destructors
+    class Deleter
+    {
+    public:
+        explicit Deleter(std::function<void()> destroy) noexcept : m_Destroy(std::move(destroy))
+        {}
+
+        Deleter(const Deleter & other) = delete;
+
+        Deleter(Deleter && other) noexcept : m_Destroy(std::exchange(other.m_Destroy, nullptr))
+        {}
+
+        Deleter & operator=(const Deleter & other) = delete;
+
+        Deleter & operator=(Deleter && other) noexcept
+        {
+            if (this != &other)
+            {
+                std::swap(m_Destroy, other.m_Destroy);
+            }
+
+            return *this;
+        }
+
+        ~Deleter() noexcept
+        {
+            if (m_Destroy)
+            {
+                m_Destroy();
+            }
+        }
+
+    private:
+        std::function<void()> m_Destroy;
+    };
+
+    using Resource = std::variant<Vulkan::Buffer, Vulkan::Image, Vulkan::RenderGraph, Deleter>;
+
+    struct Entry
+    {
+        const Vulkan::TimelineSemaphore * semaphore;
+        std::uint64_t                     value;
+        Resource                          resource;
+    };
+
+    struct State
+    {
+        mutable std::mutex mutex;
+        std::vector<Entry> entries;
+    };
+
+public:
+    explicit DeletionQueue(std::unique_ptr<State> state) noexcept : m_State(std::move(state))
+    {}
+
+    DeletionQueue(const DeletionQueue & other) = delete;
+
+    DeletionQueue(DeletionQueue && other) noexcept = default;
+
+    DeletionQueue & operator=(const DeletionQueue & other) = delete;
+
+    DeletionQueue & operator=(DeletionQueue && other) noexcept
+    {
+        if (this != &other)
+        {
+            std::swap(m_State, other.m_State);
+        }
+
+        return *this;
+    }
+
+    ~DeletionQueue() noexcept
+    {
+        Flush();
+    }
+
+    template <typename ResourceT>
+    void Retire(ResourceT && resource, const Vulkan::TimelineSemaphore & semaphore, std::uint64_t value)
+    {
+        auto lock = std::scoped_lock(m_State->mutex);
+        m_State->entries.push_back(
+            Entry{ .semaphore = &semaphore, .value = value, .resource = Resource(std::forward<ResourceT>(resource)) });
+    }
+
+    void Retire(std::function<void()> destroy, const Vulkan::TimelineSemaphore & semaphore, std::uint64_t value)
+    {
+        Retire(Deleter(std::move(destroy)), semaphore, value);
+    }
+
+    std::size_t Collect()
+    {
+        auto released = std::vector<Entry>();
+        {
+            auto lock = std::scoped_lock(m_State->mutex);
+
+            // Each semaphore is read once, however many entries wait on it
+            auto completedValues = std::vector<std::pair<const Vulkan::TimelineSemaphore *, std::uint64_t>>();
+            auto isPending       = [&completedValues](const Entry & entry)
+            {
+                auto it = std::ranges::find_if(completedValues,
+                                               [&entry](const auto & completedValue)
+                                               {
+                                                   return completedValue.first == entry.semaphore;
+                                               });
+                if (it == std::end(completedValues))
+                {
+                    it = completedValues.emplace(std::end(completedValues), entry.semaphore,
+                                                 entry.semaphore->GetValue());
+                }
+
+                return entry.value > it->second;
+            };
+
+            auto & entries  = m_State->entries;
+            auto   complete = std::stable_partition(std::begin(entries), std::end(entries), isPending);
+            released.assign(std::make_move_iterator(complete), std::make_move_iterator(std::end(entries)));
+            entries.erase(complete, std::end(entries));
+        }
+
+        // The resources are destroyed here, outside the lock
+        return released.size();
+    }
+
+    void Flush() noexcept
+    {
+        if (!m_State)
+        {
+            return;
+        }
+
+        auto released = std::vector<Entry>();
+        {
+            auto lock = std::scoped_lock(m_State->mutex);
+            std::swap(released, m_State->entries);
+        }
+    }
+
+    [[nodiscard]] std::size_t GetPendingCount() const noexcept
+    {
+        auto lock = std::scoped_lock(m_State->mutex);
+
+        return m_State->entries.size();
+    }
+
+    [[nodiscard]] static DeletionQueue Create()
+    {
+        return DeletionQueue(std::make_unique<State>());
+    }
+
+private:
+    std::unique_ptr<State> m_State;
+};
+} // namespace CuEngine::Vulkan::Impl
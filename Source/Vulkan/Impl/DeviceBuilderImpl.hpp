@@ -27,10 +27,16 @@
 #include <CuEngine/Vulkan/DeviceBuilder.hpp>
 
 #include "DeviceImpl.hpp"
+#include "HostAllocatorImpl.hpp"
+#include "LoaderImpl.hpp"
+#include "MemoryAllocatorImpl.hpp"
 #include "PhysicalDeviceImpl.hpp"
+#include "PipelineCacheImpl.hpp"
 #include "QueueFamilyImpl.hpp"
 
+#include <filesystem>
 #include <map>
+#include <memory>
 
 namespace CuEngine::Vulkan::Impl
 {
@@ -43,7 +49,8 @@ class DeviceBuilder
     };
 
 public:
-    explicit DeviceBuilder() noexcept : m_PhysicalDevice(VK_NULL_HANDLE), m_QueueMapping()
+    explicit DeviceBuilder() noexcept
+        : m_PhysicalDevice(), m_IsHeadless(false), m_QueueMapping(), m_PipelineCachePath()
     {}
 
     DeviceBuilder(const DeviceBuilder & other) = default;
@@ -58,7 +65,14 @@ public:
 
     DeviceBuilder & SetPhysicalDevice(PhysicalDevice & device) noexcept
     {
-        m_PhysicalDevice = device.GetHandle();
+        m_PhysicalDevice = device.GetSharedInfo();
+
+        return *this;
+    }
+
+    DeviceBuilder & SetHeadless(bool isHeadless) noexcept
+    {
+        m_IsHeadless = isHeadless;
 
         return *this;
     }
@@ -71,6 +85,13 @@ public:
         return *this;
     }
 
+    DeviceBuilder & SetPipelineCachePath(const std::filesystem::path & path)
+    {
+        m_PipelineCachePath = path;
+
+        return *this;
+    }
+
     [[nodiscard]] Device Build() const
     {
         auto queueInfos = std::vector<VkDeviceQueueCreateInfo>(m_QueueMapping.size());
@@ -90,22 +111,65 @@ public:
                                                                        queueParameters.queuePriorities.data() };
                                });
 
-        auto deviceFeatures = VkPhysicalDeviceFeatures{};
+        if (!m_PhysicalDevice)
+        {
+            throw std::runtime_error("Failed to create a device: no physical device");
+        }
+        const auto & info       = *m_PhysicalDevice;
+        const auto & properties = info.GetProperties();
+
+        // Only what the engine actually uses, pipeline statistics feed the GPU profiler where available
+        auto deviceFeatures                    = VkPhysicalDeviceFeatures{};
+        deviceFeatures.pipelineStatisticsQuery = info.GetFeatures().pipelineStatisticsQuery;
+
+        auto requiredExtensions = std::vector<const char *>();
+        if (!m_IsHeadless)
+        {
+            requiredExtensions.push_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+        }
+        std::ranges::for_each(requiredExtensions,
+                              [&info](const auto & extension)
+                              {
+                                  if (!info.HasExtension(extension))
+                                  {
+                                      throw std::runtime_error(std::string("Extension ") + extension
+                                                               + " not supported");
+                                  }
+                              });
+
+        // Timeline semaphores are core since 1.2, every submission and upload waits on them
+        if (info.GetVulkan12Features().timelineSemaphore != VK_TRUE)
+        {
+            throw std::runtime_error("Timeline semaphores not supported");
+        }
 
-        auto requiredExtensions = std::vector<const char *>{ VK_KHR_SWAPCHAIN_EXTENSION_NAME };
-        std::ranges::for_each(
-            requiredExtensions,
-            [supportedExtensions = GetSupportedExtensions()](const auto & extension)
-            {
-                if (std::ranges::end(supportedExtensions) == std::ranges::find(supportedExtensions, extension))
-                {
-                    throw std::runtime_error(std::string("Extension ") + extension + " not supported");
-                }
-            });
+        auto vulkan12Features              = VkPhysicalDeviceVulkan12Features();
+        vulkan12Features.sType             = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+        vulkan12Features.timelineSemaphore = VK_TRUE;
+
+        // The instance asks for 1.3, so the device runs at whichever of the two is lower
+        auto apiVersion = std::min(properties.apiVersion, static_cast<std::uint32_t>(VK_API_VERSION_1_3));
+
+        auto vulkan13Features  = VkPhysicalDeviceVulkan13Features();
+        vulkan13Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES;
+        if (apiVersion >= VK_API_VERSION_1_3)
+        {
+            vulkan13Features.synchronization2 = VK_TRUE;
+            vulkan13Features.dynamicRendering = VK_TRUE;
+            vulkan12Features.pNext            = &vulkan13Features;
+        }
+
+        // Pipeline cache hits are only reported through creation feedback
+        auto hasCreationFeedback = apiVersion >= VK_API_VERSION_1_3;
+        if (!hasCreationFeedback && info.HasExtension(VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME))
+        {
+            requiredExtensions.push_back(VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME);
+            hasCreationFeedback = true;
+        }
 
         auto deviceInfo = VkDeviceCreateInfo{
             .sType                   = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
-            .pNext                   = nullptr,
+            .pNext                   = &vulkan12Features,
             .flags                   = {},
             .queueCreateInfoCount    = static_cast<std::uint32_t>(queueInfos.size()),
             .pQueueCreateInfos       = queueInfos.data(),
@@ -117,41 +181,31 @@ public:
         };
 
         auto device = VkDevice(VK_NULL_HANDLE);
-        if (vkCreateDevice(m_PhysicalDevice, &deviceInfo, nullptr, &device) != VK_SUCCESS)
+        if (vkCreateDevice(info.GetHandle(), &deviceInfo, HostAllocator::GetCallbacks(), &device) != VK_SUCCESS)
         {
             throw std::runtime_error("Failed to create a device!");
         }
+        Loader::LoadDevice(device);
 
-        return Device(device);
-    }
-
-private:
-    [[nodiscard]] std::vector<std::string> GetSupportedExtensions() const
-    {
-        auto count = std::uint32_t();
-        if (vkEnumerateDeviceExtensionProperties(m_PhysicalDevice, nullptr, &count, nullptr) != VK_SUCCESS)
+        try
         {
-            throw std::runtime_error("Failed to get supported Vulkan Device extensions");
-        }
+            auto pipelineCache   = PipelineCache::Create(device, info, m_PipelineCachePath, hasCreationFeedback);
+            auto memoryAllocator = MemoryAllocator::Create(device, info);
 
-        auto properties = std::vector<VkExtensionProperties>(count);
-        if (vkEnumerateDeviceExtensionProperties(m_PhysicalDevice, nullptr, &count, properties.data()) != VK_SUCCESS)
+            return Device(device, std::move(pipelineCache), std::move(memoryAllocator), DeletionQueue::Create(),
+                          apiVersion, deviceFeatures.pipelineStatisticsQuery == VK_TRUE);
+        }
+        catch (...)
         {
-            throw std::runtime_error("Failed to get supported Vulkan Device extensions");
+            vkDestroyDevice(device, HostAllocator::GetCallbacks());
+            throw;
         }
-
-        auto extensions = std::vector<std::string>(count);
-        std::ranges::transform(properties, extensions.begin(),
-                               [](const auto & property)
-                               {
-                                   return std::string(property.extensionName);
-                               });
-
-        return extensions;
     }
 
 private:
-    VkPhysicalDevice                       m_PhysicalDevice;
-    std::map<QueueFamily, QueueParameters> m_QueueMapping;
+    std::shared_ptr<const PhysicalDeviceInfo> m_PhysicalDevice;
+    bool                                      m_IsHeadless;
+    std::map<QueueFamily, QueueParameters>    m_QueueMapping;
+    std::filesystem::path                     m_PipelineCachePath;
 };
 } // namespace CuEngine::Vulkan::Impl
@@ -24,7 +24,12 @@
 
 #include <vulkan/vulkan.h>
 
+#include "DeletionQueueImpl.hpp"
+#include "HostAllocatorImpl.hpp"
+#include "LoaderImpl.hpp"
+#include "MemoryAllocatorImpl.hpp"
 #include "PhysicalDeviceImpl.hpp"
+#include "PipelineCacheImpl.hpp"
 #include "QueueFamilyImpl.hpp"
 
 #include <CuEngine/Vulkan/Device.hpp>
@@ -34,12 +39,20 @@ namespace CuEngine::Vulkan::Impl
 class Device
 {
 public:
-    explicit Device(VkDevice device) noexcept : m_Handle(device)
+    explicit Device(VkDevice device, PipelineCache && pipelineCache, MemoryAllocator && memoryAllocator,
+                    DeletionQueue && deletionQueue, std::uint32_t apiVersion, bool hasPipelineStatistics) noexcept
+        : m_Handle(device), m_PipelineCache(std::move(pipelineCache)), m_MemoryAllocator(std::move(memoryAllocator)),
+          m_DeletionQueue(std::move(deletionQueue)), m_ApiVersion(apiVersion),
+          m_HasPipelineStatistics(hasPipelineStatistics)
     {}
 
     Device(const Device & other) = delete;
 
-    Device(Device && other) noexcept : m_Handle(std::exchange(other.m_Handle, VK_NULL_HANDLE))
+    Device(Device && other) noexcept
+        : m_Handle(std::exchange(other.m_Handle, VK_NULL_HANDLE)), m_PipelineCache(std::move(other.m_PipelineCache)),
+          m_MemoryAllocator(std::move(other.m_MemoryAllocator)), m_DeletionQueue(std::move(other.m_DeletionQueue)),
+          m_ApiVersion(std::exchange(other.m_ApiVersion, 0)),
+          m_HasPipelineStatistics(std::exchange(other.m_HasPipelineStatistics, false))
     {}
 
     Device & operator=(const Device & other) = delete;
@@ -49,6 +62,11 @@ public:
         if (this != &other)
         {
             std::swap(m_Handle, other.m_Handle);
+            std::swap(m_PipelineCache, other.m_PipelineCache);
+            std::swap(m_MemoryAllocator, other.m_MemoryAllocator);
+            std::swap(m_DeletionQueue, other.m_DeletionQueue);
+            std::swap(m_ApiVersion, other.m_ApiVersion);
+            std::swap(m_HasPipelineStatistics, other.m_HasPipelineStatistics);
         }
 
         return *this;
@@ -56,7 +74,20 @@ public:
 
     ~Device() noexcept
     {
-        vkDestroyDevice(m_Handle, nullptr);
+        if (m_Handle)
+        {
+            // Whatever is still queued may be in use until the device is idle, and must go before the allocator
+            if (m_DeletionQueue.GetPendingCount() != 0)
+            {
+                vkDeviceWaitIdle(m_Handle);
+            }
+            m_DeletionQueue.Flush();
+
+            m_PipelineCache.GetImpl().Release();
+            m_MemoryAllocator.GetImpl().Release();
+        }
+
+        vkDestroyDevice(m_Handle, HostAllocator::GetCallbacks());
     }
 
     [[nodiscard]] VkDevice GetHandle() const noexcept
@@ -64,7 +95,43 @@ public:
         return m_Handle;
     }
 
+    [[nodiscard]] Vulkan::PipelineCache & GetPipelineCache() noexcept
+    {
+        return m_PipelineCache;
+    }
+
+    [[nodiscard]] Vulkan::MemoryAllocator & GetMemoryAllocator() noexcept
+    {
+        return m_MemoryAllocator;
+    }
+
+    [[nodiscard]] Vulkan::DeletionQueue & GetDeletionQueue() noexcept
+    {
+        return m_DeletionQueue;
+    }
+
+    [[nodiscard]] std::uint32_t GetApiVersion() const noexcept
+    {
+        return m_ApiVersion;
+    }
+
+    // Mandatory in 1.3, so it is enabled whenever the device runs at that version
+    [[nodiscard]] bool HasSynchronization2() const noexcept
+    {
+        return m_ApiVersion >= VK_API_VERSION_1_3;
+    }
+
+    [[nodiscard]] bool HasPipelineStatistics() const noexcept
+    {
+        return m_HasPipelineStatistics;
+    }
+
 private:
-    VkDevice m_Handle;
+    VkDevice                m_Handle;
+    Vulkan::PipelineCache   m_PipelineCache;
+    Vulkan::MemoryAllocator m_MemoryAllocator;
+    Vulkan::DeletionQueue   m_DeletionQueue;
+    std::uint32_t           m_ApiVersion;
+    bool                    m_HasPipelineStatistics;
 };
 } // namespace CuEngine::Vulkan::Impl
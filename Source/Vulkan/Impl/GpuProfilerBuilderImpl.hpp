@@ -0,0 +1,170 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include "DeviceImpl.hpp"
+#include "GpuProfilerImpl.hpp"
+#include "HostAllocatorImpl.hpp"
+#include "LoaderImpl.hpp"
+#include "PhysicalDeviceImpl.hpp"
+#include "QueueFamilyImpl.hpp"
+
+#include <CuEngine/Vulkan/GpuProfilerBuilder.hpp>
+
+#include <stdexcept>
+#include <vector>
+
+namespace CuEngine::Vulkan::Impl
+{
+class GpuProfilerBuilder
+{
+public:
+    explicit GpuProfilerBuilder() noexcept
+        : m_PhysicalDevice(nullptr), m_Device(nullptr), m_QueueFamilyIndex(0), m_FramesInFlight(2),
+          m_MaxScopesPerFrame(64), m_HistorySize(128)
+    {}
+
+    GpuProfilerBuilder(const GpuProfilerBuilder & other) = default;
+
+    GpuProfilerBuilder(GpuProfilerBuilder && other) noexcept = default;
+
+    GpuProfilerBuilder & operator=(const GpuProfilerBuilder & other) = default;
+
+    GpuProfilerBuilder & operator=(GpuProfilerBuilder && other) noexcept = default;
+
+    ~GpuProfilerBuilder() noexcept = default;
+
+    GpuProfilerBuilder & SetPhysicalDevice(PhysicalDevice & physicalDevice) noexcept
+    {
+        m_PhysicalDevice = &physicalDevice;
+
+        return *this;
+    }
+
+    GpuProfilerBuilder & SetDevice(Device & device) noexcept
+    {
+        m_Device = &device;
+
+        return *this;
+    }
+
+    GpuProfilerBuilder & SetQueueFamily(const QueueFamily & queueFamily) noexcept
+    {
+        m_QueueFamilyIndex = queueFamily.GetIndex();
+
+        return *this;
+    }
+
+    GpuProfilerBuilder & SetFramesInFlight(std::uint32_t framesInFlight) noexcept
+    {
+        m_FramesInFlight = framesInFlight;
+
+        return *this;
+    }
+
+    GpuProfilerBuilder & SetMaxScopesPerFrame(std::uint32_t maxScopesPerFrame) noexcept
+    {
+        m_MaxScopesPerFrame = maxScopesPerFrame;
+
+        return *this;
+    }
+
+    GpuProfilerBuilder & SetHistorySize(std::uint32_t historySize) noexcept
+    {
+        m_HistorySize = historySize;
+
+        return *this;
+    }
+
+    [[nodiscard]] GpuProfiler Build() const
+    {
+        if (m_PhysicalDevice == nullptr || m_Device == nullptr || m_FramesInFlight == 0
+            || m_MaxScopesPerFrame == 0 || m_HistorySize == 0)
+        {
+            throw std::runtime_error("Failed to create a GPU profiler: invalid configuration");
+        }
+
+        const auto & families = m_PhysicalDevice->GetInfo().GetQueueFamilies();
+        if (m_QueueFamilyIndex >= families.size() || families[m_QueueFamilyIndex].timestampValidBits == 0)
+        {
+            throw std::runtime_error("Failed to create a GPU profiler: the queue family does not support timestamps");
+        }
+
+        const auto & family = families[m_QueueFamilyIndex];
+        auto         device = m_Device->GetHandle();
+
+        auto timestampCount = m_FramesInFlight * m_MaxScopesPerFrame * 2;
+        auto timestampPool  = CreateQueryPool(device, VK_QUERY_TYPE_TIMESTAMP, timestampCount, 0);
+
+        // Pipeline statistics queries are only allowed on graphics queues
+        auto pipelineStatisticsPool = VkQueryPool(VK_NULL_HANDLE);
+        if (m_Device->HasPipelineStatistics() && (family.queueFlags & VK_QUEUE_GRAPHICS_BIT) != 0)
+        {
+            try
+            {
+                pipelineStatisticsPool = CreateQueryPool(device, VK_QUERY_TYPE_PIPELINE_STATISTICS,
+                                                         m_FramesInFlight * m_MaxScopesPerFrame,
+                                                         GpuProfiler::pipelineStatistics);
+            }
+            catch (...)
+            {
+                vkDestroyQueryPool(device, timestampPool, HostAllocator::GetCallbacks());
+                throw;
+            }
+        }
+
+        return GpuProfiler(device, timestampPool, pipelineStatisticsPool, m_PhysicalDevice->GetTimestampPeriod(),
+                           family.timestampValidBits, m_FramesInFlight, m_MaxScopesPerFrame, m_HistorySize);
+    }
+
+private:
+    [[nodiscard]] static VkQueryPool CreateQueryPool(VkDevice device, VkQueryType type, std::uint32_t count,
+                                                     VkQueryPipelineStatisticFlags pipelineStatistics)
+    {
+        auto createInfo = VkQueryPoolCreateInfo{ .sType              = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+                                                 .pNext              = nullptr,
+                                                 .flags              = 0,
+                                                 .queryType          = type,
+                                                 .queryCount         = count,
+                                                 .pipelineStatistics = pipelineStatistics };
+
+        auto queryPool = VkQueryPool(VK_NULL_HANDLE);
+        if (vkCreateQueryPool(device, &createInfo, HostAllocator::GetCallbacks(), &queryPool) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create a query pool");
+        }
+
+        return queryPool;
+    }
+
+private:
+    PhysicalDevice * m_PhysicalDevice;
+    Device *         m_Device;
+    std::uint32_t    m_QueueFamilyIndex;
+    std::uint32_t    m_FramesInFlight;
+    std::uint32_t    m_MaxScopesPerFrame;
+    std::uint32_t    m_HistorySize;
+};
+} // namespace CuEngine::Vulkan::Impl
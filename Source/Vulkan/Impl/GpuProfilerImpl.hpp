@@ -0,0 +1,417 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include "CommandBufferImpl.hpp"
+#include "HostAllocatorImpl.hpp"
+#include "LoaderImpl.hpp"
+
+#include <CuEngine/Vulkan/GpuProfiler.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace CuEngine::Vulkan::Impl
+{
+class GpuProfiler
+{
+public:
+    static constexpr auto pipelineStatisticCount = 4u;
+    static constexpr auto pipelineStatistics =
+        VkQueryPipelineStatisticFlags(VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_PRIMITIVES_BIT
+                                      | VK_QUERY_PIPELINE_STATISTIC_VERTEX_SHADER_INVOCATIONS_BIT
+                                      | VK_QUERY_PIPELINE_STATISTIC_FRAGMENT_SHADER_INVOCATIONS_BIT
+                                      | VK_QUERY_PIPELINE_STATISTIC_COMPUTE_SHADER_INVOCATIONS_BIT);
+
+private:
+    static constexpr auto noQuery = std::numeric_limits<std::uint32_t>::max();
+
+    struct Sample
+    {
+        double                                            milliseconds;
+        bool                                              hasPipelineStatistics;
+        std::array<std::uint64_t, pipelineStatisticCount> pipelineStatistics;
+    };
+
+    // Fixed size ring, the oldest sample is overwritten once the window is full
+    struct ScopeHistory
+    {
+        std::string         name;
+        std::vector<Sample> samples;
+        std::uint32_t       next;
+    };
+
+    struct RecordedScope
+    {
+        std::uint32_t scope;
+        std::uint32_t timestampQuery;
+        std::uint32_t pipelineStatisticsQuery;
+    };
+
+    struct Frame
+    {
+        std::vector<RecordedScope> scopes;
+        std::uint32_t              pipelineStatisticsCount;
+    };
+
+    struct State
+    {
+        VkDevice                                          device;
+        VkQueryPool                                       timestampPool;
+        VkQueryPool                                       pipelineStatisticsPool;
+        double                                            timestampPeriod;
+        std::uint64_t                                     timestampMask;
+        std::uint32_t                                     maxScopesPerFrame;
+        std::uint32_t                                     historySize;
+        std::uint32_t                                     frameIndex;
+        std::vector<Frame>                                frames;
+        std::vector<std::uint32_t>                        openScopes;
+        bool                                              isPipelineStatisticsActive;
+        std::map<std::string, std::uint32_t, std::less<>> scopeIndices;
+        std::vector<ScopeHistory>                         histories;
+        std::vector<std::uint64_t>                        timestampResults;
+        std::vector<std::uint64_t>                        pipelineStatisticsResults;
+    };
+
+public:
+    explicit GpuProfiler(VkDevice device, VkQueryPool timestampPool, VkQueryPool pipelineStatisticsPool,
+                         float timestampPeriod, std::uint32_t timestampValidBits, std::uint32_t framesInFlight,
+                         std::uint32_t maxScopesPerFrame, std::uint32_t historySize)
+        : m_State(new State{ .device                     = device,
+                             .timestampPool              = timestampPool,
+                             .pipelineStatisticsPool     = pipelineStatisticsPool,
+                             .timestampPeriod            = timestampPeriod,
+                             .timestampMask              = GetTimestampMask(timestampValidBits),
+                             .maxScopesPerFrame          = maxScopesPerFrame,
+                             .historySize                = historySize,
+                             .frameIndex                 = 0,
+                             .frames                     = std::vector<Frame>(framesInFlight),
+                             .openScopes                 = {},
+                             .isPipelineStatisticsActive = false,
+                             .scopeIndices               = {},
+                             .histories                  = {},
+                             .timestampResults           = {},
+                             .pipelineStatisticsResults  = {} })
+    {}
+
+    GpuProfiler(const GpuProfiler & other) = delete;
+
+    GpuProfiler(GpuProfiler && other) noexcept = default;
+
+    GpuProfiler & operator=(const GpuProfiler & other) = delete;
+
+    GpuProfiler & operator=(GpuProfiler && other) noexcept
+    {
+        if (this != &other)
+        {
+            std::swap(m_State, other.m_State);
+        }
+
+        return *this;
+    }
+
+    ~GpuProfiler() noexcept
+    {
+        if (!m_State)
+        {
+            return;
+        }
+
+        vkDestroyQueryPool(m_State->device, m_State->pipelineStatisticsPool, HostAllocator::GetCallbacks());
+        vkDestroyQueryPool(m_State->device, m_State->timestampPool, HostAllocator::GetCallbacks());
+    }
+
+    void BeginFrame(VkCommandBuffer commandBuffer, std::uint32_t frameIndex)
+    {
+        auto & state = *m_State;
+        if (frameIndex >= state.frames.size())
+        {
+            throw std::runtime_error("Failed to begin a GPU profiler frame: frame index out of range");
+        }
+        if (!state.openScopes.empty())
+        {
+            throw std::runtime_error("Failed to begin a GPU profiler frame: the previous frame has open scopes");
+        }
+
+        state.frameIndex = frameIndex;
+
+        auto & frame = state.frames[frameIndex];
+        Collect(frame);
+        frame.scopes.clear();
+        frame.pipelineStatisticsCount = 0;
+
+        vkCmdResetQueryPool(commandBuffer, state.timestampPool, GetFirstTimestampQuery(),
+                            state.maxScopesPerFrame * 2);
+        if (state.pipelineStatisticsPool != VK_NULL_HANDLE)
+        {
+            vkCmdResetQueryPool(commandBuffer, state.pipelineStatisticsPool, GetFirstPipelineStatisticsQuery(),
+                                state.maxScopesPerFrame);
+        }
+    }
+
+    void BeginScope(VkCommandBuffer commandBuffer, std::string_view name)
+    {
+        auto & state = *m_State;
+        auto & frame = state.frames[state.frameIndex];
+        if (frame.scopes.size() == state.maxScopesPerFrame)
+        {
+            state.openScopes.push_back(noQuery);
+            return;
+        }
+
+        auto scopeIt = state.scopeIndices.find(name);
+        if (scopeIt == std::end(state.scopeIndices))
+        {
+            scopeIt = state.scopeIndices.emplace(std::string(name), static_cast<std::uint32_t>(state.histories.size()))
+                          .first;
+            state.histories.push_back(ScopeHistory{ .name = std::string(name), .samples = {}, .next = 0 });
+        }
+
+        auto timestampQuery = GetFirstTimestampQuery() + static_cast<std::uint32_t>(frame.scopes.size()) * 2;
+        vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, state.timestampPool, timestampQuery);
+
+        // Queries of one type can not be nested, so only the outermost scope gets pipeline statistics
+        auto pipelineStatisticsQuery = noQuery;
+        if (state.pipelineStatisticsPool != VK_NULL_HANDLE && !state.isPipelineStatisticsActive)
+        {
+            pipelineStatisticsQuery = GetFirstPipelineStatisticsQuery() + frame.pipelineStatisticsCount++;
+            vkCmdBeginQuery(commandBuffer, state.pipelineStatisticsPool, pipelineStatisticsQuery, 0);
+            state.isPipelineStatisticsActive = true;
+        }
+
+        state.openScopes.push_back(static_cast<std::uint32_t>(frame.scopes.size()));
+        frame.scopes.push_back(RecordedScope{ .scope                   = scopeIt->second,
+                                              .timestampQuery          = timestampQuery,
+                                              .pipelineStatisticsQuery = pipelineStatisticsQuery });
+    }
+
+    void EndScope(VkCommandBuffer commandBuffer)
+    {
+        auto & state = *m_State;
+        if (state.openScopes.empty())
+        {
+            throw std::runtime_error("Failed to end a GPU scope: no scope is open");
+        }
+
+        auto scopeIndex = state.openScopes.back();
+        state.openScopes.pop_back();
+        if (scopeIndex == noQuery)
+        {
+            return;
+        }
+
+        const auto & scope = state.frames[state.frameIndex].scopes[scopeIndex];
+        vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, state.timestampPool,
+                            scope.timestampQuery + 1);
+        if (scope.pipelineStatisticsQuery != noQuery)
+        {
+            vkCmdEndQuery(commandBuffer, state.pipelineStatisticsPool, scope.pipelineStatisticsQuery);
+            state.isPipelineStatisticsActive = false;
+        }
+    }
+
+    [[nodiscard]] std::vector<GpuScopeStatistics> GetStatistics() const
+    {
+        auto statistics = std::vector<GpuScopeStatistics>();
+        statistics.reserve(m_State->histories.size());
+        for (auto && history : m_State->histories)
+        {
+            if (history.samples.empty())
+            {
+                continue;
+            }
+
+            auto durations = std::vector<double>(history.samples.size());
+            std::ranges::transform(history.samples, durations.begin(),
+                                   [](const auto & sample)
+                                   {
+                                       return sample.milliseconds;
+                                   });
+            std::ranges::sort(durations);
+
+            auto total = 0.0;
+            for (auto duration : durations)
+            {
+                total += duration;
+            }
+
+            auto pipelineStatisticsTotals = std::array<std::uint64_t, pipelineStatisticCount>();
+            auto pipelineStatisticsCount  = std::uint64_t(0);
+            for (auto && sample : history.samples)
+            {
+                if (!sample.hasPipelineStatistics)
+                {
+                    continue;
+                }
+
+                for (auto index = 0u; index < pipelineStatisticCount; ++index)
+                {
+                    pipelineStatisticsTotals[index] += sample.pipelineStatistics[index];
+                }
+                ++pipelineStatisticsCount;
+            }
+            auto pipelineStatisticsAverage = [&](std::uint32_t index)
+            {
+                return pipelineStatisticsCount > 0 ? pipelineStatisticsTotals[index] / pipelineStatisticsCount : 0;
+            };
+
+            // Nearest-rank percentiles
+            auto count      = durations.size();
+            auto percentile = [&durations, count](double fraction)
+            {
+                auto rank = static_cast<std::size_t>(std::ceil(static_cast<double>(count) * fraction));
+                return durations[std::clamp<std::size_t>(rank, 1, count) - 1];
+            };
+
+            statistics.push_back(GpuScopeStatistics{ .name                      = history.name,
+                                                     .sampleCount               = static_cast<std::uint32_t>(count),
+                                                     .minMilliseconds           = durations.front(),
+                                                     .averageMilliseconds       = total / static_cast<double>(count),
+                                                     .p50Milliseconds           = percentile(0.50),
+                                                     .p95Milliseconds           = percentile(0.95),
+                                                     .p99Milliseconds           = percentile(0.99),
+                                                     .maxMilliseconds           = durations.back(),
+                                                     .inputAssemblyPrimitives   = pipelineStatisticsAverage(0),
+                                                     .vertexShaderInvocations   = pipelineStatisticsAverage(1),
+                                                     .fragmentShaderInvocations = pipelineStatisticsAverage(2),
+                                                     .computeShaderInvocations  = pipelineStatisticsAverage(3) });
+        }
+
+        return statistics;
+    }
+
+    [[nodiscard]] bool HasPipelineStatistics() const noexcept
+    {
+        return m_State->pipelineStatisticsPool != VK_NULL_HANDLE;
+    }
+
+private:
+    [[nodiscard]] static std::uint64_t GetTimestampMask(std::uint32_t timestampValidBits) noexcept
+    {
+        return timestampValidBits >= 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << timestampValidBits) - 1;
+    }
+
+    [[nodiscard]] std::uint32_t GetFirstTimestampQuery() const noexcept
+    {
+        return m_State->frameIndex * m_State->maxScopesPerFrame * 2;
+    }
+
+    [[nodiscard]] std::uint32_t GetFirstPipelineStatisticsQuery() const noexcept
+    {
+        return m_State->frameIndex * m_State->maxScopesPerFrame;
+    }
+
+    // Never waits, results that are somehow still unavailable are skipped instead of stalling the frame
+    void Collect(const Frame & frame)
+    {
+        auto & state = *m_State;
+        if (frame.scopes.empty())
+        {
+            return;
+        }
+
+        // Every query is followed by its availability
+        auto & timestamps     = state.timestampResults;
+        auto   timestampCount = static_cast<std::uint32_t>(frame.scopes.size()) * 2;
+        timestamps.resize(timestampCount * 2);
+        auto result = vkGetQueryPoolResults(state.device, state.timestampPool, GetFirstTimestampQuery(),
+                                            timestampCount, timestamps.size() * sizeof(std::uint64_t),
+                                            timestamps.data(), sizeof(std::uint64_t) * 2,
+                                            VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+        if (result != VK_SUCCESS && result != VK_NOT_READY)
+        {
+            throw std::runtime_error("Failed to get GPU timestamps");
+        }
+
+        constexpr auto pipelineStatisticsStride = pipelineStatisticCount + 1;
+
+        auto & statisticsResults = state.pipelineStatisticsResults;
+        if (frame.pipelineStatisticsCount > 0)
+        {
+            statisticsResults.resize(frame.pipelineStatisticsCount * pipelineStatisticsStride);
+            result = vkGetQueryPoolResults(state.device, state.pipelineStatisticsPool,
+                                           GetFirstPipelineStatisticsQuery(), frame.pipelineStatisticsCount,
+                                           statisticsResults.size() * sizeof(std::uint64_t), statisticsResults.data(),
+                                           sizeof(std::uint64_t) * pipelineStatisticsStride,
+                                           VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+            if (result != VK_SUCCESS && result != VK_NOT_READY)
+            {
+                throw std::runtime_error("Failed to get GPU pipeline statistics");
+            }
+        }
+
+        for (auto && scope : frame.scopes)
+        {
+            auto offset = (scope.timestampQuery - GetFirstTimestampQuery()) * 2;
+            if (timestamps[offset + 1] == 0 || timestamps[offset + 3] == 0)
+            {
+                continue;
+            }
+
+            auto ticks  = (timestamps[offset + 2] - timestamps[offset]) & state.timestampMask;
+            auto sample = Sample{ .milliseconds          = static_cast<double>(ticks) * state.timestampPeriod / 1e6,
+                                  .hasPipelineStatistics = false,
+                                  .pipelineStatistics    = {} };
+
+            if (scope.pipelineStatisticsQuery != noQuery)
+            {
+                auto first = (scope.pipelineStatisticsQuery - GetFirstPipelineStatisticsQuery())
+                           * pipelineStatisticsStride;
+                if (statisticsResults[first + pipelineStatisticCount] != 0)
+                {
+                    sample.hasPipelineStatistics = true;
+                    std::copy_n(statisticsResults.begin() + first, pipelineStatisticCount,
+                                sample.pipelineStatistics.begin());
+                }
+            }
+
+            AddSample(state.histories[scope.scope], sample);
+        }
+    }
+
+    void AddSample(ScopeHistory & history, const Sample & sample)
+    {
+        if (history.samples.size() < m_State->historySize)
+        {
+            history.samples.push_back(sample);
+            return;
+        }
+
+        history.samples[history.next] = sample;
+        history.next                  = (history.next + 1) % m_State->historySize;
+    }
+
+private:
+    std::unique_ptr<State> m_State;
+};
+} // namespace CuEngine::Vulkan::Impl
@@ -0,0 +1,355 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CuEngine/Vulkan/HostAllocator.hpp>
+
+#include "LoaderImpl.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <new>
+
+namespace CuEngine::Vulkan::Impl
+{
+// Process-wide, the same callbacks have to reach vkDestroy* as the vkCreate* of an object
+class HostAllocator
+{
+    static constexpr auto scopeCount     = std::size_t(VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE + 1);
+    static constexpr auto headerSize     = std::size_t(16);
+    static constexpr auto poolAlignment  = std::size_t(16);
+    static constexpr auto chunkSize      = std::size_t(64 * 1024);
+    static constexpr auto systemClass    = std::uint8_t(0xFF);
+    static constexpr auto blockSizes     = std::array<std::size_t, 4>{ 64, 128, 256, 512 };
+    static constexpr auto maxPooledBlock = blockSizes.back();
+
+    // Sits right in front of every allocation, pfnFree gets nothing but the pointer
+    struct Header
+    {
+        std::uint64_t size;
+        std::uint32_t offset;
+        std::uint8_t  sizeClass;
+        std::uint8_t  scope;
+        std::uint8_t  alignmentShift;
+        std::uint8_t  reserved;
+    };
+
+    static_assert(sizeof(Header) == headerSize);
+
+    struct ScopeCounters
+    {
+        std::atomic<std::uint64_t> currentBytes        = 0;
+        std::atomic<std::uint64_t> peakBytes           = 0;
+        std::atomic<std::uint64_t> allocationCount     = 0;
+        std::atomic<std::uint64_t> liveAllocationCount = 0;
+        std::atomic<std::int64_t>  internalBytes       = 0;
+    };
+
+    struct FreeBlock
+    {
+        FreeBlock * next;
+    };
+
+    struct Pool
+    {
+        std::mutex  mutex;
+        FreeBlock * freeList = nullptr;
+    };
+
+public:
+    [[nodiscard]] static const VkAllocationCallbacks * GetCallbacks() noexcept
+    {
+        static const auto callbacks = VkAllocationCallbacks{ .pUserData             = &GetInstance(),
+                                                             .pfnAllocation         = &Allocate,
+                                                             .pfnReallocation       = &Reallocate,
+                                                             .pfnFree               = &Free,
+                                                             .pfnInternalAllocation = &InternalAllocate,
+                                                             .pfnInternalFree       = &InternalFree };
+
+        return &callbacks;
+    }
+
+    [[nodiscard]] static Vulkan::HostAllocatorStatistics GetStatistics()
+    {
+        const auto & allocator = GetInstance();
+
+        auto statistics                  = Vulkan::HostAllocatorStatistics();
+        statistics.pooledAllocationCount = allocator.m_PooledAllocationCount.load(std::memory_order_relaxed);
+        statistics.systemAllocationCount = allocator.m_SystemAllocationCount.load(std::memory_order_relaxed);
+        statistics.poolReservedBytes     = allocator.m_PoolReservedBytes.load(std::memory_order_relaxed);
+        statistics.scopes.reserve(scopeCount);
+
+        for (auto scope = std::size_t(0); scope < scopeCount; ++scope)
+        {
+            const auto & counters = allocator.m_Scopes[scope];
+            const auto   internal = counters.internalBytes.load(std::memory_order_relaxed);
+
+            statistics.scopes.push_back(
+                { .scope               = static_cast<Vulkan::HostAllocationScope>(scope),
+                  .currentBytes        = counters.currentBytes.load(std::memory_order_relaxed),
+                  .peakBytes           = counters.peakBytes.load(std::memory_order_relaxed),
+                  .allocationCount     = counters.allocationCount.load(std::memory_order_relaxed),
+                  .liveAllocationCount = counters.liveAllocationCount.load(std::memory_order_relaxed),
+                  .internalBytes       = static_cast<std::uint64_t>(std::max<std::int64_t>(internal, 0)) });
+        }
+
+        return statistics;
+    }
+
+private:
+    HostAllocator() noexcept = default;
+
+    static HostAllocator & GetInstance() noexcept
+    {
+        // Never destroyed, a driver is free to release memory from its own static destructors
+        static auto & allocator = *new HostAllocator();
+
+        return allocator;
+    }
+
+    static VKAPI_ATTR void * VKAPI_CALL Allocate(void *                  userData,
+                                                 std::size_t             size,
+                                                 std::size_t             alignment,
+                                                 VkSystemAllocationScope scope)
+    {
+        return static_cast<HostAllocator *>(userData)->AllocateMemory(size, alignment, scope);
+    }
+
+    static VKAPI_ATTR void * VKAPI_CALL Reallocate(void *                  userData,
+                                                   void *                  original,
+                                                   std::size_t             size,
+                                                   std::size_t             alignment,
+                                                   VkSystemAllocationScope scope)
+    {
+        auto * allocator = static_cast<HostAllocator *>(userData);
+
+        if (original == nullptr)
+        {
+            return allocator->AllocateMemory(size, alignment, scope);
+        }
+
+        if (size == 0)
+        {
+            allocator->FreeMemory(original);
+
+            return nullptr;
+        }
+
+        auto * memory = allocator->AllocateMemory(size, alignment, scope);
+
+        // The original stays valid when the reallocation fails
+        if (memory == nullptr)
+        {
+            return nullptr;
+        }
+
+        std::memcpy(memory, original, std::min<std::size_t>(size, GetHeader(original).size));
+        allocator->FreeMemory(original);
+
+        return memory;
+    }
+
+    static VKAPI_ATTR void VKAPI_CALL Free(void * userData, void * memory)
+    {
+        if (memory != nullptr)
+        {
+            static_cast<HostAllocator *>(userData)->FreeMemory(memory);
+        }
+    }
+
+    static VKAPI_ATTR void VKAPI_CALL InternalAllocate(void *                   userData,
+                                                       std::size_t              size,
+                                                       VkInternalAllocationType type,
+                                                       VkSystemAllocationScope  scope)
+    {
+        static_cast<void>(type);
+
+        auto & counters = static_cast<HostAllocator *>(userData)->m_Scopes[scope];
+        counters.internalBytes.fetch_add(static_cast<std::int64_t>(size), std::memory_order_relaxed);
+    }
+
+    static VKAPI_ATTR void VKAPI_CALL InternalFree(void *                   userData,
+                                                   std::size_t              size,
+                                                   VkInternalAllocationType type,
+                                                   VkSystemAllocationScope  scope)
+    {
+        static_cast<void>(type);
+
+        auto & counters = static_cast<HostAllocator *>(userData)->m_Scopes[scope];
+        counters.internalBytes.fetch_sub(static_cast<std::int64_t>(size), std::memory_order_relaxed);
+    }
+
+    static Header & GetHeader(void * memory) noexcept
+    {
+        return *reinterpret_cast<Header *>(static_cast<std::byte *>(memory) - headerSize);
+    }
+
+    void * AllocateMemory(std::size_t size, std::size_t alignment, VkSystemAllocationScope scope) noexcept
+    {
+        if (size == 0)
+        {
+            return nullptr;
+        }
+
+        alignment = std::max(alignment, poolAlignment);
+
+        auto * memory = alignment == poolAlignment && size + headerSize <= maxPooledBlock
+                            ? AllocatePooled(size)
+                            : AllocateSystem(size, alignment);
+
+        if (memory == nullptr)
+        {
+            return nullptr;
+        }
+
+        auto & header = GetHeader(memory);
+        header.size   = size;
+        header.scope  = static_cast<std::uint8_t>(scope);
+
+        auto &     counters = m_Scopes[scope];
+        const auto current  = counters.currentBytes.fetch_add(size, std::memory_order_relaxed) + size;
+        auto       peak     = counters.peakBytes.load(std::memory_order_relaxed);
+
+        while (peak < current && !counters.peakBytes.compare_exchange_weak(peak, current, std::memory_order_relaxed))
+        {}
+
+        counters.allocationCount.fetch_add(1, std::memory_order_relaxed);
+        counters.liveAllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+        return memory;
+    }
+
+    void FreeMemory(void * memory) noexcept
+    {
+        const auto header = GetHeader(memory);
+
+        auto & counters = m_Scopes[header.scope];
+        counters.currentBytes.fetch_sub(header.size, std::memory_order_relaxed);
+        counters.liveAllocationCount.fetch_sub(1, std::memory_order_relaxed);
+
+        auto * block = static_cast<std::byte *>(memory) - header.offset;
+
+        if (header.sizeClass == systemClass)
+        {
+            ::operator delete(block, std::align_val_t(std::size_t(1) << header.alignmentShift));
+
+            return;
+        }
+
+        auto & pool = m_Pools[header.sizeClass];
+
+        auto lock = std::scoped_lock(pool.mutex);
+
+        auto * freeBlock = reinterpret_cast<FreeBlock *>(block);
+        freeBlock->next  = pool.freeList;
+        pool.freeList    = freeBlock;
+    }
+
+    void * AllocatePooled(std::size_t size) noexcept
+    {
+        const auto sizeClass = static_cast<std::size_t>(
+            std::ranges::lower_bound(blockSizes, size + headerSize) - blockSizes.begin());
+
+        auto & pool  = m_Pools[sizeClass];
+        auto * block = static_cast<std::byte *>(nullptr);
+
+        {
+            auto lock = std::scoped_lock(pool.mutex);
+
+            if (pool.freeList == nullptr && !ReserveChunk(pool, blockSizes[sizeClass]))
+            {
+                return nullptr;
+            }
+
+            block         = reinterpret_cast<std::byte *>(pool.freeList);
+            pool.freeList = pool.freeList->next;
+        }
+
+        m_PooledAllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+        auto & header         = *reinterpret_cast<Header *>(block);
+        header.offset         = headerSize;
+        header.sizeClass      = static_cast<std::uint8_t>(sizeClass);
+        header.alignmentShift = 0;
+
+        return block + headerSize;
+    }
+
+    // Chunks are handed out block by block and never returned, the pools only ever hold what the peak needed
+    bool ReserveChunk(Pool & pool, std::size_t blockSize) noexcept
+    {
+        auto * chunk =
+            static_cast<std::byte *>(::operator new(chunkSize, std::align_val_t(poolAlignment), std::nothrow));
+
+        if (chunk == nullptr)
+        {
+            return false;
+        }
+
+        for (auto offset = chunkSize; offset >= blockSize; offset -= blockSize)
+        {
+            auto * freeBlock = reinterpret_cast<FreeBlock *>(chunk + offset - blockSize);
+            freeBlock->next  = pool.freeList;
+            pool.freeList    = freeBlock;
+        }
+
+        m_PoolReservedBytes.fetch_add(chunkSize, std::memory_order_relaxed);
+
+        return true;
+    }
+
+    // The header takes the first alignment step, so the memory right after it stays aligned
+    void * AllocateSystem(std::size_t size, std::size_t alignment) noexcept
+    {
+        auto * block =
+            static_cast<std::byte *>(::operator new(size + alignment, std::align_val_t(alignment), std::nothrow));
+
+        if (block == nullptr)
+        {
+            return nullptr;
+        }
+
+        m_SystemAllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+        auto * memory         = block + alignment;
+        auto & header         = GetHeader(memory);
+        header.offset         = static_cast<std::uint32_t>(alignment);
+        header.sizeClass      = systemClass;
+        header.alignmentShift = static_cast<std::uint8_t>(std::countr_zero(alignment));
+
+        return memory;
+    }
+
+    std::array<ScopeCounters, scopeCount> m_Scopes;
+    std::array<Pool, blockSizes.size()>   m_Pools;
+    std::atomic<std::uint64_t>            m_PooledAllocationCount = 0;
+    std::atomic<std::uint64_t>            m_SystemAllocationCount = 0;
+    std::atomic<std::uint64_t>            m_PoolReservedBytes     = 0;
+};
+} // namespace CuEngine::Vulkan::Impl
@@ -0,0 +1,183 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include "DeviceImpl.hpp"
+#include "ImageImpl.hpp"
+#include "HostAllocatorImpl.hpp"
+#include "LoaderImpl.hpp"
+#include "MemoryAllocatorImpl.hpp"
+
+#include <CuEngine/Vulkan/ImageBuilder.hpp>
+
+#include <stdexcept>
+
+namespace CuEngine::Vulkan::Impl
+{
+class ImageBuilder
+{
+public:
+    explicit ImageBuilder() noexcept
+        : m_Device(VK_NULL_HANDLE), m_MemoryAllocator(nullptr), m_Format(VK_FORMAT_UNDEFINED), m_Extent(),
+          m_Usage(0)
+    {}
+
+    ImageBuilder(const ImageBuilder & other) = default;
+
+    ImageBuilder(ImageBuilder && other) noexcept = default;
+
+    ImageBuilder & operator=(const ImageBuilder & other) = default;
+
+    ImageBuilder & operator=(ImageBuilder && other) noexcept = default;
+
+    ~ImageBuilder() noexcept = default;
+
+    ImageBuilder & SetDevice(Device & device) noexcept
+    {
+        m_Device          = device.GetHandle();
+        m_MemoryAllocator = &device.GetMemoryAllocator().GetImpl();
+
+        return *this;
+    }
+
+    ImageBuilder & SetFormat(Format format) noexcept
+    {
+        m_Format = static_cast<VkFormat>(format);
+
+        return *this;
+    }
+
+    ImageBuilder & SetExtent(VkExtent2D extent) noexcept
+    {
+        m_Extent = extent;
+
+        return *this;
+    }
+
+    ImageBuilder & SetUsage(ImageUsage usage) noexcept
+    {
+        m_Usage = static_cast<VkImageUsageFlags>(usage);
+
+        return *this;
+    }
+
+    [[nodiscard]] Image Build() const
+    {
+        if (m_MemoryAllocator == nullptr || m_Format == VK_FORMAT_UNDEFINED || m_Extent.width == 0
+            || m_Extent.height == 0)
+        {
+            throw std::runtime_error("Failed to create an image: device, format and extent have to be set");
+        }
+
+        auto image      = CreateHandle(m_Device, m_Format, m_Extent, m_Usage);
+        auto allocation = MemoryAllocation();
+        try
+        {
+            allocation = m_MemoryAllocator->AllocateForImage(image, MemoryUsage::GpuOnly,
+                                                             MemoryAllocator::ResourceKind::Optimal);
+        }
+        catch (...)
+        {
+            vkDestroyImage(m_Device, image, HostAllocator::GetCallbacks());
+            throw;
+        }
+
+        auto aspect = Image::GetAspect(m_Format);
+        try
+        {
+            auto view = CreateView(m_Device, image, m_Format, aspect);
+
+            return Image(m_Device, image, view, allocation, m_Format, m_Extent, aspect);
+        }
+        catch (...)
+        {
+            vkDestroyImage(m_Device, image, HostAllocator::GetCallbacks());
+            MemoryAllocator::Free(allocation);
+            throw;
+        }
+    }
+
+    // Creates the image without memory, the caller binds it before creating the view
+    [[nodiscard]] static VkImage CreateHandle(VkDevice device, VkFormat format, VkExtent2D extent,
+                                              VkImageUsageFlags usage)
+    {
+        auto imageInfo = VkImageCreateInfo{ .sType                 = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+                                            .pNext                 = nullptr,
+                                            .flags                 = 0,
+                                            .imageType             = VK_IMAGE_TYPE_2D,
+                                            .format                = format,
+                                            .extent                = { extent.width, extent.height, 1 },
+                                            .mipLevels             = 1,
+                                            .arrayLayers           = 1,
+                                            .samples               = VK_SAMPLE_COUNT_1_BIT,
+                                            .tiling                = VK_IMAGE_TILING_OPTIMAL,
+                                            .usage                 = usage,
+                                            .sharingMode           = VK_SHARING_MODE_EXCLUSIVE,
+                                            .queueFamilyIndexCount = 0,
+                                            .pQueueFamilyIndices   = nullptr,
+                                            .initialLayout         = VK_IMAGE_LAYOUT_UNDEFINED };
+
+        auto image = VkImage(VK_NULL_HANDLE);
+        if (vkCreateImage(device, &imageInfo, HostAllocator::GetCallbacks(), &image) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create an image");
+        }
+
+        return image;
+    }
+
+    [[nodiscard]] static VkImageView CreateView(VkDevice device, VkImage image, VkFormat format,
+                                                VkImageAspectFlags aspect)
+    {
+        // Sampling a depth stencil image reads depth, so the view never includes stencil
+        auto viewAspect = (aspect & VK_IMAGE_ASPECT_DEPTH_BIT) ? VK_IMAGE_ASPECT_DEPTH_BIT : aspect;
+        auto viewInfo   = VkImageViewCreateInfo{ .sType            = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+                                                 .pNext            = nullptr,
+                                                 .flags            = 0,
+                                                 .image            = image,
+                                                 .viewType         = VK_IMAGE_VIEW_TYPE_2D,
+                                                 .format           = format,
+                                                 .components       = { VK_COMPONENT_SWIZZLE_IDENTITY,
+                                                                       VK_COMPONENT_SWIZZLE_IDENTITY,
+                                                                       VK_COMPONENT_SWIZZLE_IDENTITY,
+                                                                       VK_COMPONENT_SWIZZLE_IDENTITY },
+                                                 .subresourceRange = { viewAspect, 0, 1, 0, 1 } };
+
+        auto view = VkImageView(VK_NULL_HANDLE);
+        if (vkCreateImageView(device, &viewInfo, HostAllocator::GetCallbacks(), &view) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create an image view");
+        }
+
+        return view;
+    }
+
+private:
+    VkDevice          m_Device;
+    MemoryAllocator * m_MemoryAllocator;
+    VkFormat          m_Format;
+    VkExtent2D        m_Extent;
+    VkImageUsageFlags m_Usage;
+};
+} // namespace CuEngine::Vulkan::Impl
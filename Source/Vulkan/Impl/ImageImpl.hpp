@@ -0,0 +1,133 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include "HostAllocatorImpl.hpp"
+#include "LoaderImpl.hpp"
+#include "MemoryAllocatorImpl.hpp"
+
+#include <CuEngine/Vulkan/Image.hpp>
+
+#include <utility>
+
+namespace CuEngine::Vulkan::Impl
+{
+class Image
+{
+public:
+    // An empty allocation means the memory belongs to someone else, e.g. a render graph aliasing it
+    explicit Image(VkDevice device, VkImage image, VkImageView view, const MemoryAllocation & allocation,
+                   VkFormat format, VkExtent2D extent, VkImageAspectFlags aspect) noexcept
+        : m_Device(device), m_Handle(image), m_View(view), m_Allocation(allocation), m_Format(format),
+          m_Extent(extent), m_Aspect(aspect)
+    {}
+
+    Image(const Image & other) = delete;
+
+    Image(Image && other) noexcept
+        : m_Device(std::exchange(other.m_Device, VK_NULL_HANDLE)),
+          m_Handle(std::exchange(other.m_Handle, VK_NULL_HANDLE)),
+          m_View(std::exchange(other.m_View, VK_NULL_HANDLE)),
+          m_Allocation(std::exchange(other.m_Allocation, MemoryAllocation())),
+          m_Format(std::exchange(other.m_Format, VK_FORMAT_UNDEFINED)),
+          m_Extent(std::exchange(other.m_Extent, VkExtent2D())),
+          m_Aspect(std::exchange(other.m_Aspect, 0))
+    {}
+
+    Image & operator=(const Image & other) = delete;
+
+    Image & operator=(Image && other) noexcept
+    {
+        if (this != &other)
+        {
+            std::swap(m_Device, other.m_Device);
+            std::swap(m_Handle, other.m_Handle);
+            std::swap(m_View, other.m_View);
+            std::swap(m_Allocation, other.m_Allocation);
+            std::swap(m_Format, other.m_Format);
+            std::swap(m_Extent, other.m_Extent);
+            std::swap(m_Aspect, other.m_Aspect);
+        }
+
+        return *this;
+    }
+
+    ~Image() noexcept
+    {
+        if (m_Handle)
+        {
+            vkDestroyImageView(m_Device, m_View, HostAllocator::GetCallbacks());
+            vkDestroyImage(m_Device, m_Handle, HostAllocator::GetCallbacks());
+            MemoryAllocator::Free(m_Allocation);
+        }
+    }
+
+    [[nodiscard]] VkImage GetHandle() const noexcept
+    {
+        return m_Handle;
+    }
+
+    [[nodiscard]] VkImageView GetView() const noexcept
+    {
+        return m_View;
+    }
+
+    [[nodiscard]] VkFormat GetFormat() const noexcept
+    {
+        return m_Format;
+    }
+
+    [[nodiscard]] VkExtent2D GetExtent() const noexcept
+    {
+        return m_Extent;
+    }
+
+    [[nodiscard]] VkImageAspectFlags GetAspect() const noexcept
+    {
+        return m_Aspect;
+    }
+
+    [[nodiscard]] static VkImageAspectFlags GetAspect(VkFormat format) noexcept
+    {
+        switch (format)
+        {
+            case VK_FORMAT_D32_SFLOAT:
+                return VK_IMAGE_ASPECT_DEPTH_BIT;
+            case VK_FORMAT_D24_UNORM_S8_UINT:
+                return VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
+            default:
+                return VK_IMAGE_ASPECT_COLOR_BIT;
+        }
+    }
+
+private:
+    VkDevice           m_Device;
+    VkImage            m_Handle;
+    VkImageView        m_View;
+    MemoryAllocation   m_Allocation;
+    VkFormat           m_Format;
+    VkExtent2D         m_Extent;
+    VkImageAspectFlags m_Aspect;
+};
+} // namespace CuEngine::Vulkan::Impl
@@ -23,15 +23,21 @@
 #pragma once
 
 #include "InstanceImpl.hpp"
+#include "HostAllocatorImpl.hpp"
+#include "LoaderImpl.hpp"
 
 #include <CuEngine/Vulkan/InstanceBuilder.hpp>
 
+#include <string>
+#include <unordered_set>
+
 namespace CuEngine::Vulkan::Impl
 {
 class InstanceBuilder
 {
 public:
-    explicit InstanceBuilder() = default;
+    explicit InstanceBuilder() noexcept : m_IsHeadless(false)
+    {}
 
     InstanceBuilder(const InstanceBuilder &) = default;
 
@@ -43,16 +49,35 @@ public:
 
     ~InstanceBuilder() noexcept = default;
 
+    InstanceBuilder & SetHeadless(bool isHeadless) noexcept
+    {
+        m_IsHeadless = isHeadless;
+
+        return *this;
+    }
+
     [[nodiscard]] Instance Build() const
     {
-        auto enabledExtensionsCount = std::uint32_t();
-        auto enabledExtensions      = glfwGetRequiredInstanceExtensions(&enabledExtensionsCount);
+        Loader::Initialize();
+
+        // Headless instances need no surface extensions, which also keeps GLFW uninitialized
+        auto enabledExtensions = std::vector<const char *>();
+        if (!m_IsHeadless)
+        {
+            auto windowExtensionsCount = std::uint32_t();
+            auto windowExtensions      = glfwGetRequiredInstanceExtensions(&windowExtensionsCount);
+            if (windowExtensions == nullptr)
+            {
+                throw std::runtime_error("Failed to get the window system's instance extensions");
+            }
+            enabledExtensions.assign(windowExtensions, windowExtensions + windowExtensionsCount);
+        }
 
         std::ranges::for_each(
-            enabledExtensions, enabledExtensions + enabledExtensionsCount,
+            enabledExtensions,
             [supportedExtensions = GetSupportedExtensions()](const auto & extension)
             {
-                if (std::ranges::end(supportedExtensions) == std::ranges::find(supportedExtensions, extension))
+                if (!supportedExtensions.contains(extension))
                 {
                     throw std::runtime_error(std::string("Extension ") + extension + " not supported");
                 }
@@ -64,7 +89,7 @@ public:
         std::ranges::for_each(enabledLayers,
                               [supportedLayers = GetSupportedLayers()](const auto & layer)
                               {
-                                  if (std::ranges::end(supportedLayers) == std::ranges::find(supportedLayers, layer))
+                                  if (!supportedLayers.contains(layer))
                                   {
                                       throw std::runtime_error(std::string("Layer ") + layer + " not supported");
                                   }
@@ -75,8 +100,9 @@ public:
                                           .pNext              = nullptr,
                                           .pApplicationName   = "CuEngine",
                                           .applicationVersion = VK_MAKE_VERSION(0, 0, 1),
+                                          .pEngineName        = "CuEngine",
                                           .engineVersion      = VK_MAKE_VERSION(0, 0, 1),
-                                          .apiVersion         = VK_API_VERSION_1_0 };
+                                          .apiVersion         = VK_API_VERSION_1_3 };
 
         auto instanceInfo = VkInstanceCreateInfo{ .sType                 = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO,
                                                   .pNext                 = nullptr,
@@ -84,20 +110,22 @@ public:
                                                   .pApplicationInfo      = &appInfo,
                                                   .enabledLayerCount     = static_cast<uint32_t>(enabledLayers.size()),
                                                   .ppEnabledLayerNames   = enabledLayers.data(),
-                                                  .enabledExtensionCount = enabledExtensionsCount,
-                                                  .ppEnabledExtensionNames = enabledExtensions };
+                                                  .enabledExtensionCount =
+                                                      static_cast<uint32_t>(enabledExtensions.size()),
+                                                  .ppEnabledExtensionNames = enabledExtensions.data() };
 
         auto instance = VkInstance(VK_NULL_HANDLE);
-        if (vkCreateInstance(&instanceInfo, nullptr, &instance) != VK_SUCCESS)
+        if (vkCreateInstance(&instanceInfo, HostAllocator::GetCallbacks(), &instance) != VK_SUCCESS)
         {
             throw std::runtime_error("Failed to create Vulkan instance");
         }
+        Loader::LoadInstance(instance);
 
         return Instance(instance);
     }
 
 private:
-    static std::vector<std::string> GetSupportedExtensions()
+    static std::unordered_set<std::string> GetSupportedExtensions()
     {
         auto count = std::uint32_t();
         if (vkEnumerateInstanceExtensionProperties(nullptr, &count, nullptr) != VK_SUCCESS)
@@ -111,17 +139,16 @@ private:
             throw std::runtime_error("Failed to get supported Vulkan extensions");
         }
 
-        auto extensions = std::vector<std::string>(count);
-        std::ranges::transform(properties, extensions.begin(),
-                               [](const auto & property)
-                               {
-                                   return std::string(property.extensionName);
-                               });
+        auto extensions = std::unordered_set<std::string>(count);
+        for (auto && property : properties)
+        {
+            extensions.emplace(property.extensionName);
+        }
 
         return extensions;
     }
 
-    static std::vector<std::string> GetSupportedLayers()
+    static std::unordered_set<std::string> GetSupportedLayers()
     {
         auto count = std::uint32_t();
         if (vkEnumerateInstanceLayerProperties(&count, nullptr) != VK_SUCCESS)
@@ -135,14 +162,16 @@ private:
             throw std::runtime_error("Failed to get supported Vulkan layers");
         }
 
-        auto layers = std::vector<std::string>(count);
-        std::ranges::transform(properties, layers.begin(),
-                               [](const auto & property)
-                               {
-                                   return std::string(property.layerName);
-                               });
+        auto layers = std::unordered_set<std::string>(count);
+        for (auto && property : properties)
+        {
+            layers.emplace(property.layerName);
+        }
 
         return layers;
     }
+
+private:
+    bool m_IsHeadless;
 };
 } // namespace CuEngine::Vulkan::Impl
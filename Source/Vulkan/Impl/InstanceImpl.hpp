@@ -25,6 +25,8 @@
 #include <GLFW/glfw3.h>
 
 #include "../../Platform/Impl/WindowImpl.hpp"
+#include "HostAllocatorImpl.hpp"
+#include "LoaderImpl.hpp"
 
 #include <CuEngine/Vulkan/Instance.hpp>
 
@@ -62,7 +64,7 @@ public:
     {
         if (m_Handle)
         {
-            vkDestroyInstance(m_Handle, nullptr);
+            vkDestroyInstance(m_Handle, HostAllocator::GetCallbacks());
         }
     }
 
@@ -0,0 +1,134 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#if !defined(VK_NO_PROTOTYPES)
+#error "Vulkan functions are dispatched through the loader below, compile with VK_NO_PROTOTYPES"
+#endif
+
+// Resolved with vkGetInstanceProcAddr(nullptr) as soon as the library is opened
+#define CU_VULKAN_GLOBAL_FUNCTIONS(X)                                                                                  \
+    X(vkCreateInstance)                                                                                                \
+    X(vkEnumerateInstanceExtensionProperties)                                                                          \
+    X(vkEnumerateInstanceLayerProperties)
+
+#define CU_VULKAN_INSTANCE_FUNCTIONS(X)                                                                                \
+    X(vkDestroyInstance)                                                                                               \
+    X(vkEnumeratePhysicalDevices)                                                                                      \
+    X(vkEnumerateDeviceExtensionProperties)                                                                            \
+    X(vkGetPhysicalDeviceFeatures)                                                                                     \
+    X(vkGetPhysicalDeviceFeatures2)                                                                                    \
+    X(vkGetPhysicalDeviceProperties)                                                                                   \
+    X(vkGetPhysicalDeviceProperties2)                                                                                  \
+    X(vkGetPhysicalDeviceMemoryProperties)                                                                             \
+    X(vkGetPhysicalDeviceQueueFamilyProperties)                                                                        \
+    X(vkGetPhysicalDeviceSurfaceSupportKHR)                                                                            \
+    X(vkGetPhysicalDeviceSurfaceCapabilitiesKHR)                                                                       \
+    X(vkGetPhysicalDeviceSurfaceFormatsKHR)                                                                            \
+    X(vkGetPhysicalDeviceSurfacePresentModesKHR)                                                                       \
+    X(vkDestroySurfaceKHR)                                                                                             \
+    X(vkCreateDevice)                                                                                                  \
+    X(vkGetDeviceProcAddr)
+
+// Resolved with vkGetDeviceProcAddr, so they call straight into the driver instead of a loader trampoline
+#define CU_VULKAN_DEVICE_FUNCTIONS(X)                                                                                  \
+    X(vkDestroyDevice)                                                                                                 \
+    X(vkDeviceWaitIdle)                                                                                                \
+    X(vkGetDeviceQueue)                                                                                                \
+    X(vkQueueSubmit)                                                                                                   \
+    X(vkQueuePresentKHR)                                                                                               \
+    X(vkCreateSwapchainKHR)                                                                                            \
+    X(vkDestroySwapchainKHR)                                                                                           \
+    X(vkGetSwapchainImagesKHR)                                                                                         \
+    X(vkAcquireNextImageKHR)                                                                                           \
+    X(vkAllocateMemory)                                                                                                \
+    X(vkFreeMemory)                                                                                                    \
+    X(vkMapMemory)                                                                                                     \
+    X(vkCreateBuffer)                                                                                                  \
+    X(vkDestroyBuffer)                                                                                                 \
+    X(vkGetBufferMemoryRequirements)                                                                                   \
+    X(vkBindBufferMemory)                                                                                              \
+    X(vkCreateImage)                                                                                                   \
+    X(vkDestroyImage)                                                                                                  \
+    X(vkGetImageMemoryRequirements)                                                                                    \
+    X(vkBindImageMemory)                                                                                               \
+    X(vkCreateImageView)                                                                                               \
+    X(vkDestroyImageView)                                                                                              \
+    X(vkCreateFence)                                                                                                   \
+    X(vkDestroyFence)                                                                                                  \
+    X(vkResetFences)                                                                                                   \
+    X(vkWaitForFences)                                                                                                 \
+    X(vkCreateSemaphore)                                                                                               \
+    X(vkDestroySemaphore)                                                                                              \
+    X(vkGetSemaphoreCounterValue)                                                                                      \
+    X(vkSignalSemaphore)                                                                                               \
+    X(vkWaitSemaphores)                                                                                                \
+    X(vkCreatePipelineCache)                                                                                           \
+    X(vkDestroyPipelineCache)                                                                                          \
+    X(vkGetPipelineCacheData)                                                                                          \
+    X(vkMergePipelineCaches)                                                                                           \
+    X(vkCreateQueryPool)                                                                                               \
+    X(vkDestroyQueryPool)                                                                                              \
+    X(vkGetQueryPoolResults)                                                                                           \
+    X(vkCreateCommandPool)                                                                                             \
+    X(vkDestroyCommandPool)                                                                                            \
+    X(vkResetCommandPool)                                                                                              \
+    X(vkAllocateCommandBuffers)                                                                                        \
+    X(vkBeginCommandBuffer)                                                                                            \
+    X(vkEndCommandBuffer)                                                                                              \
+    X(vkCmdPipelineBarrier)                                                                                            \
+    X(vkCmdPipelineBarrier2)                                                                                           \
+    X(vkCmdClearColorImage)                                                                                            \
+    X(vkCmdCopyBuffer)                                                                                                 \
+    X(vkCmdExecuteCommands)                                                                                            \
+    X(vkCmdResetQueryPool)                                                                                             \
+    X(vkCmdBeginQuery)                                                                                                 \
+    X(vkCmdEndQuery)                                                                                                   \
+    X(vkCmdWriteTimestamp)
+
+#define CU_VULKAN_DECLARE_FUNCTION(name) extern PFN_##name name;
+
+extern PFN_vkGetInstanceProcAddr vkGetInstanceProcAddr;
+CU_VULKAN_GLOBAL_FUNCTIONS(CU_VULKAN_DECLARE_FUNCTION)
+CU_VULKAN_INSTANCE_FUNCTIONS(CU_VULKAN_DECLARE_FUNCTION)
+CU_VULKAN_DEVICE_FUNCTIONS(CU_VULKAN_DECLARE_FUNCTION)
+
+#undef CU_VULKAN_DECLARE_FUNCTION
+
+namespace CuEngine::Vulkan::Impl
+{
+// Functions a device does not support, e.g. vkCmdPipelineBarrier2 below 1.3, stay null
+class Loader
+{
+public:
+    // Opens the Vulkan library on first use, so executables that never create an instance never load it
+    static void Initialize();
+
+    static void LoadInstance(VkInstance instance);
+
+    // The device functions are global, so they are bound to the last loaded device, the engine only creates one
+    static void LoadDevice(VkDevice device);
+};
+} // namespace CuEngine::Vulkan::Impl
@@ -0,0 +1,585 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include "HostAllocatorImpl.hpp"
+#include "LoaderImpl.hpp"
+#include "MemoryBlockImpl.hpp"
+#include "PhysicalDeviceInfoImpl.hpp"
+
+#include <CuEngine/Vulkan/MemoryAllocator.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace CuEngine::Vulkan::Impl
+{
+class MemoryPool;
+
+struct MemoryAllocation
+{
+    VkDeviceMemory      memory;
+    VkDeviceSize        offset;
+    VkDeviceSize        size;
+    void *              mapped;
+    MemoryPool *        pool;
+    MemoryBlock *       block;
+    MemoryBlock::Node * node;
+    std::uint32_t       memoryType;
+    std::uint32_t       sizeClass;
+};
+
+struct MemoryHeapCounters
+{
+    std::atomic<std::uint64_t> blockBytes;
+    std::atomic<std::uint64_t> usedBytes;
+    std::atomic<std::uint32_t> blockCount;
+    std::atomic<std::uint32_t> allocationCount;
+    std::atomic<std::uint32_t> dedicatedAllocationCount;
+};
+
+// All blocks of one memory type and resource kind, small sizes are served from per-thread caches first
+class MemoryPool
+{
+public:
+    static constexpr auto noSizeClass          = ~0u;
+    static constexpr auto smallestSizeBits     = 8u;
+    static constexpr auto sizeClassCount       = 9u;
+    static constexpr auto threadCacheSlotCount = 32u;
+    static constexpr auto threadCacheCapacity  = 32u;
+    static constexpr auto refillCount          = 8u;
+
+private:
+    struct ThreadCache
+    {
+        std::mutex                                                   mutex;
+        std::array<std::vector<MemoryAllocation>, sizeClassCount> freeLists;
+    };
+
+public:
+    explicit MemoryPool(VkDevice device, std::uint32_t memoryType, bool isMapped, VkDeviceSize blockSize,
+                        MemoryHeapCounters & counters, std::atomic<std::uint32_t> & deviceAllocationCount,
+                        std::uint32_t maxDeviceAllocationCount)
+        : m_Device(device), m_MemoryType(memoryType), m_IsMapped(isMapped), m_BlockSize(blockSize),
+          m_Counters(counters), m_DeviceAllocationCount(deviceAllocationCount),
+          m_MaxDeviceAllocationCount(maxDeviceAllocationCount), m_Mutex(), m_Blocks(), m_ThreadCaches()
+    {}
+
+    MemoryPool(const MemoryPool & other) = delete;
+
+    MemoryPool(MemoryPool && other) noexcept = delete;
+
+    MemoryPool & operator=(const MemoryPool & other) = delete;
+
+    MemoryPool & operator=(MemoryPool && other) noexcept = delete;
+
+    ~MemoryPool() noexcept
+    {
+        Release();
+    }
+
+    [[nodiscard]] MemoryAllocation Allocate(VkDeviceSize size, VkDeviceSize alignment)
+    {
+        auto sizeClass = GetSizeClass(size);
+        if (sizeClass == noSizeClass)
+        {
+            auto lock       = std::scoped_lock(m_Mutex);
+            auto allocation = AllocateLocked(size, alignment, noSizeClass);
+            CountAllocation(allocation);
+
+            return allocation;
+        }
+
+        auto   classSize = VkDeviceSize(1) << (smallestSizeBits + sizeClass);
+        auto & cache     = m_ThreadCaches[GetThreadSlot()];
+        {
+            auto   cacheLock = std::scoped_lock(cache.mutex);
+            auto & freeList  = cache.freeLists[sizeClass];
+            auto   cachedIt  = std::ranges::find_if(freeList,
+                                                    [alignment](const auto & cached)
+                                                    {
+                                                     return cached.offset % alignment == 0;
+                                                    });
+            if (cachedIt != std::ranges::end(freeList))
+            {
+                auto allocation = *cachedIt;
+                *cachedIt       = freeList.back();
+                freeList.pop_back();
+                CountAllocation(allocation);
+
+                return allocation;
+            }
+        }
+
+        // A miss takes the pool lock once for a whole batch, the surplus stays in this thread's cache
+        auto lock       = std::scoped_lock(m_Mutex);
+        auto allocation = AllocateLocked(classSize, alignment, sizeClass);
+        {
+            auto   cacheLock = std::scoped_lock(cache.mutex);
+            auto & freeList  = cache.freeLists[sizeClass];
+            freeList.reserve(threadCacheCapacity);
+            for (auto index = 1u; index < refillCount && freeList.size() < threadCacheCapacity / 2; ++index)
+            {
+                auto spare = TryAllocateFromBlocks(classSize, alignment, sizeClass);
+                if (!spare)
+                {
+                    break;
+                }
+                freeList.push_back(*spare);
+            }
+        }
+        CountAllocation(allocation);
+
+        return allocation;
+    }
+
+    [[nodiscard]] MemoryAllocation AllocateDedicated(VkDeviceSize size)
+    {
+        auto [memory, mapped] = AllocateDeviceMemory(size);
+        auto allocation       = MemoryAllocation{ .memory     = memory,
+                                                  .offset     = 0,
+                                                  .size       = size,
+                                                  .mapped     = mapped,
+                                                  .pool       = this,
+                                                  .block      = nullptr,
+                                                  .node       = nullptr,
+                                                  .memoryType = m_MemoryType,
+                                                  .sizeClass  = noSizeClass };
+
+        m_Counters.dedicatedAllocationCount.fetch_add(1, std::memory_order_relaxed);
+        CountAllocation(allocation);
+
+        return allocation;
+    }
+
+    void Free(const MemoryAllocation & allocation) noexcept
+    {
+        m_Counters.usedBytes.fetch_sub(allocation.size, std::memory_order_relaxed);
+        m_Counters.allocationCount.fetch_sub(1, std::memory_order_relaxed);
+
+        if (allocation.block == nullptr)
+        {
+            m_Counters.dedicatedAllocationCount.fetch_sub(1, std::memory_order_relaxed);
+            FreeDeviceMemory(allocation.memory, allocation.size);
+            return;
+        }
+
+        if (allocation.sizeClass != noSizeClass)
+        {
+            auto & cache     = m_ThreadCaches[GetThreadSlot()];
+            auto   cacheLock = std::scoped_lock(cache.mutex);
+            auto & freeList  = cache.freeLists[allocation.sizeClass];
+
+            // Capacity is only ever reserved on the allocation path, so this never allocates
+            if (freeList.size() < freeList.capacity())
+            {
+                freeList.push_back(allocation);
+                return;
+            }
+        }
+
+        auto lock = std::scoped_lock(m_Mutex);
+        FreeLocked(allocation);
+    }
+
+    void Release() noexcept
+    {
+        auto lock = std::scoped_lock(m_Mutex);
+        for (auto && cache : m_ThreadCaches)
+        {
+            for (auto && freeList : cache.freeLists)
+            {
+                freeList.clear();
+            }
+        }
+
+        for (auto && block : m_Blocks)
+        {
+            FreeDeviceMemory(block->GetMemory(), block->GetSize());
+        }
+        m_Blocks.clear();
+    }
+
+private:
+    [[nodiscard]] static std::uint32_t GetSizeClass(VkDeviceSize size) noexcept
+    {
+        auto classBits = std::max(static_cast<std::uint32_t>(std::bit_width(size - 1)), smallestSizeBits);
+
+        return classBits - smallestSizeBits < sizeClassCount ? classBits - smallestSizeBits : noSizeClass;
+    }
+
+    [[nodiscard]] static std::uint32_t GetThreadSlot() noexcept
+    {
+        static auto nextSlot = std::atomic<std::uint32_t>(0);
+        thread_local auto slot = nextSlot.fetch_add(1, std::memory_order_relaxed) % threadCacheSlotCount;
+
+        return slot;
+    }
+
+    void CountAllocation(const MemoryAllocation & allocation) noexcept
+    {
+        m_Counters.usedBytes.fetch_add(allocation.size, std::memory_order_relaxed);
+        m_Counters.allocationCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::optional<MemoryAllocation> TryAllocateFromBlocks(VkDeviceSize size, VkDeviceSize alignment,
+                                                                        std::uint32_t sizeClass)
+    {
+        for (auto && block : m_Blocks)
+        {
+            if (block->GetFreeSize() < size)
+            {
+                continue;
+            }
+
+            if (auto node = block->Allocate(size, alignment); node != nullptr)
+            {
+                return MemoryAllocation{ .memory     = block->GetMemory(),
+                                         .offset     = node->offset,
+                                         .size       = node->size,
+                                         .mapped     = block->GetMapped(node->offset),
+                                         .pool       = this,
+                                         .block      = block.get(),
+                                         .node       = node,
+                                         .memoryType = m_MemoryType,
+                                         .sizeClass  = sizeClass };
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    [[nodiscard]] MemoryAllocation AllocateLocked(VkDeviceSize size, VkDeviceSize alignment, std::uint32_t sizeClass)
+    {
+        if (auto allocation = TryAllocateFromBlocks(size, alignment, sizeClass))
+        {
+            return *allocation;
+        }
+
+        auto blockSize        = std::max(m_BlockSize, size + alignment);
+        auto [memory, mapped] = AllocateDeviceMemory(blockSize);
+        m_Blocks.push_back(std::make_unique<MemoryBlock>(memory, blockSize, mapped));
+
+        auto & block = m_Blocks.back();
+        auto   node  = block->Allocate(size, alignment);
+
+        return MemoryAllocation{ .memory     = block->GetMemory(),
+                                 .offset     = node->offset,
+                                 .size       = node->size,
+                                 .mapped     = block->GetMapped(node->offset),
+                                 .pool       = this,
+                                 .block      = block.get(),
+                                 .node       = node,
+                                 .memoryType = m_MemoryType,
+                                 .sizeClass  = sizeClass };
+    }
+
+    void FreeLocked(const MemoryAllocation & allocation) noexcept
+    {
+        allocation.block->Free(allocation.node);
+
+        // One empty block is kept around so a pool that oscillates around zero does not hit the driver each time
+        if (allocation.block->IsEmpty() && m_Blocks.size() > 1)
+        {
+            auto blockIt = std::ranges::find_if(m_Blocks,
+                                                [&allocation](const auto & block)
+                                                {
+                                                    return block.get() == allocation.block;
+                                                });
+            FreeDeviceMemory((*blockIt)->GetMemory(), (*blockIt)->GetSize());
+            m_Blocks.erase(blockIt);
+        }
+    }
+
+    [[nodiscard]] std::pair<VkDeviceMemory, void *> AllocateDeviceMemory(VkDeviceSize size)
+    {
+        if (m_DeviceAllocationCount.fetch_add(1, std::memory_order_relaxed) >= m_MaxDeviceAllocationCount)
+        {
+            m_DeviceAllocationCount.fetch_sub(1, std::memory_order_relaxed);
+            throw std::runtime_error("Exceeded maxMemoryAllocationCount");
+        }
+
+        auto allocateInfo = VkMemoryAllocateInfo{ .sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+                                                  .pNext           = nullptr,
+                                                  .allocationSize  = size,
+                                                  .memoryTypeIndex = m_MemoryType };
+
+        auto memory = VkDeviceMemory(VK_NULL_HANDLE);
+        if (vkAllocateMemory(m_Device, &allocateInfo, HostAllocator::GetCallbacks(), &memory) != VK_SUCCESS)
+        {
+            m_DeviceAllocationCount.fetch_sub(1, std::memory_order_relaxed);
+            throw std::runtime_error("Failed to allocate device memory");
+        }
+
+        // Host visible memory stays mapped for its whole lifetime
+        auto mapped = static_cast<void *>(nullptr);
+        if (m_IsMapped && vkMapMemory(m_Device, memory, 0, VK_WHOLE_SIZE, 0, &mapped) != VK_SUCCESS)
+        {
+            vkFreeMemory(m_Device, memory, HostAllocator::GetCallbacks());
+            m_DeviceAllocationCount.fetch_sub(1, std::memory_order_relaxed);
+            throw std::runtime_error("Failed to map device memory");
+        }
+
+        m_Counters.blockBytes.fetch_add(size, std::memory_order_relaxed);
+        m_Counters.blockCount.fetch_add(1, std::memory_order_relaxed);
+
+        return { memory, mapped };
+    }
+
+    void FreeDeviceMemory(VkDeviceMemory memory, VkDeviceSize size) noexcept
+    {
+        vkFreeMemory(m_Device, memory, HostAllocator::GetCallbacks());
+
+        m_DeviceAllocationCount.fetch_sub(1, std::memory_order_relaxed);
+        m_Counters.blockBytes.fetch_sub(size, std::memory_order_relaxed);
+        m_Counters.blockCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+private:
+    VkDevice                                        m_Device;
+    std::uint32_t                                   m_MemoryType;
+    bool                                            m_IsMapped;
+    VkDeviceSize                                    m_BlockSize;
+    MemoryHeapCounters &                            m_Counters;
+    std::atomic<std::uint32_t> &                    m_DeviceAllocationCount;
+    std::uint32_t                                   m_MaxDeviceAllocationCount;
+    std::mutex                                      m_Mutex;
+    std::vector<std::unique_ptr<MemoryBlock>>       m_Blocks;
+    std::array<ThreadCache, threadCacheSlotCount> m_ThreadCaches;
+};
+
+class MemoryAllocator
+{
+public:
+    enum class ResourceKind
+    {
+        Linear,
+        Optimal
+    };
+
+private:
+    static constexpr auto largeHeapBlockSize = VkDeviceSize(64) * 1024 * 1024;
+    static constexpr auto smallHeapSize      = VkDeviceSize(1024) * 1024 * 1024;
+
+    struct State
+    {
+        VkDevice                                            device;
+        VkPhysicalDeviceMemoryProperties                    memoryProperties;
+        VkDeviceSize                                        bufferImageGranularity;
+        std::atomic<std::uint32_t>                          deviceAllocationCount;
+        std::array<MemoryHeapCounters, VK_MAX_MEMORY_HEAPS> heapCounters;
+        std::vector<std::unique_ptr<MemoryPool>>            pools;
+    };
+
+public:
+    explicit MemoryAllocator(std::unique_ptr<State> state) noexcept : m_State(std::move(state))
+    {}
+
+    MemoryAllocator(const MemoryAllocator & other) = delete;
+
+    MemoryAllocator(MemoryAllocator && other) noexcept = default;
+
+    MemoryAllocator & operator=(const MemoryAllocator & other) = delete;
+
+    MemoryAllocator & operator=(MemoryAllocator && other) noexcept = default;
+
+    ~MemoryAllocator() noexcept = default;
+
+    [[nodiscard]] MemoryAllocation Allocate(const VkMemoryRequirements & requirements, MemoryUsage usage,
+                                            ResourceKind kind)
+    {
+        auto memoryType = FindMemoryType(requirements.memoryTypeBits, usage);
+
+        // Linear and optimal resources never share a block, so bufferImageGranularity can not be violated
+        auto isSeparated = m_State->bufferImageGranularity > 1 && kind == ResourceKind::Optimal;
+        auto & pool      = *m_State->pools[memoryType * 2 + (isSeparated ? 1 : 0)];
+
+        auto heapIndex = m_State->memoryProperties.memoryTypes[memoryType].heapIndex;
+        if (requirements.size >= GetBlockSize(heapIndex) / 2)
+        {
+            return pool.AllocateDedicated(requirements.size);
+        }
+
+        return pool.Allocate(requirements.size, requirements.alignment);
+    }
+
+    [[nodiscard]] MemoryAllocation AllocateForBuffer(VkBuffer buffer, MemoryUsage usage)
+    {
+        auto requirements = VkMemoryRequirements();
+        vkGetBufferMemoryRequirements(m_State->device, buffer, &requirements);
+
+        auto allocation = Allocate(requirements, usage, ResourceKind::Linear);
+        if (vkBindBufferMemory(m_State->device, buffer, allocation.memory, allocation.offset) != VK_SUCCESS)
+        {
+            Free(allocation);
+            throw std::runtime_error("Failed to bind buffer memory");
+        }
+
+        return allocation;
+    }
+
+    [[nodiscard]] MemoryAllocation AllocateForImage(VkImage image, MemoryUsage usage, ResourceKind kind)
+    {
+        auto requirements = VkMemoryRequirements();
+        vkGetImageMemoryRequirements(m_State->device, image, &requirements);
+
+        auto allocation = Allocate(requirements, usage, kind);
+        if (vkBindImageMemory(m_State->device, image, allocation.memory, allocation.offset) != VK_SUCCESS)
+        {
+            Free(allocation);
+            throw std::runtime_error("Failed to bind image memory");
+        }
+
+        return allocation;
+    }
+
+    static void Free(const MemoryAllocation & allocation) noexcept
+    {
+        if (allocation.pool != nullptr)
+        {
+            allocation.pool->Free(allocation);
+        }
+    }
+
+    [[nodiscard]] std::vector<MemoryHeapStatistics> GetStatistics() const
+    {
+        const auto & memoryProperties = m_State->memoryProperties;
+
+        auto statistics = std::vector<MemoryHeapStatistics>(memoryProperties.memoryHeapCount);
+        for (auto index = 0u; index < memoryProperties.memoryHeapCount; ++index)
+        {
+            const auto & counters = m_State->heapCounters[index];
+            const auto & heap     = memoryProperties.memoryHeaps[index];
+
+            statistics[index] = MemoryHeapStatistics{
+                .size                     = heap.size,
+                .blockBytes               = counters.blockBytes.load(std::memory_order_relaxed),
+                .usedBytes                = counters.usedBytes.load(std::memory_order_relaxed),
+                .blockCount               = counters.blockCount.load(std::memory_order_relaxed),
+                .allocationCount          = counters.allocationCount.load(std::memory_order_relaxed),
+                .dedicatedAllocationCount = counters.dedicatedAllocationCount.load(std::memory_order_relaxed),
+                .isDeviceLocal            = (heap.flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0
+            };
+        }
+
+        return statistics;
+    }
+
+    // Has to be called before the owning device is destroyed
+    void Release() noexcept
+    {
+        if (!m_State)
+        {
+            return;
+        }
+
+        for (auto && pool : m_State->pools)
+        {
+            pool->Release();
+        }
+    }
+
+    [[nodiscard]] static MemoryAllocator Create(VkDevice device, const PhysicalDeviceInfo & physicalDevice)
+    {
+        const auto & properties = physicalDevice.GetProperties();
+
+        auto state                    = std::make_unique<State>();
+        state->device                 = device;
+        state->bufferImageGranularity = properties.limits.bufferImageGranularity;
+        state->memoryProperties       = physicalDevice.GetMemoryProperties();
+
+        auto allocator = MemoryAllocator(std::move(state));
+        auto & shared  = *allocator.m_State;
+        for (auto memoryType = 0u; memoryType < shared.memoryProperties.memoryTypeCount; ++memoryType)
+        {
+            const auto & type = shared.memoryProperties.memoryTypes[memoryType];
+            for (auto kind = 0; kind < 2; ++kind)
+            {
+                shared.pools.push_back(std::make_unique<MemoryPool>(
+                    device, memoryType, (type.propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0,
+                    allocator.GetBlockSize(type.heapIndex), shared.heapCounters[type.heapIndex],
+                    shared.deviceAllocationCount, properties.limits.maxMemoryAllocationCount));
+            }
+        }
+
+        return allocator;
+    }
+
+private:
+    [[nodiscard]] VkDeviceSize GetBlockSize(std::uint32_t heapIndex) const noexcept
+    {
+        auto heapSize = m_State->memoryProperties.memoryHeaps[heapIndex].size;
+
+        return heapSize <= smallHeapSize ? heapSize / 8 : largeHeapBlockSize;
+    }
+
+    [[nodiscard]] std::uint32_t FindMemoryType(std::uint32_t memoryTypeBits, MemoryUsage usage) const
+    {
+        auto [requiredFlags, preferredFlags] = [usage]()
+        {
+            switch (usage)
+            {
+                case MemoryUsage::CpuToGpu:
+                    return std::pair<VkMemoryPropertyFlags, VkMemoryPropertyFlags>(
+                        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, 0);
+                case MemoryUsage::GpuToCpu:
+                    return std::pair<VkMemoryPropertyFlags, VkMemoryPropertyFlags>(
+                        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                        VK_MEMORY_PROPERTY_HOST_CACHED_BIT);
+                case MemoryUsage::GpuOnly:
+                default:
+                    return std::pair<VkMemoryPropertyFlags, VkMemoryPropertyFlags>(
+                        0, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+            }
+        }();
+
+        const auto & memoryProperties = m_State->memoryProperties;
+        for (auto flags : { requiredFlags | preferredFlags, requiredFlags })
+        {
+            for (auto memoryType = 0u; memoryType < memoryProperties.memoryTypeCount; ++memoryType)
+            {
+                if ((memoryTypeBits & (1u << memoryType))
+                    && (memoryProperties.memoryTypes[memoryType].propertyFlags & flags) == flags)
+                {
+                    return memoryType;
+                }
+            }
+        }
+
+        throw std::runtime_error("Failed to find a suitable memory type");
+    }
+
+private:
+    std::unique_ptr<State> m_State;
+};
+} // namespace CuEngine::Vulkan::Impl
@@ -0,0 +1,340 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace CuEngine::Vulkan::Impl
+{
+// Two-level segregated fit sub-allocator over a single VkDeviceMemory, O(1) allocation and coalescing free
+class MemoryBlock
+{
+public:
+    struct Node
+    {
+        VkDeviceSize offset;
+        VkDeviceSize size;
+        Node *       previousPhysical;
+        Node *       nextPhysical;
+        Node *       previousFree;
+        Node *       nextFree;
+        bool         isFree;
+    };
+
+private:
+    static constexpr auto secondLevelBits  = 5u;
+    static constexpr auto secondLevelCount = 1u << secondLevelBits;
+    static constexpr auto smallSizeBits    = 8u;
+    static constexpr auto firstLevelCount  = 64u - smallSizeBits + 1u;
+
+public:
+    explicit MemoryBlock(VkDeviceMemory memory, VkDeviceSize size, void * mapped)
+        : m_Memory(memory), m_Size(size), m_Mapped(mapped), m_FreeSize(size), m_AllocationCount(0),
+          m_FirstLevelBitmap(0), m_SecondLevelBitmaps(), m_FreeLists(), m_NodeStorage(), m_SpareNodes()
+    {
+        auto node = CreateNode(0, size);
+        InsertFree(node);
+    }
+
+    MemoryBlock(const MemoryBlock & other) = delete;
+
+    MemoryBlock(MemoryBlock && other) noexcept = delete;
+
+    MemoryBlock & operator=(const MemoryBlock & other) = delete;
+
+    MemoryBlock & operator=(MemoryBlock && other) noexcept = delete;
+
+    ~MemoryBlock() noexcept = default;
+
+    [[nodiscard]] Node * Allocate(VkDeviceSize size, VkDeviceSize alignment)
+    {
+        alignment = std::max(alignment, VkDeviceSize(1));
+
+        // Searching with the worst case padding guarantees that any node of the found list fits
+        auto node = FindFree(size + alignment - 1);
+        if (node == nullptr)
+        {
+            return nullptr;
+        }
+        RemoveFree(node);
+
+        auto padding = AlignUp(node->offset, alignment) - node->offset;
+        if (padding > 0)
+        {
+            auto front = CreateNode(node->offset, padding);
+            LinkBefore(front, node);
+            node->offset += padding;
+            node->size -= padding;
+            InsertFree(front);
+        }
+
+        if (node->size > size)
+        {
+            auto back = CreateNode(node->offset + size, node->size - size);
+            LinkAfter(back, node);
+            node->size = size;
+            InsertFree(back);
+        }
+
+        node->isFree = false;
+        m_FreeSize -= node->size;
+        m_AllocationCount++;
+
+        return node;
+    }
+
+    void Free(Node * node) noexcept
+    {
+        node->isFree = true;
+        m_FreeSize += node->size;
+        m_AllocationCount--;
+
+        if (auto previous = node->previousPhysical; previous != nullptr && previous->isFree)
+        {
+            RemoveFree(previous);
+            previous->size += node->size;
+            Unlink(node);
+            node = previous;
+        }
+
+        if (auto next = node->nextPhysical; next != nullptr && next->isFree)
+        {
+            RemoveFree(next);
+            node->size += next->size;
+            Unlink(next);
+        }
+
+        InsertFree(node);
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept
+    {
+        return m_AllocationCount == 0;
+    }
+
+    [[nodiscard]] VkDeviceMemory GetMemory() const noexcept
+    {
+        return m_Memory;
+    }
+
+    [[nodiscard]] VkDeviceSize GetSize() const noexcept
+    {
+        return m_Size;
+    }
+
+    [[nodiscard]] VkDeviceSize GetFreeSize() const noexcept
+    {
+        return m_FreeSize;
+    }
+
+    [[nodiscard]] void * GetMapped(VkDeviceSize offset) const noexcept
+    {
+        return m_Mapped != nullptr ? static_cast<std::byte *>(m_Mapped) + offset : nullptr;
+    }
+
+private:
+    [[nodiscard]] static VkDeviceSize AlignUp(VkDeviceSize value, VkDeviceSize alignment) noexcept
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    [[nodiscard]] static std::pair<std::uint32_t, std::uint32_t> Mapping(VkDeviceSize size) noexcept
+    {
+        if (size < (VkDeviceSize(1) << smallSizeBits))
+        {
+            return { 0u, static_cast<std::uint32_t>(size >> (smallSizeBits - secondLevelBits)) };
+        }
+
+        auto mostSignificantBit = static_cast<std::uint32_t>(std::bit_width(size) - 1);
+        auto firstLevel         = mostSignificantBit - smallSizeBits + 1;
+        auto secondLevel =
+            static_cast<std::uint32_t>(size >> (mostSignificantBit - secondLevelBits)) - secondLevelCount;
+
+        return { firstLevel, secondLevel };
+    }
+
+    [[nodiscard]] Node * FindFree(VkDeviceSize size) const noexcept
+    {
+        // Rounding up to the next list start turns the good fit into a guaranteed fit
+        if (size < (VkDeviceSize(1) << smallSizeBits))
+        {
+            size = AlignUp(size, VkDeviceSize(1) << (smallSizeBits - secondLevelBits));
+        }
+        else
+        {
+            auto roundUp = (VkDeviceSize(1) << (std::bit_width(size) - 1 - secondLevelBits)) - 1;
+            if (size > ~VkDeviceSize(0) - roundUp)
+            {
+                return nullptr;
+            }
+            size += roundUp;
+        }
+
+        auto [firstLevel, secondLevel] = Mapping(size);
+
+        auto secondLevelMap = m_SecondLevelBitmaps[firstLevel] & (~0u << secondLevel);
+        if (secondLevelMap == 0)
+        {
+            auto firstLevelMap =
+                firstLevel + 1 < 64u ? m_FirstLevelBitmap & (~std::uint64_t(0) << (firstLevel + 1)) : 0;
+            if (firstLevelMap == 0)
+            {
+                return nullptr;
+            }
+
+            firstLevel     = static_cast<std::uint32_t>(std::countr_zero(firstLevelMap));
+            secondLevelMap = m_SecondLevelBitmaps[firstLevel];
+        }
+        secondLevel = static_cast<std::uint32_t>(std::countr_zero(secondLevelMap));
+
+        return m_FreeLists[firstLevel][secondLevel];
+    }
+
+    void InsertFree(Node * node) noexcept
+    {
+        auto [firstLevel, secondLevel] = Mapping(node->size);
+        auto & head                    = m_FreeLists[firstLevel][secondLevel];
+
+        node->isFree       = true;
+        node->previousFree = nullptr;
+        node->nextFree     = head;
+        if (head != nullptr)
+        {
+            head->previousFree = node;
+        }
+        head = node;
+
+        m_FirstLevelBitmap |= std::uint64_t(1) << firstLevel;
+        m_SecondLevelBitmaps[firstLevel] |= 1u << secondLevel;
+    }
+
+    void RemoveFree(Node * node) noexcept
+    {
+        auto [firstLevel, secondLevel] = Mapping(node->size);
+        auto & head                    = m_FreeLists[firstLevel][secondLevel];
+
+        if (node->previousFree != nullptr)
+        {
+            node->previousFree->nextFree = node->nextFree;
+        }
+        if (node->nextFree != nullptr)
+        {
+            node->nextFree->previousFree = node->previousFree;
+        }
+        if (head == node)
+        {
+            head = node->nextFree;
+        }
+
+        if (head == nullptr)
+        {
+            m_SecondLevelBitmaps[firstLevel] &= ~(1u << secondLevel);
+            if (m_SecondLevelBitmaps[firstLevel] == 0)
+            {
+                m_FirstLevelBitmap &= ~(std::uint64_t(1) << firstLevel);
+            }
+        }
+    }
+
+    [[nodiscard]] Node * CreateNode(VkDeviceSize offset, VkDeviceSize size)
+    {
+        auto node = static_cast<Node *>(nullptr);
+        if (m_SpareNodes.empty())
+        {
+            node = &m_NodeStorage.emplace_back();
+            m_SpareNodes.reserve(m_NodeStorage.size());
+        }
+        else
+        {
+            node = m_SpareNodes.back();
+            m_SpareNodes.pop_back();
+        }
+
+        *node = Node{ .offset           = offset,
+                      .size             = size,
+                      .previousPhysical = nullptr,
+                      .nextPhysical     = nullptr,
+                      .previousFree     = nullptr,
+                      .nextFree         = nullptr,
+                      .isFree           = false };
+
+        return node;
+    }
+
+    static void LinkBefore(Node * node, Node * next) noexcept
+    {
+        node->previousPhysical = next->previousPhysical;
+        node->nextPhysical     = next;
+        if (next->previousPhysical != nullptr)
+        {
+            next->previousPhysical->nextPhysical = node;
+        }
+        next->previousPhysical = node;
+    }
+
+    static void LinkAfter(Node * node, Node * previous) noexcept
+    {
+        node->nextPhysical     = previous->nextPhysical;
+        node->previousPhysical = previous;
+        if (previous->nextPhysical != nullptr)
+        {
+            previous->nextPhysical->previousPhysical = node;
+        }
+        previous->nextPhysical = node;
+    }
+
+    void Unlink(Node * node) noexcept
+    {
+        if (node->previousPhysical != nullptr)
+        {
+            node->previousPhysical->nextPhysical = node->nextPhysical;
+        }
+        if (node->nextPhysical != nullptr)
+        {
+            node->nextPhysical->previousPhysical = node->previousPhysical;
+        }
+
+        // Capacity is reserved for every node ever created, so this never allocates
+        m_SpareNodes.push_back(node);
+    }
+
+private:
+    VkDeviceMemory                                                    m_Memory;
+    VkDeviceSize                                                      m_Size;
+    void *                                                            m_Mapped;
+    VkDeviceSize                                                      m_FreeSize;
+    std::uint32_t                                                     m_AllocationCount;
+    std::uint64_t                                                     m_FirstLevelBitmap;
+    std::array<std::uint32_t, firstLevelCount>                        m_SecondLevelBitmaps;
+    std::array<std::array<Node *, secondLevelCount>, firstLevelCount> m_FreeLists;
+    std::deque<Node>                                                  m_NodeStorage;
+    std::vector<Node *>                                               m_SpareNodes;
+};
+} // namespace CuEngine::Vulkan::Impl
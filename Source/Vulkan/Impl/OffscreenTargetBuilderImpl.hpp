@@ -0,0 +1,185 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include "DeviceImpl.hpp"
+#include "ImageBuilderImpl.hpp"
+#include "HostAllocatorImpl.hpp"
+#include "LoaderImpl.hpp"
+#include "OffscreenTargetImpl.hpp"
+#include "QueueFamilyImpl.hpp"
+
+#include <CuEngine/Vulkan/OffscreenTargetBuilder.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace CuEngine::Vulkan::Impl
+{
+class OffscreenTargetBuilder
+{
+public:
+    explicit OffscreenTargetBuilder() noexcept
+        : m_Device(nullptr), m_QueueFamilyIndex(0), m_Format(Format::R8G8B8A8Unorm), m_Extent(),
+          m_Usage(ImageUsage::TransferSource | ImageUsage::TransferDestination), m_FramesInFlight(2)
+    {}
+
+    OffscreenTargetBuilder(const OffscreenTargetBuilder & other) = default;
+
+    OffscreenTargetBuilder(OffscreenTargetBuilder && other) noexcept = default;
+
+    OffscreenTargetBuilder & operator=(const OffscreenTargetBuilder & other) = default;
+
+    OffscreenTargetBuilder & operator=(OffscreenTargetBuilder && other) noexcept = default;
+
+    ~OffscreenTargetBuilder() noexcept = default;
+
+    OffscreenTargetBuilder & SetDevice(Device & device) noexcept
+    {
+        m_Device = &device;
+
+        return *this;
+    }
+
+    OffscreenTargetBuilder & SetQueueFamily(const QueueFamily & queueFamily) noexcept
+    {
+        m_QueueFamilyIndex = queueFamily.GetIndex();
+
+        return *this;
+    }
+
+    OffscreenTargetBuilder & SetFormat(Format format) noexcept
+    {
+        m_Format = format;
+
+        return *this;
+    }
+
+    OffscreenTargetBuilder & SetExtent(VkExtent2D extent) noexcept
+    {
+        m_Extent = extent;
+
+        return *this;
+    }
+
+    OffscreenTargetBuilder & SetUsage(ImageUsage usage) noexcept
+    {
+        m_Usage = usage | ImageUsage::TransferSource | ImageUsage::TransferDestination;
+
+        return *this;
+    }
+
+    OffscreenTargetBuilder & SetFramesInFlight(std::uint32_t framesInFlight) noexcept
+    {
+        m_FramesInFlight = framesInFlight;
+
+        return *this;
+    }
+
+    [[nodiscard]] OffscreenTarget Build() const
+    {
+        if (m_Device == nullptr || m_FramesInFlight == 0)
+        {
+            throw std::runtime_error("Failed to create an offscreen target: invalid configuration");
+        }
+
+        auto imageBuilder = ImageBuilder();
+        imageBuilder.SetDevice(*m_Device).SetFormat(m_Format).SetExtent(m_Extent).SetUsage(m_Usage);
+
+        auto images = std::vector<Vulkan::Image>();
+        for (auto index = 0u; index < m_FramesInFlight; ++index)
+        {
+            images.emplace_back(imageBuilder.Build());
+        }
+
+        return OffscreenTarget(m_Device->GetHandle(), std::move(images), CreateFrames());
+    }
+
+private:
+    [[nodiscard]] std::vector<OffscreenTarget::Frame> CreateFrames() const
+    {
+        auto device = m_Device->GetHandle();
+        auto frames = std::vector<OffscreenTarget::Frame>(m_FramesInFlight);
+        std::ranges::generate(frames,
+                              [this, device]()
+                              {
+                                  auto fenceInfo = VkFenceCreateInfo{ .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
+                                                                      .pNext = nullptr,
+                                                                      .flags = VK_FENCE_CREATE_SIGNALED_BIT };
+
+                                  auto fence = VkFence(VK_NULL_HANDLE);
+                                  if (vkCreateFence(device, &fenceInfo, HostAllocator::GetCallbacks(), &fence)
+                                      != VK_SUCCESS)
+                                  {
+                                      throw std::runtime_error("Failed to create a frame fence");
+                                  }
+
+                                  auto poolInfo = VkCommandPoolCreateInfo{
+                                      .sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+                                      .pNext            = nullptr,
+                                      .flags            = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT,
+                                      .queueFamilyIndex = m_QueueFamilyIndex
+                                  };
+
+                                  auto commandPool = VkCommandPool(VK_NULL_HANDLE);
+                                  if (vkCreateCommandPool(device, &poolInfo, HostAllocator::GetCallbacks(),
+                                                          &commandPool)
+                                      != VK_SUCCESS)
+                                  {
+                                      throw std::runtime_error("Failed to create a frame command pool");
+                                  }
+
+                                  auto allocateInfo = VkCommandBufferAllocateInfo{
+                                      .sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+                                      .pNext              = nullptr,
+                                      .commandPool        = commandPool,
+                                      .level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+                                      .commandBufferCount = 1
+                                  };
+
+                                  auto commandBuffer = VkCommandBuffer(VK_NULL_HANDLE);
+                                  if (vkAllocateCommandBuffers(device, &allocateInfo, &commandBuffer) != VK_SUCCESS)
+                                  {
+                                      throw std::runtime_error("Failed to allocate a frame command buffer");
+                                  }
+
+                                  return OffscreenTarget::Frame{ .inFlightFence = fence,
+                                                                 .commandPool   = commandPool,
+                                                                 .commandBuffer = commandBuffer };
+                              });
+
+        return frames;
+    }
+
+private:
+    Device *      m_Device;
+    std::uint32_t m_QueueFamilyIndex;
+    Format        m_Format;
+    VkExtent2D    m_Extent;
+    ImageUsage    m_Usage;
+    std::uint32_t m_FramesInFlight;
+};
+} // namespace CuEngine::Vulkan::Impl
@@ -0,0 +1,256 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include "GpuProfilerImpl.hpp"
+#include "ImageImpl.hpp"
+#include "HostAllocatorImpl.hpp"
+#include "LoaderImpl.hpp"
+#include "QueueImpl.hpp"
+
+#include <CuEngine/Vulkan/Image.hpp>
+#include <CuEngine/Vulkan/OffscreenTarget.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace CuEngine::Vulkan::Impl
+{
+class OffscreenTarget
+{
+public:
+    struct Frame
+    {
+        VkFence         inFlightFence;
+        VkCommandPool   commandPool;
+        VkCommandBuffer commandBuffer;
+    };
+
+private:
+    struct State
+    {
+        VkDevice                   device;
+        std::uint32_t              frameIndex;
+        std::vector<Vulkan::Image> images;
+        std::vector<Frame>         frames;
+    };
+
+public:
+    explicit OffscreenTarget(VkDevice device, std::vector<Vulkan::Image> && images, std::vector<Frame> && frames)
+        : m_State(new State{ .device     = device,
+                             .frameIndex = 0,
+                             .images     = std::move(images),
+                             .frames     = std::move(frames) })
+    {}
+
+    OffscreenTarget(const OffscreenTarget & other) = delete;
+
+    OffscreenTarget(OffscreenTarget && other) noexcept = default;
+
+    OffscreenTarget & operator=(const OffscreenTarget & other) = delete;
+
+    OffscreenTarget & operator=(OffscreenTarget && other) noexcept
+    {
+        if (this != &other)
+        {
+            std::swap(m_State, other.m_State);
+        }
+
+        return *this;
+    }
+
+    ~OffscreenTarget() noexcept
+    {
+        if (!m_State)
+        {
+            return;
+        }
+
+        // Nothing but our own submissions uses the images, so the frame fences are enough
+        try
+        {
+            WaitIdle();
+        }
+        catch (...)
+        {
+            vkDeviceWaitIdle(m_State->device);
+        }
+
+        for (auto && frame : m_State->frames)
+        {
+            vkDestroyCommandPool(m_State->device, frame.commandPool, HostAllocator::GetCallbacks());
+            vkDestroyFence(m_State->device, frame.inFlightFence, HostAllocator::GetCallbacks());
+        }
+    }
+
+    [[nodiscard]] bool AcquireNextImage()
+    {
+        constexpr auto noTimeout = std::numeric_limits<std::uint64_t>::max();
+
+        auto & frame = m_State->frames[m_State->frameIndex];
+        if (vkWaitForFences(m_State->device, 1, &frame.inFlightFence, VK_TRUE, noTimeout) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to wait for a frame fence");
+        }
+
+        return true;
+    }
+
+    void Submit(Queue & graphicsQueue, QueueSubmission && submission, GpuProfiler * gpuProfiler)
+    {
+        auto & frame = m_State->frames[m_State->frameIndex];
+
+        RecordCommandBuffer(frame, m_State->images[m_State->frameIndex].GetImpl().GetHandle(), gpuProfiler);
+
+        submission.commandBuffers.push_back(frame.commandBuffer);
+        if (vkResetFences(m_State->device, 1, &frame.inFlightFence) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to reset a frame fence");
+        }
+
+        try
+        {
+            graphicsQueue.Submit(submission, frame.inFlightFence);
+        }
+        catch (...)
+        {
+            graphicsQueue.SignalFence(frame.inFlightFence);
+            throw;
+        }
+
+        m_State->frameIndex = (m_State->frameIndex + 1) % static_cast<std::uint32_t>(m_State->frames.size());
+    }
+
+    void WaitIdle()
+    {
+        constexpr auto noTimeout = std::numeric_limits<std::uint64_t>::max();
+
+        auto fences = std::vector<VkFence>();
+        for (auto && frame : m_State->frames)
+        {
+            fences.push_back(frame.inFlightFence);
+        }
+
+        if (vkWaitForFences(m_State->device, static_cast<std::uint32_t>(fences.size()), fences.data(), VK_TRUE,
+                            noTimeout)
+            != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to wait for the frame fences");
+        }
+    }
+
+    [[nodiscard]] std::uint32_t GetFramesInFlight() const noexcept
+    {
+        return static_cast<std::uint32_t>(m_State->frames.size());
+    }
+
+    [[nodiscard]] std::uint32_t GetFrameIndex() const noexcept
+    {
+        return m_State->frameIndex;
+    }
+
+    [[nodiscard]] const Vulkan::Image & GetImage() const noexcept
+    {
+        return m_State->images[m_State->frameIndex];
+    }
+
+private:
+    void RecordCommandBuffer(Frame & frame, VkImage image, GpuProfiler * gpuProfiler) const
+    {
+        // The frame fence is signaled at this point, so the whole pool can be recycled at once
+        if (vkResetCommandPool(m_State->device, frame.commandPool, 0) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to reset a frame command pool");
+        }
+
+        auto beginInfo = VkCommandBufferBeginInfo{ .sType            = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+                                                   .pNext            = nullptr,
+                                                   .flags            = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+                                                   .pInheritanceInfo = nullptr };
+        if (vkBeginCommandBuffer(frame.commandBuffer, &beginInfo) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to begin a frame command buffer");
+        }
+
+        if (gpuProfiler != nullptr)
+        {
+            gpuProfiler->BeginFrame(frame.commandBuffer, m_State->frameIndex);
+            gpuProfiler->BeginScope(frame.commandBuffer, "Frame");
+        }
+
+        auto range = VkImageSubresourceRange{ .aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT,
+                                              .baseMipLevel   = 0,
+                                              .levelCount     = 1,
+                                              .baseArrayLayer = 0,
+                                              .layerCount     = 1 };
+
+        auto toTransfer = VkImageMemoryBarrier{ .sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+                                                .pNext               = nullptr,
+                                                .srcAccessMask       = 0,
+                                                .dstAccessMask       = VK_ACCESS_TRANSFER_WRITE_BIT,
+                                                .oldLayout           = VK_IMAGE_LAYOUT_UNDEFINED,
+                                                .newLayout           = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                                .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                                                .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                                                .image               = image,
+                                                .subresourceRange    = range };
+        vkCmdPipelineBarrier(frame.commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0,
+                             nullptr, 0, nullptr, 1, &toTransfer);
+
+        auto clearColor = VkClearColorValue{ .float32 = { 0.0f, 0.0f, 0.0f, 1.0f } };
+        vkCmdClearColorImage(frame.commandBuffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &clearColor, 1, &range);
+
+        auto toReadback = VkImageMemoryBarrier{ .sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+                                                .pNext               = nullptr,
+                                                .srcAccessMask       = VK_ACCESS_TRANSFER_WRITE_BIT,
+                                                .dstAccessMask       = VK_ACCESS_TRANSFER_READ_BIT,
+                                                .oldLayout           = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                                .newLayout           = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                                                .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                                                .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                                                .image               = image,
+                                                .subresourceRange    = range };
+        vkCmdPipelineBarrier(frame.commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0,
+                             nullptr, 0, nullptr, 1, &toReadback);
+
+        if (gpuProfiler != nullptr)
+        {
+            gpuProfiler->EndScope(frame.commandBuffer);
+        }
+
+        if (vkEndCommandBuffer(frame.commandBuffer) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to end a frame command buffer");
+        }
+    }
+
+private:
+    std::unique_ptr<State> m_State;
+};
+} // namespace CuEngine::Vulkan::Impl
@@ -25,15 +25,21 @@
 #include <vulkan/vulkan.h>
 
 #include "InstanceImpl.hpp"
+#include "PhysicalDeviceInfoImpl.hpp"
 
 #include <CuEngine/Vulkan/PhysicalDevice.hpp>
 
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <string_view>
+
 namespace CuEngine::Vulkan::Impl
 {
 class PhysicalDevice
 {
 public:
-    explicit PhysicalDevice(VkPhysicalDevice handle) noexcept : m_Handle(handle)
+    explicit PhysicalDevice(std::shared_ptr<const PhysicalDeviceInfo> info) noexcept : m_Info(std::move(info))
     {}
 
     PhysicalDevice(const PhysicalDevice &) noexcept = default;
@@ -48,18 +54,111 @@ public:
 
     [[nodiscard]] std::string GetName() const
     {
-        auto properties = VkPhysicalDeviceProperties();
-        vkGetPhysicalDeviceProperties(m_Handle, &properties);
+        return m_Info->GetProperties().deviceName;
+    }
+
+    // Nanoseconds per timestamp tick
+    [[nodiscard]] float GetTimestampPeriod() const
+    {
+        return m_Info->GetLimits().timestampPeriod;
+    }
+
+    [[nodiscard]] Vulkan::PhysicalDeviceType GetType() const noexcept
+    {
+        return static_cast<Vulkan::PhysicalDeviceType>(m_Info->GetProperties().deviceType);
+    }
+
+    [[nodiscard]] std::string GetUuid() const
+    {
+        const auto & uuid = m_Info->GetVulkan11Properties().deviceUUID;
+        if (std::ranges::all_of(uuid,
+                                [](auto byte)
+                                {
+                                    return byte == 0;
+                                }))
+        {
+            return {};
+        }
+
+        constexpr auto digits = std::string_view("0123456789abcdef");
 
-        return properties.deviceName;
+        auto result = std::string();
+        for (auto index = 0u; index < VK_UUID_SIZE; ++index)
+        {
+            if (index == 4 || index == 6 || index == 8 || index == 10)
+            {
+                result += '-';
+            }
+            result += digits[uuid[index] >> 4];
+            result += digits[uuid[index] & 0xF];
+        }
+
+        return result;
+    }
+
+    [[nodiscard]] std::uint32_t GetApiVersion() const noexcept
+    {
+        return m_Info->GetProperties().apiVersion;
+    }
+
+    [[nodiscard]] std::uint64_t GetDeviceLocalMemorySize() const noexcept
+    {
+        const auto & memoryProperties = m_Info->GetMemoryProperties();
+
+        auto size = std::uint64_t(0);
+        for (auto heapIndex = 0u; heapIndex < memoryProperties.memoryHeapCount; ++heapIndex)
+        {
+            const auto & heap = memoryProperties.memoryHeaps[heapIndex];
+            if (heap.flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT)
+            {
+                size = std::max<std::uint64_t>(size, heap.size);
+            }
+        }
+
+        return size;
+    }
+
+    [[nodiscard]] bool HasExtension(std::string_view name) const noexcept
+    {
+        return m_Info->HasExtension(name);
+    }
+
+    [[nodiscard]] bool HasTimelineSemaphoreSupport() const noexcept
+    {
+        return m_Info->GetVulkan12Features().timelineSemaphore == VK_TRUE;
+    }
+
+    [[nodiscard]] bool HasSynchronization2Support() const noexcept
+    {
+        return m_Info->GetVulkan13Features().synchronization2 == VK_TRUE;
+    }
+
+    [[nodiscard]] bool HasPipelineStatisticsSupport() const noexcept
+    {
+        return m_Info->GetFeatures().pipelineStatisticsQuery == VK_TRUE;
+    }
+
+    [[nodiscard]] const VkPhysicalDeviceProperties & GetProperties() const noexcept
+    {
+        return m_Info->GetProperties();
+    }
+
+    [[nodiscard]] const PhysicalDeviceInfo & GetInfo() const noexcept
+    {
+        return *m_Info;
+    }
+
+    [[nodiscard]] const std::shared_ptr<const PhysicalDeviceInfo> & GetSharedInfo() const noexcept
+    {
+        return m_Info;
     }
 
     [[nodiscard]] VkPhysicalDevice GetHandle() const noexcept
     {
-        return m_Handle;
+        return m_Info->GetHandle();
     }
 
 private:
-    VkPhysicalDevice m_Handle;
+    std::shared_ptr<const PhysicalDeviceInfo> m_Info;
 };
 } // namespace CuEngine::Vulkan::Impl
@@ -0,0 +1,252 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include "LoaderImpl.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace CuEngine::Vulkan::Impl
+{
+// Everything the engine asks a physical device, queried once at enumeration and shared by every copy of it
+class PhysicalDeviceInfo
+{
+    struct StringHash
+    {
+        using is_transparent = void;
+
+        [[nodiscard]] std::size_t operator()(std::string_view value) const noexcept
+        {
+            return std::hash<std::string_view>()(value);
+        }
+    };
+
+public:
+    explicit PhysicalDeviceInfo(VkPhysicalDevice handle)
+        : m_Handle(handle), m_Properties(), m_Vulkan11Properties(), m_Vulkan12Properties(), m_Features(),
+          m_Vulkan12Features(), m_Vulkan13Features(), m_MemoryProperties(), m_QueueFamilies(), m_Extensions(),
+          m_SurfaceSupportMutex(), m_SurfaceSupport()
+    {
+        QueryProperties();
+        QueryFeatures();
+        QueryQueueFamilies();
+        QueryExtensions();
+        vkGetPhysicalDeviceMemoryProperties(m_Handle, &m_MemoryProperties);
+    }
+
+    PhysicalDeviceInfo(const PhysicalDeviceInfo & other) = delete;
+
+    PhysicalDeviceInfo(PhysicalDeviceInfo && other) noexcept = delete;
+
+    PhysicalDeviceInfo & operator=(const PhysicalDeviceInfo & other) = delete;
+
+    PhysicalDeviceInfo & operator=(PhysicalDeviceInfo && other) noexcept = delete;
+
+    ~PhysicalDeviceInfo() noexcept = default;
+
+    [[nodiscard]] VkPhysicalDevice GetHandle() const noexcept
+    {
+        return m_Handle;
+    }
+
+    [[nodiscard]] const VkPhysicalDeviceProperties & GetProperties() const noexcept
+    {
+        return m_Properties;
+    }
+
+    [[nodiscard]] const VkPhysicalDeviceLimits & GetLimits() const noexcept
+    {
+        return m_Properties.limits;
+    }
+
+    // The chained structures are zeroed on devices below the version that introduced them
+    [[nodiscard]] const VkPhysicalDeviceVulkan11Properties & GetVulkan11Properties() const noexcept
+    {
+        return m_Vulkan11Properties;
+    }
+
+    [[nodiscard]] const VkPhysicalDeviceVulkan12Properties & GetVulkan12Properties() const noexcept
+    {
+        return m_Vulkan12Properties;
+    }
+
+    [[nodiscard]] const VkPhysicalDeviceFeatures & GetFeatures() const noexcept
+    {
+        return m_Features;
+    }
+
+    [[nodiscard]] const VkPhysicalDeviceVulkan12Features & GetVulkan12Features() const noexcept
+    {
+        return m_Vulkan12Features;
+    }
+
+    [[nodiscard]] const VkPhysicalDeviceVulkan13Features & GetVulkan13Features() const noexcept
+    {
+        return m_Vulkan13Features;
+    }
+
+    [[nodiscard]] const VkPhysicalDeviceMemoryProperties & GetMemoryProperties() const noexcept
+    {
+        return m_MemoryProperties;
+    }
+
+    [[nodiscard]] const std::vector<VkQueueFamilyProperties> & GetQueueFamilies() const noexcept
+    {
+        return m_QueueFamilies;
+    }
+
+    [[nodiscard]] bool HasExtension(std::string_view name) const noexcept
+    {
+        return m_Extensions.contains(name);
+    }
+
+    // Surfaces are not known at enumeration, so their support is queried on first use and remembered
+    [[nodiscard]] bool HasSurfaceSupport(std::uint32_t queueFamilyIndex, VkSurfaceKHR surface) const
+    {
+        auto lock = std::scoped_lock(m_SurfaceSupportMutex);
+
+        auto key = std::pair(surface, queueFamilyIndex);
+        if (auto it = m_SurfaceSupport.find(key); it != std::end(m_SurfaceSupport))
+        {
+            return it->second;
+        }
+
+        auto isCapable = VkBool32(VK_FALSE);
+        if (vkGetPhysicalDeviceSurfaceSupportKHR(m_Handle, queueFamilyIndex, surface, &isCapable) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to check Surface support");
+        }
+
+        return m_SurfaceSupport[key] = isCapable == VK_TRUE;
+    }
+
+    [[nodiscard]] static std::shared_ptr<const PhysicalDeviceInfo> Create(VkPhysicalDevice handle)
+    {
+        return std::make_shared<const PhysicalDeviceInfo>(handle);
+    }
+
+private:
+    void QueryProperties()
+    {
+        vkGetPhysicalDeviceProperties(m_Handle, &m_Properties);
+
+        m_Vulkan11Properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_PROPERTIES;
+        m_Vulkan12Properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES;
+        if (m_Properties.apiVersion < VK_API_VERSION_1_2)
+        {
+            return;
+        }
+
+        auto properties  = VkPhysicalDeviceProperties2();
+        properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+        properties.pNext = &m_Vulkan11Properties;
+
+        m_Vulkan11Properties.pNext = &m_Vulkan12Properties;
+        vkGetPhysicalDeviceProperties2(m_Handle, &properties);
+
+        // The chain points into this object, so it is cut before anyone can copy the structures out
+        m_Vulkan11Properties.pNext = nullptr;
+        m_Vulkan12Properties.pNext = nullptr;
+    }
+
+    void QueryFeatures()
+    {
+        m_Vulkan12Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+        m_Vulkan13Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES;
+        if (m_Properties.apiVersion < VK_API_VERSION_1_2)
+        {
+            vkGetPhysicalDeviceFeatures(m_Handle, &m_Features);
+            return;
+        }
+
+        auto features  = VkPhysicalDeviceFeatures2();
+        features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        features.pNext = &m_Vulkan12Features;
+        if (m_Properties.apiVersion >= VK_API_VERSION_1_3)
+        {
+            m_Vulkan12Features.pNext = &m_Vulkan13Features;
+        }
+        vkGetPhysicalDeviceFeatures2(m_Handle, &features);
+
+        m_Features               = features.features;
+        m_Vulkan12Features.pNext = nullptr;
+        m_Vulkan13Features.pNext = nullptr;
+    }
+
+    void QueryQueueFamilies()
+    {
+        auto count = std::uint32_t();
+        vkGetPhysicalDeviceQueueFamilyProperties(m_Handle, &count, nullptr);
+
+        m_QueueFamilies.resize(count);
+        vkGetPhysicalDeviceQueueFamilyProperties(m_Handle, &count, m_QueueFamilies.data());
+    }
+
+    void QueryExtensions()
+    {
+        auto count = std::uint32_t();
+        if (vkEnumerateDeviceExtensionProperties(m_Handle, nullptr, &count, nullptr) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to get supported Vulkan Device extensions");
+        }
+
+        auto properties = std::vector<VkExtensionProperties>(count);
+        if (vkEnumerateDeviceExtensionProperties(m_Handle, nullptr, &count, properties.data()) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to get supported Vulkan Device extensions");
+        }
+
+        m_Extensions.reserve(count);
+        for (auto && property : properties)
+        {
+            m_Extensions.emplace(property.extensionName);
+        }
+    }
+
+private:
+    VkPhysicalDevice                                               m_Handle;
+    VkPhysicalDeviceProperties                                     m_Properties;
+    VkPhysicalDeviceVulkan11Properties                             m_Vulkan11Properties;
+    VkPhysicalDeviceVulkan12Properties                             m_Vulkan12Properties;
+    VkPhysicalDeviceFeatures                                       m_Features;
+    VkPhysicalDeviceVulkan12Features                               m_Vulkan12Features;
+    VkPhysicalDeviceVulkan13Features                               m_Vulkan13Features;
+    VkPhysicalDeviceMemoryProperties                               m_MemoryProperties;
+    std::vector<VkQueueFamilyProperties>                           m_QueueFamilies;
+    std::unordered_set<std::string, StringHash, std::equal_to<>>   m_Extensions;
+    mutable std::mutex                                             m_SurfaceSupportMutex;
+    mutable std::map<std::pair<VkSurfaceKHR, std::uint32_t>, bool> m_SurfaceSupport;
+};
+} // namespace CuEngine::Vulkan::Impl
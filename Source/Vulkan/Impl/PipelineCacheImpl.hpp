@@ -0,0 +1,378 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include "HostAllocatorImpl.hpp"
+#include "LoaderImpl.hpp"
+#include "PhysicalDeviceInfoImpl.hpp"
+
+#include <CuEngine/Vulkan/PipelineCache.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace CuEngine::Vulkan::Impl
+{
+class PipelineCache
+{
+    // Prepended to the driver blob, the driver header alone does not carry the driver version
+    struct FileHeader
+    {
+        std::uint32_t magic;
+        std::uint32_t version;
+        std::uint32_t vendorID;
+        std::uint32_t deviceID;
+        std::uint32_t driverVersion;
+        std::uint8_t  pipelineCacheUUID[VK_UUID_SIZE];
+        std::uint32_t reserved;
+        std::uint64_t dataSize;
+        std::uint64_t dataHash;
+    };
+
+    struct State
+    {
+        std::filesystem::path        path;
+        FileHeader                   identity;
+        std::mutex                   mutex;
+        std::vector<VkPipelineCache> workerCaches;
+        bool                         hasCreationFeedback;
+        std::atomic<std::uint64_t>   hits;
+        std::atomic<std::uint64_t>   misses;
+        std::size_t                  loadedSize;
+        std::size_t                  savedSize;
+    };
+
+    static constexpr auto fileMagic   = std::uint32_t(0x43504355); // "UCPC"
+    static constexpr auto fileVersion = std::uint32_t(1);
+
+public:
+    explicit PipelineCache(VkDevice device, VkPipelineCache pipelineCache, std::unique_ptr<State> state) noexcept
+        : m_Device(device), m_Handle(pipelineCache), m_State(std::move(state))
+    {}
+
+    PipelineCache(const PipelineCache & other) = delete;
+
+    PipelineCache(PipelineCache && other) noexcept
+        : m_Device(std::exchange(other.m_Device, VK_NULL_HANDLE)),
+          m_Handle(std::exchange(other.m_Handle, VK_NULL_HANDLE)), m_State(std::move(other.m_State))
+    {}
+
+    PipelineCache & operator=(const PipelineCache & other) = delete;
+
+    PipelineCache & operator=(PipelineCache && other) noexcept
+    {
+        if (this != &other)
+        {
+            std::swap(m_Device, other.m_Device);
+            std::swap(m_Handle, other.m_Handle);
+            std::swap(m_State, other.m_State);
+        }
+
+        return *this;
+    }
+
+    ~PipelineCache() noexcept
+    {
+        Release();
+    }
+
+    // Has to be called before the owning device is destroyed
+    void Release() noexcept
+    {
+        if (!m_Handle)
+        {
+            return;
+        }
+
+        try
+        {
+            Save();
+        }
+        catch (const std::exception &)
+        {
+            // Losing the cache only costs a cold start on the next run
+        }
+
+        for (auto && workerCache : m_State->workerCaches)
+        {
+            vkDestroyPipelineCache(m_Device, workerCache, HostAllocator::GetCallbacks());
+        }
+        m_State->workerCaches.clear();
+
+        vkDestroyPipelineCache(m_Device, std::exchange(m_Handle, VK_NULL_HANDLE), HostAllocator::GetCallbacks());
+    }
+
+    // Worker threads compile into private caches to avoid contending on the internal lock of the main one
+    [[nodiscard]] VkPipelineCache CreateWorkerCache()
+    {
+        auto cacheInfo = VkPipelineCacheCreateInfo{ .sType           = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+                                                    .pNext           = nullptr,
+                                                    .flags           = {},
+                                                    .initialDataSize = 0,
+                                                    .pInitialData    = nullptr };
+
+        auto workerCache = VkPipelineCache(VK_NULL_HANDLE);
+        if (vkCreatePipelineCache(m_Device, &cacheInfo, HostAllocator::GetCallbacks(), &workerCache) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create a worker pipeline cache");
+        }
+
+        auto lock = std::scoped_lock(m_State->mutex);
+        m_State->workerCaches.push_back(workerCache);
+
+        return workerCache;
+    }
+
+    // Worker caches stay alive and keep their contents, so merging again later only adds what is new
+    void MergeWorkerCaches()
+    {
+        auto lock = std::scoped_lock(m_State->mutex);
+        if (m_State->workerCaches.empty())
+        {
+            return;
+        }
+
+        if (vkMergePipelineCaches(m_Device, m_Handle, static_cast<std::uint32_t>(m_State->workerCaches.size()),
+                                  m_State->workerCaches.data())
+            != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to merge worker pipeline caches");
+        }
+    }
+
+    // Whether pipelines may chain VkPipelineCreationFeedbackCreateInfo, core since 1.3 and an extension before
+    [[nodiscard]] bool HasCreationFeedback() const noexcept
+    {
+        return m_State->hasCreationFeedback;
+    }
+
+    // Chained into a pipeline create info, the feedback is handed to RecordFeedback once the pipeline exists
+    [[nodiscard]] static VkPipelineCreationFeedbackCreateInfo GetCreationFeedbackInfo(
+        VkPipelineCreationFeedback & feedback, const void * next = nullptr) noexcept
+    {
+        feedback = VkPipelineCreationFeedback{ .flags = 0, .duration = 0 };
+
+        return VkPipelineCreationFeedbackCreateInfo{ .sType = VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO,
+                                                     .pNext = next,
+                                                     .pPipelineCreationFeedback          = &feedback,
+                                                     .pipelineStageCreationFeedbackCount = 0,
+                                                     .pPipelineStageCreationFeedbacks    = nullptr };
+    }
+
+    void RecordFeedback(const VkPipelineCreationFeedback & feedback) noexcept
+    {
+        if ((feedback.flags & VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT) == 0)
+        {
+            return;
+        }
+
+        if (feedback.flags & VK_PIPELINE_CREATION_FEEDBACK_APPLICATION_PIPELINE_CACHE_HIT_BIT)
+        {
+            m_State->hits.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+            m_State->misses.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void Save()
+    {
+        MergeWorkerCaches();
+
+        if (m_State->path.empty())
+        {
+            return;
+        }
+
+        auto size = std::size_t();
+        if (vkGetPipelineCacheData(m_Device, m_Handle, &size, nullptr) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to get pipeline cache data");
+        }
+
+        auto data = std::vector<char>(size);
+        if (vkGetPipelineCacheData(m_Device, m_Handle, &size, data.data()) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to get pipeline cache data");
+        }
+        data.resize(size);
+
+        auto header     = m_State->identity;
+        header.dataSize = size;
+        header.dataHash = Hash(data);
+
+        if (m_State->path.has_parent_path())
+        {
+            std::filesystem::create_directories(m_State->path.parent_path());
+        }
+
+        // Written next to the target and renamed, so a crash never leaves a truncated cache behind
+        auto temporaryPath = m_State->path;
+        temporaryPath += ".tmp";
+        {
+            auto file = std::ofstream(temporaryPath, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+            file.write(data.data(), static_cast<std::streamsize>(data.size()));
+            if (!file)
+            {
+                throw std::runtime_error("Failed to write the pipeline cache");
+            }
+        }
+        std::filesystem::rename(temporaryPath, m_State->path);
+
+        m_State->savedSize = size;
+    }
+
+    [[nodiscard]] PipelineCacheStatistics GetStatistics() const noexcept
+    {
+        return PipelineCacheStatistics{ .hits       = m_State->hits.load(std::memory_order_relaxed),
+                                         .misses     = m_State->misses.load(std::memory_order_relaxed),
+                                         .loadedSize = m_State->loadedSize,
+                                         .savedSize  = m_State->savedSize };
+    }
+
+    [[nodiscard]] VkPipelineCache GetHandle() const noexcept
+    {
+        return m_Handle;
+    }
+
+    [[nodiscard]] static PipelineCache Create(VkDevice device, const PhysicalDeviceInfo & physicalDevice,
+                                              const std::filesystem::path & path, bool hasCreationFeedback)
+    {
+        const auto & properties = physicalDevice.GetProperties();
+
+        auto state                 = std::make_unique<State>();
+        state->path                = path;
+        state->hasCreationFeedback = hasCreationFeedback;
+        state->identity = FileHeader{ .magic             = fileMagic,
+                                      .version           = fileVersion,
+                                      .vendorID          = properties.vendorID,
+                                      .deviceID          = properties.deviceID,
+                                      .driverVersion     = properties.driverVersion,
+                                      .pipelineCacheUUID = {},
+                                      .reserved          = 0,
+                                      .dataSize          = 0,
+                                      .dataHash          = 0 };
+        std::ranges::copy(properties.pipelineCacheUUID, state->identity.pipelineCacheUUID);
+
+        auto initialData = path.empty() ? std::vector<char>() : Load(path, state->identity);
+        auto cacheInfo   = VkPipelineCacheCreateInfo{ .sType           = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+                                                      .pNext           = nullptr,
+                                                      .flags           = {},
+                                                      .initialDataSize = initialData.size(),
+                                                      .pInitialData    = initialData.data() };
+
+        auto pipelineCache = VkPipelineCache(VK_NULL_HANDLE);
+        if (vkCreatePipelineCache(device, &cacheInfo, HostAllocator::GetCallbacks(), &pipelineCache) != VK_SUCCESS)
+        {
+            initialData.clear();
+            cacheInfo.initialDataSize = 0;
+            cacheInfo.pInitialData    = nullptr;
+            if (vkCreatePipelineCache(device, &cacheInfo, HostAllocator::GetCallbacks(), &pipelineCache) != VK_SUCCESS)
+            {
+                throw std::runtime_error("Failed to create a pipeline cache");
+            }
+        }
+        state->loadedSize = initialData.size();
+
+        return PipelineCache(device, pipelineCache, std::move(state));
+    }
+
+private:
+    // Returns an empty blob for anything that was not produced by this very device and driver
+    [[nodiscard]] static std::vector<char> Load(const std::filesystem::path & path, const FileHeader & identity)
+    {
+        auto file = std::ifstream(path, std::ios::binary);
+        if (!file)
+        {
+            return {};
+        }
+
+        auto content = std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        if (content.size() < sizeof(FileHeader))
+        {
+            return {};
+        }
+
+        auto header = FileHeader();
+        std::memcpy(&header, content.data(), sizeof(header));
+
+        auto data = std::vector<char>(content.begin() + sizeof(FileHeader), content.end());
+        if (header.magic != identity.magic || header.version != identity.version
+            || header.vendorID != identity.vendorID || header.deviceID != identity.deviceID
+            || header.driverVersion != identity.driverVersion
+            || !std::ranges::equal(header.pipelineCacheUUID, identity.pipelineCacheUUID)
+            || header.dataSize != data.size() || header.dataHash != Hash(data))
+        {
+            return {};
+        }
+
+        // Some drivers crash on foreign data instead of ignoring it, so their own header is checked as well
+        auto driverHeader = VkPipelineCacheHeaderVersionOne();
+        if (data.size() < sizeof(driverHeader))
+        {
+            return {};
+        }
+        std::memcpy(&driverHeader, data.data(), sizeof(driverHeader));
+
+        if (driverHeader.headerVersion != VK_PIPELINE_CACHE_HEADER_VERSION_ONE
+            || driverHeader.vendorID != identity.vendorID || driverHeader.deviceID != identity.deviceID
+            || !std::ranges::equal(driverHeader.pipelineCacheUUID, identity.pipelineCacheUUID))
+        {
+            return {};
+        }
+
+        return data;
+    }
+
+    [[nodiscard]] static std::uint64_t Hash(const std::vector<char> & data) noexcept
+    {
+        // FNV-1a
+        auto hash = std::uint64_t(14695981039346656037ull);
+        for (auto byte : data)
+        {
+            hash ^= static_cast<std::uint8_t>(byte);
+            hash *= 1099511628211ull;
+        }
+
+        return hash;
+    }
+
+private:
+    VkDevice               m_Device;
+    VkPipelineCache        m_Handle;
+    std::unique_ptr<State> m_State;
+};
+} // namespace CuEngine::Vulkan::Impl
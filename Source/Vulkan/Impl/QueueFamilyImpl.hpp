@@ -24,18 +24,20 @@
 
 #include <vulkan/vulkan.h>
 
-#include "PhysicalDeviceImpl.hpp"
+#include "PhysicalDeviceInfoImpl.hpp"
 #include "SurfaceImpl.hpp"
 
 #include <CuEngine/Vulkan/QueueFamily.hpp>
 
+#include <memory>
+
 namespace CuEngine::Vulkan::Impl
 {
 class QueueFamily
 {
 public:
-    explicit QueueFamily(VkPhysicalDevice device, const VkQueueFlags & flags, std::uint32_t index) noexcept
-        : m_Device(device), m_Flags(flags), m_Index(index)
+    explicit QueueFamily(std::shared_ptr<const PhysicalDeviceInfo> info, std::uint32_t index) noexcept
+        : m_Info(std::move(info)), m_Flags(m_Info->GetQueueFamilies()[index].queueFlags), m_Index(index)
     {}
 
     [[nodiscard]] bool HasGraphicsSupport() const noexcept
@@ -43,18 +45,40 @@ public:
         return m_Flags & VK_QUEUE_GRAPHICS_BIT;
     }
 
+    // Graphics and compute queues support transfers implicitly
+    [[nodiscard]] bool HasTransferSupport() const noexcept
+    {
+        return m_Flags & (VK_QUEUE_TRANSFER_BIT | VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT);
+    }
+
+    [[nodiscard]] bool HasComputeSupport() const noexcept
+    {
+        return m_Flags & VK_QUEUE_COMPUTE_BIT;
+    }
+
+    // Usually backed by the copy engines, which run independently of graphics work
+    [[nodiscard]] bool IsTransferOnly() const noexcept
+    {
+        return (m_Flags & VK_QUEUE_TRANSFER_BIT) && !(m_Flags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT));
+    }
+
+    // Async compute, work submitted here can overlap with the graphics queue
+    [[nodiscard]] bool IsComputeOnly() const noexcept
+    {
+        return (m_Flags & VK_QUEUE_COMPUTE_BIT) && !(m_Flags & VK_QUEUE_GRAPHICS_BIT);
+    }
+
     [[nodiscard]] bool HasSurfaceSupport(Surface & surface) const
     {
-        auto isCapable = VkBool32(VK_FALSE);
-        if (vkGetPhysicalDeviceSurfaceSupportKHR(m_Device, m_Index, surface.GetHandle(), &isCapable) != VK_SUCCESS)
-        {
-            throw std::runtime_error("Failed to check Surface support");
-        }
+        return m_Info->HasSurfaceSupport(m_Index, surface.GetHandle());
+    }
 
-        return isCapable == VK_TRUE;
+    [[nodiscard]] const VkQueueFamilyProperties & GetProperties() const noexcept
+    {
+        return m_Info->GetQueueFamilies()[m_Index];
     }
 
-    [[nodiscard]] bool GetIndex() const noexcept
+    [[nodiscard]] std::uint32_t GetIndex() const noexcept
     {
         return m_Index;
     }
@@ -65,8 +89,8 @@ public:
     }
 
 private:
-    VkPhysicalDevice m_Device;
-    VkQueueFlags     m_Flags;
-    std::uint32_t    m_Index;
+    std::shared_ptr<const PhysicalDeviceInfo> m_Info;
+    VkQueueFlags                              m_Flags;
+    std::uint32_t                             m_Index;
 };
 } // namespace CuEngine::Vulkan::Impl
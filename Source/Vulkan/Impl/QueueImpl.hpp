@@ -25,12 +25,51 @@
 #include <vulkan/vulkan.h>
 
 #include "DeviceImpl.hpp"
+#include "LoaderImpl.hpp"
 #include "QueueFamilyImpl.hpp"
+#include "TimelineSemaphoreImpl.hpp"
 
 #include <CuEngine/Vulkan/Queue.hpp>
+#include <CuEngine/Vulkan/Synchronization.hpp>
+#include <CuEngine/Vulkan/TimelineSemaphore.hpp>
+
+#include <stdexcept>
+#include <vector>
 
 namespace CuEngine::Vulkan::Impl
 {
+// The public API only creates timeline waits, the swapchain appends its binary semaphores with ignored values
+struct QueueSubmission
+{
+    std::vector<VkCommandBuffer>      commandBuffers;
+    std::vector<VkSemaphore>          waitSemaphores;
+    std::vector<std::uint64_t>        waitValues;
+    std::vector<VkPipelineStageFlags> waitStages;
+    std::vector<VkSemaphore>          signalSemaphores;
+    std::vector<std::uint64_t>        signalValues;
+    bool                              hasTimelineSemaphores;
+
+    [[nodiscard]] static QueueSubmission Create(const std::vector<TimelineWait> &   waits,
+                                                const std::vector<TimelineSignal> & signals)
+    {
+        auto submission                  = QueueSubmission();
+        submission.hasTimelineSemaphores = !waits.empty() || !signals.empty();
+        for (auto && wait : waits)
+        {
+            submission.waitSemaphores.push_back(wait.semaphore->GetImpl().GetHandle());
+            submission.waitValues.push_back(wait.value);
+            submission.waitStages.push_back(static_cast<VkPipelineStageFlags>(wait.stage));
+        }
+        for (auto && signal : signals)
+        {
+            submission.signalSemaphores.push_back(signal.semaphore->GetImpl().GetHandle());
+            submission.signalValues.push_back(signal.value);
+        }
+
+        return submission;
+    }
+};
+
 class Queue
 {
 public:
@@ -55,6 +94,46 @@ public:
         return Queue(queue);
     }
 
+    void Submit(const QueueSubmission & submission, VkFence fence = VK_NULL_HANDLE)
+    {
+        auto timelineInfo = VkTimelineSemaphoreSubmitInfo{
+            .sType                     = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
+            .pNext                     = nullptr,
+            .waitSemaphoreValueCount   = static_cast<std::uint32_t>(submission.waitValues.size()),
+            .pWaitSemaphoreValues      = submission.waitValues.data(),
+            .signalSemaphoreValueCount = static_cast<std::uint32_t>(submission.signalValues.size()),
+            .pSignalSemaphoreValues    = submission.signalValues.data(),
+        };
+
+        auto submitInfo = VkSubmitInfo{
+            .sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+            .pNext                = submission.hasTimelineSemaphores ? &timelineInfo : nullptr,
+            .waitSemaphoreCount   = static_cast<std::uint32_t>(submission.waitSemaphores.size()),
+            .pWaitSemaphores      = submission.waitSemaphores.data(),
+            .pWaitDstStageMask    = submission.waitStages.data(),
+            .commandBufferCount   = static_cast<std::uint32_t>(submission.commandBuffers.size()),
+            .pCommandBuffers      = submission.commandBuffers.data(),
+            .signalSemaphoreCount = static_cast<std::uint32_t>(submission.signalSemaphores.size()),
+            .pSignalSemaphores    = submission.signalSemaphores.data(),
+        };
+
+        if (vkQueueSubmit(m_Handle, 1, &submitInfo, fence) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to submit to a queue");
+        }
+    }
+
+    // An empty batch only signals the fence, used to restore one that was reset for a submission that failed
+    void SignalFence(VkFence fence) noexcept
+    {
+        static_cast<void>(vkQueueSubmit(m_Handle, 0, nullptr, fence));
+    }
+
+    [[nodiscard]] VkQueue GetHandle() const noexcept
+    {
+        return m_Handle;
+    }
+
 private:
     VkQueue m_Handle;
 };
@@ -0,0 +1,675 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include "DeviceImpl.hpp"
+#include "ImageBuilderImpl.hpp"
+#include "ImageImpl.hpp"
+#include "HostAllocatorImpl.hpp"
+#include "LoaderImpl.hpp"
+#include "MemoryAllocatorImpl.hpp"
+#include "RenderGraphImpl.hpp"
+
+#include <CuEngine/Vulkan/RenderGraphBuilder.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+namespace CuEngine::Vulkan::Impl
+{
+class RenderGraphBuilder
+{
+    struct ImageResource
+    {
+        const Vulkan::Image * image;
+        VkFormat              format;
+        VkExtent2D            extent;
+        ImageAccess           initialAccess;
+        ImageAccess           finalAccess;
+    };
+
+    struct BufferResource
+    {
+        const Vulkan::Buffer * buffer;
+        BufferAccess           initialAccess;
+    };
+
+    // Reads after the last write accumulate, so repeated reads in the same stages need no further barriers
+    struct ResourceState
+    {
+        VkPipelineStageFlags2 writeStages;
+        VkAccessFlags2        writeAccess;
+        VkPipelineStageFlags2 readStages;
+        VkAccessFlags2        readAccess;
+        VkImageLayout         layout;
+    };
+
+    struct Dependency
+    {
+        VkPipelineStageFlags2 sourceStages;
+        VkAccessFlags2        sourceAccess;
+        VkImageLayout         oldLayout;
+    };
+
+    struct TransientImage
+    {
+        std::uint32_t        resource;
+        std::uint32_t        firstPass;
+        std::uint32_t        lastPass;
+        VkImageUsageFlags    usage;
+        VkImage              handle;
+        VkMemoryRequirements requirements;
+        std::uint32_t        memory;
+        VkDeviceSize         offset;
+    };
+
+    struct TransientMemory
+    {
+        std::uint32_t memoryTypeBits;
+        VkDeviceSize  size;
+        VkDeviceSize  alignment;
+    };
+
+    // The first barrier of an aliased image has to wait for whoever used the memory before it
+    struct AliasBarrier
+    {
+        std::uint32_t pass;
+        std::uint32_t barrier;
+        std::uint32_t transientImage;
+    };
+
+    static constexpr auto noTransientImage = std::numeric_limits<std::uint32_t>::max();
+
+public:
+    explicit RenderGraphBuilder() noexcept : m_Device(nullptr), m_Images(), m_Buffers(), m_Passes()
+    {}
+
+    RenderGraphBuilder(const RenderGraphBuilder & other) = default;
+
+    RenderGraphBuilder(RenderGraphBuilder && other) noexcept = default;
+
+    RenderGraphBuilder & operator=(const RenderGraphBuilder & other) = default;
+
+    RenderGraphBuilder & operator=(RenderGraphBuilder && other) noexcept = default;
+
+    ~RenderGraphBuilder() noexcept = default;
+
+    RenderGraphBuilder & SetDevice(Device & device) noexcept
+    {
+        m_Device = &device;
+
+        return *this;
+    }
+
+    [[nodiscard]] ImageHandle CreateImage(const ImageDescription & description)
+    {
+        m_Images.push_back(ImageResource{ .image         = nullptr,
+                                          .format        = static_cast<VkFormat>(description.format),
+                                          .extent        = { description.width, description.height },
+                                          .initialAccess = ImageAccess::None,
+                                          .finalAccess   = ImageAccess::None });
+
+        return ImageHandle{ .index = static_cast<std::uint32_t>(m_Images.size() - 1) };
+    }
+
+    [[nodiscard]] ImageHandle ImportImage(const Vulkan::Image & image, ImageAccess initialAccess,
+                                          ImageAccess finalAccess)
+    {
+        m_Images.push_back(ImageResource{ .image         = &image,
+                                          .format        = image.GetImpl().GetFormat(),
+                                          .extent        = image.GetImpl().GetExtent(),
+                                          .initialAccess = initialAccess,
+                                          .finalAccess   = finalAccess });
+
+        return ImageHandle{ .index = static_cast<std::uint32_t>(m_Images.size() - 1) };
+    }
+
+    [[nodiscard]] BufferHandle ImportBuffer(const Vulkan::Buffer & buffer, BufferAccess initialAccess)
+    {
+        m_Buffers.push_back(BufferResource{ .buffer = &buffer, .initialAccess = initialAccess });
+
+        return BufferHandle{ .index = static_cast<std::uint32_t>(m_Buffers.size() - 1) };
+    }
+
+    RenderGraphBuilder & AddPass(const RenderPassDescription & pass)
+    {
+        m_Passes.push_back(pass);
+
+        return *this;
+    }
+
+    [[nodiscard]] RenderGraph Build() const
+    {
+        if (m_Device == nullptr)
+        {
+            throw std::runtime_error("Failed to build a render graph: device has to be set");
+        }
+        Validate();
+
+        auto livePasses      = CullPasses();
+        auto transientIndex  = std::vector<std::uint32_t>(m_Images.size(), noTransientImage);
+        auto transientImages = CollectTransientImages(livePasses, transientIndex);
+
+        auto state                 = std::make_unique<RenderGraph::State>();
+        state->device              = m_Device->GetHandle();
+        state->hasSynchronization2 = m_Device->HasSynchronization2();
+        state->images.resize(m_Images.size());
+        state->buffers.resize(m_Buffers.size());
+        state->statistics.passCount       = static_cast<std::uint32_t>(m_Passes.size());
+        state->statistics.culledPassCount = static_cast<std::uint32_t>(m_Passes.size() - livePasses.size());
+
+        for (auto index = 0u; index < m_Images.size(); ++index)
+        {
+            state->images[index] = m_Images[index].image;
+        }
+        for (auto index = 0u; index < m_Buffers.size(); ++index)
+        {
+            state->buffers[index] = m_Buffers[index].buffer;
+        }
+
+        try
+        {
+            auto transientMemory = PlaceTransientImages(transientImages);
+            CreateTransientImages(*state, transientImages, transientMemory);
+            BuildBarriers(*state, livePasses, transientIndex, transientImages);
+        }
+        catch (...)
+        {
+            for (auto && transientImage : transientImages)
+            {
+                vkDestroyImage(state->device, transientImage.handle, HostAllocator::GetCallbacks());
+            }
+            state->transientImages.clear();
+            for (auto && allocation : state->transientMemory)
+            {
+                MemoryAllocator::Free(allocation);
+            }
+            throw;
+        }
+
+        return RenderGraph(std::move(state));
+    }
+
+private:
+    void Validate() const
+    {
+        for (auto && pass : m_Passes)
+        {
+            for (auto && use : pass.images)
+            {
+                if (use.image.index >= m_Images.size())
+                {
+                    throw std::runtime_error("Failed to build a render graph: unknown image in pass " + pass.name);
+                }
+                if (m_Images[use.image.index].image == nullptr && use.access == ImageAccess::Present)
+                {
+                    throw std::runtime_error("Failed to build a render graph: transient image presented in pass "
+                                             + pass.name);
+                }
+            }
+
+            for (auto && use : pass.buffers)
+            {
+                if (use.buffer.index >= m_Buffers.size())
+                {
+                    throw std::runtime_error("Failed to build a render graph: unknown buffer in pass " + pass.name);
+                }
+            }
+        }
+    }
+
+    // Walks the passes backwards, a pass survives when it writes something that is read later or leaves the graph
+    [[nodiscard]] std::vector<std::uint32_t> CullPasses() const
+    {
+        auto neededImages = std::vector<bool>(m_Images.size());
+        for (auto index = 0u; index < m_Images.size(); ++index)
+        {
+            neededImages[index] = m_Images[index].image != nullptr;
+        }
+
+        auto livePasses = std::vector<std::uint32_t>();
+        for (auto index = m_Passes.size(); index-- > 0;)
+        {
+            const auto & pass = m_Passes[index];
+
+            auto writesNeededImage = std::ranges::any_of(pass.images,
+                                                         [&neededImages](const auto & use)
+                                                         {
+                                                             return RenderGraph::GetAccessInfo(use.access).isWrite
+                                                                    && neededImages[use.image.index];
+                                                         });
+
+            auto writesBuffer = std::ranges::any_of(pass.buffers,
+                                                    [](const auto & use)
+                                                    {
+                                                        return RenderGraph::GetAccessInfo(use.access).isWrite;
+                                                    });
+            if (!pass.hasSideEffects && !writesNeededImage && !writesBuffer)
+            {
+                continue;
+            }
+
+            for (auto && use : pass.images)
+            {
+                neededImages[use.image.index] = true;
+            }
+            livePasses.push_back(static_cast<std::uint32_t>(index));
+        }
+        std::ranges::reverse(livePasses);
+
+        return livePasses;
+    }
+
+    [[nodiscard]] std::vector<TransientImage> CollectTransientImages(const std::vector<std::uint32_t> & livePasses,
+                                                                     std::vector<std::uint32_t> & transientIndex) const
+    {
+        auto transientImages = std::vector<TransientImage>();
+        for (auto pass = 0u; pass < livePasses.size(); ++pass)
+        {
+            for (auto && use : m_Passes[livePasses[pass]].images)
+            {
+                if (m_Images[use.image.index].image != nullptr || use.access == ImageAccess::None)
+                {
+                    continue;
+                }
+
+                auto & index = transientIndex[use.image.index];
+                if (index == noTransientImage)
+                {
+                    index = static_cast<std::uint32_t>(transientImages.size());
+                    transientImages.push_back(TransientImage{ .resource     = use.image.index,
+                                                              .firstPass    = pass,
+                                                              .lastPass     = pass,
+                                                              .usage        = 0,
+                                                              .handle       = VK_NULL_HANDLE,
+                                                              .requirements = {},
+                                                              .memory       = 0,
+                                                              .offset       = 0 });
+                }
+
+                auto & transientImage = transientImages[index];
+                transientImage.lastPass = pass;
+                transientImage.usage |= RenderGraph::GetAccessInfo(use.access).usage;
+            }
+        }
+
+        return transientImages;
+    }
+
+    // Largest images are placed first, each one at the lowest offset not taken by an image whose lifetime overlaps
+    [[nodiscard]] std::vector<TransientMemory> PlaceTransientImages(std::vector<TransientImage> & transientImages) const
+    {
+        auto device = m_Device->GetHandle();
+        for (auto && transientImage : transientImages)
+        {
+            const auto & resource = m_Images[transientImage.resource];
+
+            transientImage.handle =
+                ImageBuilder::CreateHandle(device, resource.format, resource.extent, transientImage.usage);
+            vkGetImageMemoryRequirements(device, transientImage.handle, &transientImage.requirements);
+        }
+
+        auto order = std::vector<std::uint32_t>(transientImages.size());
+        for (auto index = 0u; index < order.size(); ++index)
+        {
+            order[index] = index;
+        }
+        std::ranges::stable_sort(order,
+                                 [&transientImages](auto left, auto right)
+                                 {
+                                     return transientImages[left].requirements.size
+                                            > transientImages[right].requirements.size;
+                                 });
+
+        auto transientMemory = std::vector<TransientMemory>();
+        auto placed          = std::vector<std::uint32_t>();
+        for (auto index : order)
+        {
+            auto & transientImage = transientImages[index];
+            auto & requirements   = transientImage.requirements;
+
+            // Images that can not live in the same memory types never alias
+            auto memoryIt = std::ranges::find_if(transientMemory,
+                                                 [&requirements](const auto & memory)
+                                                 {
+                                                     return memory.memoryTypeBits == requirements.memoryTypeBits;
+                                                 });
+            if (memoryIt == std::end(transientMemory))
+            {
+                transientMemory.push_back(
+                    TransientMemory{ .memoryTypeBits = requirements.memoryTypeBits, .size = 0, .alignment = 1 });
+                memoryIt = std::prev(std::end(transientMemory));
+            }
+            transientImage.memory = static_cast<std::uint32_t>(std::distance(std::begin(transientMemory), memoryIt));
+
+            auto neighbours = std::vector<std::uint32_t>();
+            std::ranges::copy_if(placed, std::back_inserter(neighbours),
+                                 [&transientImages, &transientImage](auto other)
+                                 {
+                                     return transientImages[other].memory == transientImage.memory
+                                            && AreLifetimesOverlapping(transientImages[other], transientImage);
+                                 });
+            std::ranges::sort(neighbours,
+                              [&transientImages](auto left, auto right)
+                              {
+                                  return transientImages[left].offset < transientImages[right].offset;
+                              });
+
+            auto offset = VkDeviceSize(0);
+            for (auto other : neighbours)
+            {
+                const auto & neighbour = transientImages[other];
+                if (offset + requirements.size <= neighbour.offset)
+                {
+                    break;
+                }
+                offset = std::max(offset, AlignUp(neighbour.offset + neighbour.requirements.size,
+                                                  requirements.alignment));
+            }
+
+            transientImage.offset = offset;
+            memoryIt->size        = std::max(memoryIt->size, offset + requirements.size);
+            memoryIt->alignment   = std::max(memoryIt->alignment, requirements.alignment);
+            placed.push_back(index);
+        }
+
+        return transientMemory;
+    }
+
+    void CreateTransientImages(RenderGraph::State & state, std::vector<TransientImage> & transientImages,
+                               const std::vector<TransientMemory> & transientMemory) const
+    {
+        auto & memoryAllocator = m_Device->GetMemoryAllocator().GetImpl();
+        for (auto && memory : transientMemory)
+        {
+            auto requirements = VkMemoryRequirements{ .size           = memory.size,
+                                                      .alignment      = memory.alignment,
+                                                      .memoryTypeBits = memory.memoryTypeBits };
+
+            state.transientMemory.push_back(
+                memoryAllocator.Allocate(requirements, MemoryUsage::GpuOnly, MemoryAllocator::ResourceKind::Optimal));
+            state.statistics.transientMemorySize += memory.size;
+        }
+
+        state.transientImages.reserve(transientImages.size());
+        for (auto && transientImage : transientImages)
+        {
+            const auto & resource   = m_Images[transientImage.resource];
+            const auto & allocation = state.transientMemory[transientImage.memory];
+
+            if (vkBindImageMemory(state.device, transientImage.handle, allocation.memory,
+                                  allocation.offset + transientImage.offset)
+                != VK_SUCCESS)
+            {
+                throw std::runtime_error("Failed to bind transient image memory");
+            }
+
+            auto aspect = Image::GetAspect(resource.format);
+            auto view   = ImageBuilder::CreateView(state.device, transientImage.handle, resource.format, aspect);
+            state.transientImages.emplace_back(Image(state.device, std::exchange(transientImage.handle, VK_NULL_HANDLE),
+                                                     view, MemoryAllocation(), resource.format, resource.extent,
+                                                     aspect));
+
+            state.images[transientImage.resource] = &state.transientImages.back();
+            state.statistics.unaliasedMemorySize += transientImage.requirements.size;
+        }
+    }
+
+    void BuildBarriers(RenderGraph::State & state, const std::vector<std::uint32_t> & livePasses,
+                       const std::vector<std::uint32_t> & transientIndex,
+                       const std::vector<TransientImage> & transientImages) const
+    {
+        auto imageStates = std::vector<ResourceState>(m_Images.size());
+        for (auto index = 0u; index < m_Images.size(); ++index)
+        {
+            imageStates[index] = CreateInitialState(RenderGraph::GetAccessInfo(m_Images[index].initialAccess));
+        }
+
+        auto bufferStates = std::vector<ResourceState>(m_Buffers.size());
+        for (auto index = 0u; index < m_Buffers.size(); ++index)
+        {
+            bufferStates[index] = CreateInitialState(RenderGraph::GetAccessInfo(m_Buffers[index].initialAccess));
+        }
+
+        auto aliasBarriers = std::vector<AliasBarrier>();
+        state.passes.reserve(livePasses.size());
+        for (auto pass = 0u; pass < livePasses.size(); ++pass)
+        {
+            const auto & description = m_Passes[livePasses[pass]];
+
+            auto compiledPass = RenderGraph::CompiledPass{ .barriers = {}, .execute = description.execute };
+            for (auto && use : description.images)
+            {
+                if (use.access == ImageAccess::None)
+                {
+                    continue;
+                }
+
+                auto & imageState = imageStates[use.image.index];
+                if (transientIndex[use.image.index] != noTransientImage
+                    && imageState.layout == VK_IMAGE_LAYOUT_UNDEFINED)
+                {
+                    aliasBarriers.push_back(
+                        AliasBarrier{ .pass           = pass,
+                                      .barrier        = static_cast<std::uint32_t>(
+                                          compiledPass.barriers.imageBarriers.size()),
+                                      .transientImage = transientIndex[use.image.index] });
+                }
+                AddImageBarrier(compiledPass.barriers, *state.images[use.image.index], imageState,
+                                RenderGraph::GetAccessInfo(use.access));
+            }
+
+            for (auto && use : description.buffers)
+            {
+                AddBufferBarrier(compiledPass.barriers, *state.buffers[use.buffer.index],
+                                 bufferStates[use.buffer.index], RenderGraph::GetAccessInfo(use.access));
+            }
+
+            state.passes.push_back(std::move(compiledPass));
+        }
+
+        for (auto index = 0u; index < m_Images.size(); ++index)
+        {
+            if (m_Images[index].image != nullptr && m_Images[index].finalAccess != ImageAccess::None)
+            {
+                AddImageBarrier(state.finalBarriers, *state.images[index], imageStates[index],
+                                RenderGraph::GetAccessInfo(m_Images[index].finalAccess));
+            }
+        }
+
+        // In the first frame nothing used the memory before, in later ones it was last used by the previous frame
+        for (auto && aliasBarrier : aliasBarriers)
+        {
+            const auto & transientImage = transientImages[aliasBarrier.transientImage];
+
+            auto predecessors = std::vector<const TransientImage *>();
+            for (auto && other : transientImages)
+            {
+                if (AreMemoryRangesOverlapping(other, transientImage) && other.lastPass < transientImage.firstPass)
+                {
+                    predecessors.push_back(&other);
+                }
+            }
+            if (predecessors.empty())
+            {
+                for (auto && other : transientImages)
+                {
+                    if (AreMemoryRangesOverlapping(other, transientImage))
+                    {
+                        predecessors.push_back(&other);
+                    }
+                }
+            }
+
+            auto & barrier = state.passes[aliasBarrier.pass].barriers.imageBarriers[aliasBarrier.barrier];
+            for (auto predecessor : predecessors)
+            {
+                const auto & predecessorState = imageStates[predecessor->resource];
+
+                barrier.srcStageMask |= predecessorState.writeStages | predecessorState.readStages;
+                barrier.srcAccessMask |= predecessorState.writeAccess;
+            }
+        }
+
+        auto & statistics = state.statistics;
+        for (auto && batch : state.passes)
+        {
+            CountBarriers(statistics, batch.barriers);
+        }
+        CountBarriers(statistics, state.finalBarriers);
+    }
+
+    [[nodiscard]] static ResourceState CreateInitialState(const RenderGraph::AccessInfo & info) noexcept
+    {
+        return ResourceState{ .writeStages = info.isWrite ? info.stages : VK_PIPELINE_STAGE_2_NONE,
+                              .writeAccess = info.isWrite ? info.access : VK_ACCESS_2_NONE,
+                              .readStages  = info.isWrite ? VK_PIPELINE_STAGE_2_NONE : info.stages,
+                              .readAccess  = info.isWrite ? VK_ACCESS_2_NONE : info.access,
+                              .layout      = info.layout };
+    }
+
+    // Advances the state to the access and returns what the access has to wait for, if anything
+    [[nodiscard]] static std::optional<Dependency> Transition(ResourceState &                  state,
+                                                              const RenderGraph::AccessInfo & info) noexcept
+    {
+        if (state.layout != info.layout || info.isWrite)
+        {
+            auto previousStages = state.writeStages | state.readStages;
+            auto isNeeded       = state.layout != info.layout || previousStages != 0;
+
+            // Without a known producer the transition is chained to the stages about to use the image, so it
+            // can not run ahead of a semaphore wait on them
+            auto dependency = Dependency{ .sourceStages = previousStages != 0 ? previousStages : info.stages,
+                                          .sourceAccess = state.writeAccess,
+                                          .oldLayout    = state.layout };
+
+            // A layout transition is a write the following reads have to be ordered after
+            state = ResourceState{ .writeStages = info.stages,
+                                   .writeAccess = info.isWrite ? info.access : VK_ACCESS_2_NONE,
+                                   .readStages  = info.isWrite ? VK_PIPELINE_STAGE_2_NONE : info.stages,
+                                   .readAccess  = info.isWrite ? VK_ACCESS_2_NONE : info.access,
+                                   .layout      = info.layout };
+
+            return isNeeded ? std::optional(dependency) : std::nullopt;
+        }
+
+        auto isVisible = (info.stages & ~state.readStages) == 0 && (info.access & ~state.readAccess) == 0;
+        state.readStages |= info.stages;
+        state.readAccess |= info.access;
+        if (isVisible || state.writeStages == 0)
+        {
+            return std::nullopt;
+        }
+
+        return Dependency{ .sourceStages = state.writeStages,
+                           .sourceAccess = state.writeAccess,
+                           .oldLayout    = state.layout };
+    }
+
+    static void AddImageBarrier(RenderGraph::BarrierBatch & batch, const Vulkan::Image & image, ResourceState & state,
+                                const RenderGraph::AccessInfo & info)
+    {
+        auto dependency = Transition(state, info);
+        if (!dependency)
+        {
+            return;
+        }
+
+        batch.imageBarriers.push_back(
+            VkImageMemoryBarrier2{ .sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2,
+                                   .pNext               = nullptr,
+                                   .srcStageMask        = dependency->sourceStages,
+                                   .srcAccessMask       = dependency->sourceAccess,
+                                   .dstStageMask        = info.stages,
+                                   .dstAccessMask       = info.access,
+                                   .oldLayout           = dependency->oldLayout,
+                                   .newLayout           = info.layout,
+                                   .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                                   .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                                   .image               = image.GetImpl().GetHandle(),
+                                   .subresourceRange    = { image.GetImpl().GetAspect(), 0, 1, 0, 1 } });
+    }
+
+    static void AddBufferBarrier(RenderGraph::BarrierBatch & batch, const Vulkan::Buffer & buffer,
+                                 ResourceState & state, const RenderGraph::AccessInfo & info)
+    {
+        auto dependency = Transition(state, info);
+        if (!dependency)
+        {
+            return;
+        }
+
+        batch.bufferBarriers.push_back(VkBufferMemoryBarrier2{ .sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2,
+                                                               .pNext = nullptr,
+                                                               .srcStageMask        = dependency->sourceStages,
+                                                               .srcAccessMask       = dependency->sourceAccess,
+                                                               .dstStageMask        = info.stages,
+                                                               .dstAccessMask       = info.access,
+                                                               .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                                                               .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                                                               .buffer = buffer.GetImpl().GetHandle(),
+                                                               .offset = 0,
+                                                               .size   = VK_WHOLE_SIZE });
+    }
+
+    static void CountBarriers(RenderGraphStatistics & statistics, const RenderGraph::BarrierBatch & batch) noexcept
+    {
+        if (!batch.imageBarriers.empty() || !batch.bufferBarriers.empty())
+        {
+            ++statistics.barrierBatchCount;
+        }
+        statistics.imageBarrierCount += static_cast<std::uint32_t>(batch.imageBarriers.size());
+        statistics.bufferBarrierCount += static_cast<std::uint32_t>(batch.bufferBarriers.size());
+    }
+
+    [[nodiscard]] static bool AreLifetimesOverlapping(const TransientImage & left,
+                                                      const TransientImage & right) noexcept
+    {
+        return left.firstPass <= right.lastPass && right.firstPass <= left.lastPass;
+    }
+
+    [[nodiscard]] static bool AreMemoryRangesOverlapping(const TransientImage & left,
+                                                         const TransientImage & right) noexcept
+    {
+        return left.memory == right.memory && left.offset < right.offset + right.requirements.size
+               && right.offset < left.offset + left.requirements.size;
+    }
+
+    [[nodiscard]] static VkDeviceSize AlignUp(VkDeviceSize value, VkDeviceSize alignment) noexcept
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+private:
+    Device *                           m_Device;
+    std::vector<ImageResource>         m_Images;
+    std::vector<BufferResource>        m_Buffers;
+    std::vector<RenderPassDescription> m_Passes;
+};
+} // namespace CuEngine::Vulkan::Impl
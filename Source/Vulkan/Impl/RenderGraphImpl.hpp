@@ -0,0 +1,351 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include "BufferImpl.hpp"
+#include "CommandBufferImpl.hpp"
+#include "ImageImpl.hpp"
+#include "LoaderImpl.hpp"
+#include "MemoryAllocatorImpl.hpp"
+
+#include <CuEngine/Vulkan/RenderGraph.hpp>
+
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace CuEngine::Vulkan::Impl
+{
+class RenderGraph
+{
+public:
+    struct AccessInfo
+    {
+        VkPipelineStageFlags2 stages;
+        VkAccessFlags2        access;
+        VkImageLayout         layout;
+        VkImageUsageFlags     usage;
+        bool                  isWrite;
+    };
+
+    struct BarrierBatch
+    {
+        std::vector<VkImageMemoryBarrier2>  imageBarriers;
+        std::vector<VkBufferMemoryBarrier2> bufferBarriers;
+    };
+
+    struct CompiledPass
+    {
+        BarrierBatch                                                              barriers;
+        std::function<void(Vulkan::CommandBuffer &, const Vulkan::RenderGraph &)> execute;
+    };
+
+    struct State
+    {
+        VkDevice                            device;
+        bool                                hasSynchronization2;
+        std::vector<MemoryAllocation>       transientMemory;
+        std::vector<Vulkan::Image>          transientImages;
+        std::vector<const Vulkan::Image *>  images;
+        std::vector<const Vulkan::Buffer *> buffers;
+        std::vector<CompiledPass>           passes;
+        BarrierBatch                        finalBarriers;
+        RenderGraphStatistics               statistics;
+    };
+
+public:
+    explicit RenderGraph(std::unique_ptr<State> state) noexcept : m_State(std::move(state))
+    {}
+
+    RenderGraph(const RenderGraph & other) = delete;
+
+    RenderGraph(RenderGraph && other) noexcept = default;
+
+    RenderGraph & operator=(const RenderGraph & other) = delete;
+
+    RenderGraph & operator=(RenderGraph && other) noexcept
+    {
+        if (this != &other)
+        {
+            std::swap(m_State, other.m_State);
+        }
+
+        return *this;
+    }
+
+    ~RenderGraph() noexcept
+    {
+        if (!m_State)
+        {
+            return;
+        }
+
+        // Aliased images go first, the memory under them is owned by the graph
+        m_State->transientImages.clear();
+        for (auto && allocation : m_State->transientMemory)
+        {
+            MemoryAllocator::Free(allocation);
+        }
+    }
+
+    void Execute(Vulkan::CommandBuffer & commandBuffer, const Vulkan::RenderGraph & renderGraph) const
+    {
+        auto handle = commandBuffer.GetImpl().GetHandle();
+        for (auto && pass : m_State->passes)
+        {
+            RecordBarriers(handle, pass.barriers);
+            if (pass.execute)
+            {
+                pass.execute(commandBuffer, renderGraph);
+            }
+        }
+        RecordBarriers(handle, m_State->finalBarriers);
+    }
+
+    [[nodiscard]] const Vulkan::Image & GetImage(ImageHandle image) const noexcept
+    {
+        return *m_State->images[image.index];
+    }
+
+    [[nodiscard]] const Vulkan::Buffer & GetBuffer(BufferHandle buffer) const noexcept
+    {
+        return *m_State->buffers[buffer.index];
+    }
+
+    [[nodiscard]] RenderGraphStatistics GetStatistics() const noexcept
+    {
+        return m_State->statistics;
+    }
+
+    [[nodiscard]] static AccessInfo GetAccessInfo(ImageAccess access) noexcept
+    {
+        switch (access)
+        {
+            case ImageAccess::ColorAttachmentWrite:
+                return AccessInfo{ .stages  = VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT,
+                                   .access  = VK_ACCESS_2_COLOR_ATTACHMENT_READ_BIT
+                                             | VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT,
+                                   .layout  = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+                                   .usage   = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT,
+                                   .isWrite = true };
+            case ImageAccess::DepthAttachmentWrite:
+                return AccessInfo{ .stages  = VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT
+                                             | VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT,
+                                   .access  = VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT
+                                             | VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT,
+                                   .layout  = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+                                   .usage   = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT,
+                                   .isWrite = true };
+            case ImageAccess::DepthAttachmentRead:
+                return AccessInfo{ .stages  = VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT
+                                             | VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT,
+                                   .access  = VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT,
+                                   .layout  = VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL,
+                                   .usage   = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT,
+                                   .isWrite = false };
+            case ImageAccess::FragmentShaderRead:
+                return AccessInfo{ .stages  = VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT,
+                                   .access  = VK_ACCESS_2_SHADER_READ_BIT,
+                                   .layout  = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                                   .usage   = VK_IMAGE_USAGE_SAMPLED_BIT,
+                                   .isWrite = false };
+            case ImageAccess::ComputeShaderRead:
+                return AccessInfo{ .stages  = VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT,
+                                   .access  = VK_ACCESS_2_SHADER_READ_BIT,
+                                   .layout  = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                                   .usage   = VK_IMAGE_USAGE_SAMPLED_BIT,
+                                   .isWrite = false };
+            case ImageAccess::ComputeShaderWrite:
+                return AccessInfo{ .stages  = VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT,
+                                   .access  = VK_ACCESS_2_SHADER_READ_BIT | VK_ACCESS_2_SHADER_WRITE_BIT,
+                                   .layout  = VK_IMAGE_LAYOUT_GENERAL,
+                                   .usage   = VK_IMAGE_USAGE_STORAGE_BIT,
+                                   .isWrite = true };
+            case ImageAccess::TransferRead:
+                return AccessInfo{ .stages  = VK_PIPELINE_STAGE_2_TRANSFER_BIT,
+                                   .access  = VK_ACCESS_2_TRANSFER_READ_BIT,
+                                   .layout  = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                                   .usage   = VK_IMAGE_USAGE_TRANSFER_SRC_BIT,
+                                   .isWrite = false };
+            case ImageAccess::TransferWrite:
+                return AccessInfo{ .stages  = VK_PIPELINE_STAGE_2_TRANSFER_BIT,
+                                   .access  = VK_ACCESS_2_TRANSFER_WRITE_BIT,
+                                   .layout  = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                   .usage   = VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+                                   .isWrite = true };
+            case ImageAccess::Present:
+                // Presentation is ordered by the semaphore, not by the barrier
+                return AccessInfo{ .stages  = VK_PIPELINE_STAGE_2_NONE,
+                                   .access  = VK_ACCESS_2_NONE,
+                                   .layout  = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR,
+                                   .usage   = 0,
+                                   .isWrite = false };
+            default:
+                return AccessInfo{ .stages  = VK_PIPELINE_STAGE_2_NONE,
+                                   .access  = VK_ACCESS_2_NONE,
+                                   .layout  = VK_IMAGE_LAYOUT_UNDEFINED,
+                                   .usage   = 0,
+                                   .isWrite = false };
+        }
+    }
+
+    [[nodiscard]] static AccessInfo GetAccessInfo(BufferAccess access) noexcept
+    {
+        auto info = AccessInfo{ .stages  = VK_PIPELINE_STAGE_2_NONE,
+                                .access  = VK_ACCESS_2_NONE,
+                                .layout  = VK_IMAGE_LAYOUT_UNDEFINED,
+                                .usage   = 0,
+                                .isWrite = false };
+
+        switch (access)
+        {
+            case BufferAccess::VertexRead:
+                info.stages = VK_PIPELINE_STAGE_2_VERTEX_INPUT_BIT;
+                info.access = VK_ACCESS_2_VERTEX_ATTRIBUTE_READ_BIT;
+                break;
+            case BufferAccess::IndexRead:
+                info.stages = VK_PIPELINE_STAGE_2_VERTEX_INPUT_BIT;
+                info.access = VK_ACCESS_2_INDEX_READ_BIT;
+                break;
+            case BufferAccess::IndirectRead:
+                info.stages = VK_PIPELINE_STAGE_2_DRAW_INDIRECT_BIT;
+                info.access = VK_ACCESS_2_INDIRECT_COMMAND_READ_BIT;
+                break;
+            case BufferAccess::UniformRead:
+                info.stages = VK_PIPELINE_STAGE_2_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT
+                            | VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT;
+                info.access = VK_ACCESS_2_UNIFORM_READ_BIT;
+                break;
+            case BufferAccess::VertexShaderRead:
+                info.stages = VK_PIPELINE_STAGE_2_VERTEX_SHADER_BIT;
+                info.access = VK_ACCESS_2_SHADER_READ_BIT;
+                break;
+            case BufferAccess::FragmentShaderRead:
+                info.stages = VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT;
+                info.access = VK_ACCESS_2_SHADER_READ_BIT;
+                break;
+            case BufferAccess::ComputeShaderRead:
+                info.stages = VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT;
+                info.access = VK_ACCESS_2_SHADER_READ_BIT;
+                break;
+            case BufferAccess::ComputeShaderWrite:
+                info.stages  = VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT;
+                info.access  = VK_ACCESS_2_SHADER_READ_BIT | VK_ACCESS_2_SHADER_WRITE_BIT;
+                info.isWrite = true;
+                break;
+            case BufferAccess::TransferRead:
+                info.stages = VK_PIPELINE_STAGE_2_TRANSFER_BIT;
+                info.access = VK_ACCESS_2_TRANSFER_READ_BIT;
+                break;
+            case BufferAccess::TransferWrite:
+                info.stages  = VK_PIPELINE_STAGE_2_TRANSFER_BIT;
+                info.access  = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+                info.isWrite = true;
+                break;
+            default:
+                break;
+        }
+
+        return info;
+    }
+
+private:
+    // One call per batch, devices without synchronization2 get the same barriers through the original entry point
+    void RecordBarriers(VkCommandBuffer commandBuffer, const BarrierBatch & batch) const
+    {
+        if (batch.imageBarriers.empty() && batch.bufferBarriers.empty())
+        {
+            return;
+        }
+
+        if (m_State->hasSynchronization2)
+        {
+            auto dependencyInfo =
+                VkDependencyInfo{ .sType                    = VK_STRUCTURE_TYPE_DEPENDENCY_INFO,
+                                  .pNext                    = nullptr,
+                                  .dependencyFlags          = 0,
+                                  .memoryBarrierCount       = 0,
+                                  .pMemoryBarriers          = nullptr,
+                                  .bufferMemoryBarrierCount = static_cast<std::uint32_t>(batch.bufferBarriers.size()),
+                                  .pBufferMemoryBarriers    = batch.bufferBarriers.data(),
+                                  .imageMemoryBarrierCount  = static_cast<std::uint32_t>(batch.imageBarriers.size()),
+                                  .pImageMemoryBarriers     = batch.imageBarriers.data() };
+
+            vkCmdPipelineBarrier2(commandBuffer, &dependencyInfo);
+            return;
+        }
+
+        // All stages and accesses the graph uses exist in the 32 bit flags with the same values
+        auto sourceStages      = VkPipelineStageFlags(0);
+        auto destinationStages = VkPipelineStageFlags(0);
+
+        auto imageBarriers = std::vector<VkImageMemoryBarrier>();
+        imageBarriers.reserve(batch.imageBarriers.size());
+        for (auto && barrier : batch.imageBarriers)
+        {
+            sourceStages |= static_cast<VkPipelineStageFlags>(barrier.srcStageMask);
+            destinationStages |= static_cast<VkPipelineStageFlags>(barrier.dstStageMask);
+            imageBarriers.push_back(VkImageMemoryBarrier{
+                .sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+                .pNext               = nullptr,
+                .srcAccessMask       = static_cast<VkAccessFlags>(barrier.srcAccessMask),
+                .dstAccessMask       = static_cast<VkAccessFlags>(barrier.dstAccessMask),
+                .oldLayout           = barrier.oldLayout,
+                .newLayout           = barrier.newLayout,
+                .srcQueueFamilyIndex = barrier.srcQueueFamilyIndex,
+                .dstQueueFamilyIndex = barrier.dstQueueFamilyIndex,
+                .image               = barrier.image,
+                .subresourceRange    = barrier.subresourceRange });
+        }
+
+        auto bufferBarriers = std::vector<VkBufferMemoryBarrier>();
+        bufferBarriers.reserve(batch.bufferBarriers.size());
+        for (auto && barrier : batch.bufferBarriers)
+        {
+            sourceStages |= static_cast<VkPipelineStageFlags>(barrier.srcStageMask);
+            destinationStages |= static_cast<VkPipelineStageFlags>(barrier.dstStageMask);
+            bufferBarriers.push_back(VkBufferMemoryBarrier{ .sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+                                                            .pNext = nullptr,
+                                                            .srcAccessMask =
+                                                                static_cast<VkAccessFlags>(barrier.srcAccessMask),
+                                                            .dstAccessMask =
+                                                                static_cast<VkAccessFlags>(barrier.dstAccessMask),
+                                                            .srcQueueFamilyIndex = barrier.srcQueueFamilyIndex,
+                                                            .dstQueueFamilyIndex = barrier.dstQueueFamilyIndex,
+                                                            .buffer              = barrier.buffer,
+                                                            .offset              = barrier.offset,
+                                                            .size                = barrier.size });
+        }
+
+        vkCmdPipelineBarrier(commandBuffer, sourceStages != 0 ? sourceStages : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                             destinationStages != 0 ? destinationStages : VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0,
+                             nullptr, static_cast<std::uint32_t>(bufferBarriers.size()), bufferBarriers.data(),
+                             static_cast<std::uint32_t>(imageBarriers.size()), imageBarriers.data());
+    }
+
+private:
+    std::unique_ptr<State> m_State;
+};
+} // namespace CuEngine::Vulkan::Impl
@@ -25,6 +25,7 @@
 #include <vulkan/vulkan.h>
 
 #include "../../Platform/Impl/WindowImpl.hpp"
+#include "HostAllocatorImpl.hpp"
 #include "InstanceImpl.hpp"
 #include "SurfaceImpl.hpp"
 
@@ -65,7 +66,7 @@ public:
     [[nodiscard]] Surface Build() const
     {
         auto surface = VkSurfaceKHR(VK_NULL_HANDLE);
-        if (glfwCreateWindowSurface(m_Instance, m_Window, nullptr, &surface) != VK_SUCCESS)
+        if (glfwCreateWindowSurface(m_Instance, m_Window, HostAllocator::GetCallbacks(), &surface) != VK_SUCCESS)
         {
             throw std::runtime_error("Failed to create Vulkan surface");
         }
@@ -25,6 +25,8 @@
 #include <vulkan/vulkan.h>
 
 #include "InstanceImpl.hpp"
+#include "HostAllocatorImpl.hpp"
+#include "LoaderImpl.hpp"
 
 #include <CuEngine/Vulkan/Surface.hpp>
 
@@ -60,7 +62,7 @@ public:
     {
         if (m_Handle)
         {
-            vkDestroySurfaceKHR(m_InstanceHandle, m_Handle, nullptr);
+            vkDestroySurfaceKHR(m_InstanceHandle, m_Handle, HostAllocator::GetCallbacks());
         }
     }
 
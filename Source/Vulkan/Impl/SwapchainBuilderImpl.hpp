@@ -0,0 +1,494 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include "../../Platform/Impl/WindowImpl.hpp"
+#include "DeviceImpl.hpp"
+#include "HostAllocatorImpl.hpp"
+#include "LoaderImpl.hpp"
+#include "PhysicalDeviceImpl.hpp"
+#include "QueueFamilyImpl.hpp"
+#include "SurfaceImpl.hpp"
+#include "SwapchainImpl.hpp"
+
+#include <CuEngine/Vulkan/SwapchainBuilder.hpp>
+
+#include <algorithm>
+#include <set>
+
+namespace CuEngine::Vulkan::Impl
+{
+class SwapchainBuilder
+{
+public:
+    explicit SwapchainBuilder()
+        : m_PhysicalDevice(VK_NULL_HANDLE), m_Device(VK_NULL_HANDLE), m_Surface(VK_NULL_HANDLE), m_Window(nullptr),
+          m_OldSwapchain(nullptr),
+          m_PresentModes{ PresentMode::Mailbox, PresentMode::Immediate, PresentMode::FifoRelaxed },
+          m_QueueFamilyIndices(), m_GraphicsQueueFamilyIndex(0), m_FramesInFlight(2)
+    {}
+
+    SwapchainBuilder(const SwapchainBuilder & other) = default;
+
+    SwapchainBuilder(SwapchainBuilder && other) noexcept = default;
+
+    SwapchainBuilder & operator=(const SwapchainBuilder & other) = default;
+
+    SwapchainBuilder & operator=(SwapchainBuilder && other) noexcept = default;
+
+    ~SwapchainBuilder() noexcept = default;
+
+    SwapchainBuilder & SetPhysicalDevice(PhysicalDevice & physicalDevice) noexcept
+    {
+        m_PhysicalDevice = physicalDevice.GetHandle();
+
+        return *this;
+    }
+
+    SwapchainBuilder & SetDevice(Device & device) noexcept
+    {
+        m_Device = device.GetHandle();
+
+        return *this;
+    }
+
+    SwapchainBuilder & SetSurface(Surface & surface) noexcept
+    {
+        m_Surface = surface.GetHandle();
+
+        return *this;
+    }
+
+    SwapchainBuilder & SetWindow(Platform::Impl::Window & window) noexcept
+    {
+        m_Window = &window;
+
+        return *this;
+    }
+
+    SwapchainBuilder & SetQueueFamilies(const QueueFamily & graphicsQueueFamily,
+                                        const QueueFamily & presentationQueueFamily)
+    {
+        auto uniqueIndices         = std::set{ graphicsQueueFamily.GetIndex(), presentationQueueFamily.GetIndex() };
+        m_QueueFamilyIndices       = std::vector<std::uint32_t>(uniqueIndices.begin(), uniqueIndices.end());
+        m_GraphicsQueueFamilyIndex = graphicsQueueFamily.GetIndex();
+
+        return *this;
+    }
+
+    SwapchainBuilder & SetPresentModes(const std::vector<PresentMode> & presentModes)
+    {
+        m_PresentModes = presentModes;
+
+        return *this;
+    }
+
+    SwapchainBuilder & SetFramesInFlight(std::uint32_t framesInFlight) noexcept
+    {
+        m_FramesInFlight = framesInFlight;
+
+        return *this;
+    }
+
+    SwapchainBuilder & SetOldSwapchain(Swapchain & swapchain) noexcept
+    {
+        m_OldSwapchain = &swapchain;
+
+        return *this;
+    }
+
+    [[nodiscard]] Swapchain Build() const
+    {
+        if (m_FramesInFlight < 2 || m_FramesInFlight > 3)
+        {
+            throw std::runtime_error("Swapchain supports only 2 or 3 frames in flight");
+        }
+
+        if (m_OldSwapchain != nullptr && m_OldSwapchain->GetFramesInFlight() != m_FramesInFlight)
+        {
+            throw std::runtime_error("Swapchain recreation cannot change the number of frames in flight");
+        }
+
+        auto capabilities = VkSurfaceCapabilitiesKHR();
+        if (vkGetPhysicalDeviceSurfaceCapabilitiesKHR(m_PhysicalDevice, m_Surface, &capabilities) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to get Surface capabilities");
+        }
+
+        constexpr auto imageUsage = VkImageUsageFlags(VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT
+                                                      | VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+        if ((capabilities.supportedUsageFlags & imageUsage) != imageUsage)
+        {
+            throw std::runtime_error("Surface does not support the required image usage");
+        }
+
+        auto [presentModeHandle, presentMode] = ChoosePresentMode();
+        auto surfaceFormat                    = ChooseSurfaceFormat();
+        auto extent                           = ChooseExtent(capabilities);
+
+        // Minimized windows report a zero extent, recreation has to wait until they are restored
+        if (extent.width == 0 || extent.height == 0)
+        {
+            throw std::runtime_error("Failed to create a swapchain for a zero sized surface");
+        }
+
+        // One image more than frames in flight lets the CPU acquire while the others are queued or scanned out
+        auto imageCount = std::max(capabilities.minImageCount + 1, m_FramesInFlight + 1);
+        if (capabilities.maxImageCount != 0)
+        {
+            imageCount = std::min(imageCount, capabilities.maxImageCount);
+        }
+
+        auto isShared      = m_QueueFamilyIndices.size() > 1;
+        auto swapchainInfo = VkSwapchainCreateInfoKHR{
+            .sType                 = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR,
+            .pNext                 = nullptr,
+            .flags                 = {},
+            .surface               = m_Surface,
+            .minImageCount         = imageCount,
+            .imageFormat           = surfaceFormat.format,
+            .imageColorSpace       = surfaceFormat.colorSpace,
+            .imageExtent           = extent,
+            .imageArrayLayers      = 1,
+            .imageUsage            = imageUsage,
+            .imageSharingMode      = isShared ? VK_SHARING_MODE_CONCURRENT : VK_SHARING_MODE_EXCLUSIVE,
+            .queueFamilyIndexCount = isShared ? static_cast<std::uint32_t>(m_QueueFamilyIndices.size()) : 0,
+            .pQueueFamilyIndices   = isShared ? m_QueueFamilyIndices.data() : nullptr,
+            .preTransform          = capabilities.currentTransform,
+            .compositeAlpha        = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR,
+            .presentMode           = presentModeHandle,
+            .clipped               = VK_TRUE,
+            .oldSwapchain          = m_OldSwapchain != nullptr ? m_OldSwapchain->GetHandle() : VK_NULL_HANDLE
+        };
+
+        auto swapchain = VkSwapchainKHR(VK_NULL_HANDLE);
+        if (vkCreateSwapchainKHR(m_Device, &swapchainInfo, HostAllocator::GetCallbacks(), &swapchain) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create a swapchain");
+        }
+
+        // Destroyed here on failure until the Swapchain takes ownership, each helper cleans up its own partial work
+        auto images                   = std::vector<VkImage>();
+        auto imageViews               = std::vector<VkImageView>();
+        auto renderFinishedSemaphores = std::vector<VkSemaphore>();
+        auto frames                   = std::vector<Swapchain::Frame>();
+        try
+        {
+            images                   = GetImages(swapchain);
+            imageViews               = CreateImageViews(images, surfaceFormat.format);
+            renderFinishedSemaphores = CreateSemaphores(images.size());
+            if (m_OldSwapchain == nullptr)
+            {
+                frames = CreateFrames();
+            }
+        }
+        catch (...)
+        {
+            DestroySemaphores(renderFinishedSemaphores);
+            DestroyImageViews(imageViews);
+            vkDestroySwapchainKHR(m_Device, swapchain, HostAllocator::GetCallbacks());
+            throw;
+        }
+
+        if (m_OldSwapchain == nullptr)
+        {
+            return Swapchain(m_Device, swapchain, surfaceFormat.format, extent, presentMode, std::move(images),
+                             std::move(imageViews), std::move(renderFinishedSemaphores), std::move(frames), 0, {});
+        }
+
+        auto frameIndex = m_OldSwapchain->GetFrameIndex();
+        frames          = m_OldSwapchain->TakeFrames();
+
+        return Swapchain(m_Device, swapchain, surfaceFormat.format, extent, presentMode, std::move(images),
+                         std::move(imageViews), std::move(renderFinishedSemaphores), std::move(frames), frameIndex,
+                         m_OldSwapchain->Retire(m_FramesInFlight));
+    }
+
+private:
+    [[nodiscard]] std::pair<VkPresentModeKHR, PresentMode> ChoosePresentMode() const
+    {
+        auto count = std::uint32_t();
+        if (vkGetPhysicalDeviceSurfacePresentModesKHR(m_PhysicalDevice, m_Surface, &count, nullptr) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to get Surface present modes");
+        }
+
+        auto supportedModes = std::vector<VkPresentModeKHR>(count);
+        if (vkGetPhysicalDeviceSurfacePresentModesKHR(m_PhysicalDevice, m_Surface, &count, supportedModes.data())
+            != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to get Surface present modes");
+        }
+
+        for (auto presentMode : m_PresentModes)
+        {
+            auto handle = ToHandle(presentMode);
+            if (std::ranges::find(supportedModes, handle) != std::ranges::end(supportedModes))
+            {
+                return { handle, presentMode };
+            }
+        }
+
+        // FIFO is the only mode every implementation has to support
+        return { VK_PRESENT_MODE_FIFO_KHR, PresentMode::Fifo };
+    }
+
+    [[nodiscard]] VkSurfaceFormatKHR ChooseSurfaceFormat() const
+    {
+        auto count = std::uint32_t();
+        if (vkGetPhysicalDeviceSurfaceFormatsKHR(m_PhysicalDevice, m_Surface, &count, nullptr) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to get Surface formats");
+        }
+
+        auto formats = std::vector<VkSurfaceFormatKHR>(count);
+        if (vkGetPhysicalDeviceSurfaceFormatsKHR(m_PhysicalDevice, m_Surface, &count, formats.data()) != VK_SUCCESS
+            || formats.empty())
+        {
+            throw std::runtime_error("Failed to get Surface formats");
+        }
+
+        auto preferredIt = std::ranges::find_if(formats,
+                                                [](const auto & format)
+                                                {
+                                                    return format.format == VK_FORMAT_B8G8R8A8_SRGB
+                                                           && format.colorSpace == VK_COLOR_SPACE_SRGB_NONLINEAR_KHR;
+                                                });
+
+        return preferredIt != std::ranges::end(formats) ? *preferredIt : formats.front();
+    }
+
+    [[nodiscard]] VkExtent2D ChooseExtent(const VkSurfaceCapabilitiesKHR & capabilities) const
+    {
+        if (capabilities.currentExtent.width != std::numeric_limits<std::uint32_t>::max())
+        {
+            return capabilities.currentExtent;
+        }
+
+        // Tracked by the window's event pump, GLFW itself may only be asked on the main thread
+        return VkExtent2D{ .width  = std::clamp(m_Window->GetWidth(), capabilities.minImageExtent.width,
+                                                capabilities.maxImageExtent.width),
+                           .height = std::clamp(m_Window->GetHeight(), capabilities.minImageExtent.height,
+                                                capabilities.maxImageExtent.height) };
+    }
+
+    [[nodiscard]] std::vector<VkImage> GetImages(VkSwapchainKHR swapchain) const
+    {
+        auto count = std::uint32_t();
+        if (vkGetSwapchainImagesKHR(m_Device, swapchain, &count, nullptr) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to get swapchain images");
+        }
+
+        auto images = std::vector<VkImage>(count);
+        if (vkGetSwapchainImagesKHR(m_Device, swapchain, &count, images.data()) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to get swapchain images");
+        }
+
+        return images;
+    }
+
+    [[nodiscard]] std::vector<VkImageView> CreateImageViews(const std::vector<VkImage> & images, VkFormat format) const
+    {
+        auto imageViews = std::vector<VkImageView>(images.size(), VK_NULL_HANDLE);
+        try
+        {
+            std::ranges::transform(images, imageViews.begin(),
+                                   [this, format](auto image)
+                                   {
+                                       auto viewInfo = VkImageViewCreateInfo{
+                                           .sType            = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+                                           .pNext            = nullptr,
+                                           .flags            = {},
+                                           .image            = image,
+                                           .viewType         = VK_IMAGE_VIEW_TYPE_2D,
+                                           .format           = format,
+                                           .components       = { .r = VK_COMPONENT_SWIZZLE_IDENTITY,
+                                                                 .g = VK_COMPONENT_SWIZZLE_IDENTITY,
+                                                                 .b = VK_COMPONENT_SWIZZLE_IDENTITY,
+                                                                 .a = VK_COMPONENT_SWIZZLE_IDENTITY },
+                                           .subresourceRange = { .aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT,
+                                                                 .baseMipLevel   = 0,
+                                                                 .levelCount     = 1,
+                                                                 .baseArrayLayer = 0,
+                                                                 .layerCount     = 1 }
+                                       };
+
+                                       auto imageView = VkImageView(VK_NULL_HANDLE);
+                                       if (vkCreateImageView(m_Device, &viewInfo, HostAllocator::GetCallbacks(),
+                                                             &imageView)
+                                           != VK_SUCCESS)
+                                       {
+                                           throw std::runtime_error("Failed to create a swapchain image view");
+                                       }
+
+                                       return imageView;
+                                   });
+        }
+        catch (...)
+        {
+            DestroyImageViews(imageViews);
+            throw;
+        }
+
+        return imageViews;
+    }
+
+    [[nodiscard]] std::vector<VkSemaphore> CreateSemaphores(std::size_t count) const
+    {
+        auto semaphores = std::vector<VkSemaphore>(count, VK_NULL_HANDLE);
+        try
+        {
+            std::ranges::generate(semaphores,
+                                  [this]()
+                                  {
+                                      return CreateSemaphore();
+                                  });
+        }
+        catch (...)
+        {
+            DestroySemaphores(semaphores);
+            throw;
+        }
+
+        return semaphores;
+    }
+
+    [[nodiscard]] std::vector<Swapchain::Frame> CreateFrames() const
+    {
+        // Every handle is stored as soon as it exists, so a failure destroys exactly what was created
+        auto frames = std::vector<Swapchain::Frame>(m_FramesInFlight, Swapchain::Frame{});
+        try
+        {
+            for (auto && frame : frames)
+            {
+                auto fenceInfo = VkFenceCreateInfo{ .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
+                                                    .pNext = nullptr,
+                                                    .flags = VK_FENCE_CREATE_SIGNALED_BIT };
+                if (vkCreateFence(m_Device, &fenceInfo, HostAllocator::GetCallbacks(), &frame.inFlightFence)
+                    != VK_SUCCESS)
+                {
+                    throw std::runtime_error("Failed to create a frame fence");
+                }
+
+                frame.imageAvailableSemaphore = CreateSemaphore();
+
+                auto poolInfo = VkCommandPoolCreateInfo{ .sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+                                                         .pNext            = nullptr,
+                                                         .flags            = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT,
+                                                         .queueFamilyIndex = m_GraphicsQueueFamilyIndex };
+                if (vkCreateCommandPool(m_Device, &poolInfo, HostAllocator::GetCallbacks(), &frame.commandPool)
+                    != VK_SUCCESS)
+                {
+                    throw std::runtime_error("Failed to create a frame command pool");
+                }
+
+                auto allocateInfo = VkCommandBufferAllocateInfo{
+                    .sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+                    .pNext              = nullptr,
+                    .commandPool        = frame.commandPool,
+                    .level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+                    .commandBufferCount = 1
+                };
+                if (vkAllocateCommandBuffers(m_Device, &allocateInfo, &frame.commandBuffer) != VK_SUCCESS)
+                {
+                    throw std::runtime_error("Failed to allocate a frame command buffer");
+                }
+            }
+        }
+        catch (...)
+        {
+            // Destroying a pool frees its command buffer, null handles are ignored
+            for (auto && frame : frames)
+            {
+                vkDestroyCommandPool(m_Device, frame.commandPool, HostAllocator::GetCallbacks());
+                vkDestroySemaphore(m_Device, frame.imageAvailableSemaphore, HostAllocator::GetCallbacks());
+                vkDestroyFence(m_Device, frame.inFlightFence, HostAllocator::GetCallbacks());
+            }
+            throw;
+        }
+
+        return frames;
+    }
+
+    [[nodiscard]] VkSemaphore CreateSemaphore() const
+    {
+        auto semaphoreInfo =
+            VkSemaphoreCreateInfo{ .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO, .pNext = nullptr, .flags = {} };
+
+        auto semaphore = VkSemaphore(VK_NULL_HANDLE);
+        if (vkCreateSemaphore(m_Device, &semaphoreInfo, HostAllocator::GetCallbacks(), &semaphore) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create a semaphore");
+        }
+
+        return semaphore;
+    }
+
+    void DestroyImageViews(const std::vector<VkImageView> & imageViews) const noexcept
+    {
+        for (auto && imageView : imageViews)
+        {
+            vkDestroyImageView(m_Device, imageView, HostAllocator::GetCallbacks());
+        }
+    }
+
+    void DestroySemaphores(const std::vector<VkSemaphore> & semaphores) const noexcept
+    {
+        for (auto && semaphore : semaphores)
+        {
+            vkDestroySemaphore(m_Device, semaphore, HostAllocator::GetCallbacks());
+        }
+    }
+
+    [[nodiscard]] static VkPresentModeKHR ToHandle(PresentMode presentMode) noexcept
+    {
+        switch (presentMode)
+        {
+            case PresentMode::Immediate:
+                return VK_PRESENT_MODE_IMMEDIATE_KHR;
+            case PresentMode::Mailbox:
+                return VK_PRESENT_MODE_MAILBOX_KHR;
+            case PresentMode::FifoRelaxed:
+                return VK_PRESENT_MODE_FIFO_RELAXED_KHR;
+            case PresentMode::Fifo:
+            default:
+                return VK_PRESENT_MODE_FIFO_KHR;
+        }
+    }
+
+private:
+    VkPhysicalDevice           m_PhysicalDevice;
+    VkDevice                   m_Device;
+    VkSurfaceKHR               m_Surface;
+    Platform::Impl::Window *   m_Window;
+    Swapchain *                m_OldSwapchain;
+    std::vector<PresentMode>   m_PresentModes;
+    std::vector<std::uint32_t> m_QueueFamilyIndices;
+    std::uint32_t              m_GraphicsQueueFamilyIndex;
+    std::uint32_t              m_FramesInFlight;
+};
+} // namespace CuEngine::Vulkan::Impl
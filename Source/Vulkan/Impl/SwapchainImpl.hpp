@@ -0,0 +1,443 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include "GpuProfilerImpl.hpp"
+#include "HostAllocatorImpl.hpp"
+#include "LoaderImpl.hpp"
+#include "QueueImpl.hpp"
+
+#include <CuEngine/Vulkan/Swapchain.hpp>
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace CuEngine::Vulkan::Impl
+{
+class Swapchain
+{
+public:
+    struct Frame
+    {
+        VkFence         inFlightFence;
+        VkSemaphore     imageAvailableSemaphore;
+        VkCommandPool   commandPool;
+        VkCommandBuffer commandBuffer;
+    };
+
+    // Left behind by a recreation, still referenced by the presents queued before it
+    struct RetiredSwapchain
+    {
+        VkSwapchainKHR           handle;
+        std::vector<VkImageView> imageViews;
+        std::vector<VkSemaphore> renderFinishedSemaphores;
+        std::uint32_t            remainingFrames;
+    };
+
+public:
+    explicit Swapchain(VkDevice device, VkSwapchainKHR swapchain, VkFormat format, VkExtent2D extent,
+                       PresentMode presentMode, std::vector<VkImage> && images,
+                       std::vector<VkImageView> && imageViews, std::vector<VkSemaphore> && renderFinishedSemaphores,
+                       std::vector<Frame> && frames, std::uint32_t frameIndex,
+                       std::vector<RetiredSwapchain> && retiredSwapchains) noexcept
+        : m_Device(device), m_Handle(swapchain), m_Format(format), m_Width(extent.width), m_Height(extent.height),
+          m_PresentMode(presentMode), m_FrameIndex(frameIndex), m_ImageIndex(0), m_ClearColor{ 0.0f, 0.0f, 0.0f, 1.0f },
+          m_Images(std::move(images)),
+          m_ImageViews(std::move(imageViews)), m_RenderFinishedSemaphores(std::move(renderFinishedSemaphores)),
+          m_ImagesInFlight(m_Images.size(), VK_NULL_HANDLE), m_Frames(std::move(frames)),
+          m_RetiredSwapchains(std::move(retiredSwapchains))
+    {}
+
+    Swapchain(const Swapchain & other) = delete;
+
+    Swapchain(Swapchain && other) noexcept
+        : m_Device(std::exchange(other.m_Device, VK_NULL_HANDLE)),
+          m_Handle(std::exchange(other.m_Handle, VK_NULL_HANDLE)), m_Format(other.m_Format), m_Width(other.m_Width),
+          m_Height(other.m_Height), m_PresentMode(other.m_PresentMode), m_FrameIndex(other.m_FrameIndex),
+          m_ImageIndex(other.m_ImageIndex), m_ClearColor(other.m_ClearColor), m_Images(std::move(other.m_Images)),
+          m_ImageViews(std::move(other.m_ImageViews)),
+          m_RenderFinishedSemaphores(std::move(other.m_RenderFinishedSemaphores)),
+          m_ImagesInFlight(std::move(other.m_ImagesInFlight)), m_Frames(std::move(other.m_Frames)),
+          m_RetiredSwapchains(std::move(other.m_RetiredSwapchains))
+    {}
+
+    Swapchain & operator=(const Swapchain & other) = delete;
+
+    Swapchain & operator=(Swapchain && other) noexcept
+    {
+        if (this != &other)
+        {
+            std::swap(m_Device, other.m_Device);
+            std::swap(m_Handle, other.m_Handle);
+            std::swap(m_Format, other.m_Format);
+            std::swap(m_Width, other.m_Width);
+            std::swap(m_Height, other.m_Height);
+            std::swap(m_PresentMode, other.m_PresentMode);
+            std::swap(m_FrameIndex, other.m_FrameIndex);
+            std::swap(m_ImageIndex, other.m_ImageIndex);
+            std::swap(m_ClearColor, other.m_ClearColor);
+            std::swap(m_Images, other.m_Images);
+            std::swap(m_ImageViews, other.m_ImageViews);
+            std::swap(m_RenderFinishedSemaphores, other.m_RenderFinishedSemaphores);
+            std::swap(m_ImagesInFlight, other.m_ImagesInFlight);
+            std::swap(m_Frames, other.m_Frames);
+            std::swap(m_RetiredSwapchains, other.m_RetiredSwapchains);
+        }
+
+        return *this;
+    }
+
+    ~Swapchain() noexcept
+    {
+        if (!m_Handle)
+        {
+            return;
+        }
+
+        // The presentation engine may still wait on our semaphores, fences alone are not enough here
+        vkDeviceWaitIdle(m_Device);
+
+        for (auto && frame : m_Frames)
+        {
+            vkDestroyCommandPool(m_Device, frame.commandPool, HostAllocator::GetCallbacks());
+            vkDestroySemaphore(m_Device, frame.imageAvailableSemaphore, HostAllocator::GetCallbacks());
+            vkDestroyFence(m_Device, frame.inFlightFence, HostAllocator::GetCallbacks());
+        }
+
+        for (auto && retiredSwapchain : m_RetiredSwapchains)
+        {
+            Destroy(retiredSwapchain);
+        }
+
+        Destroy(RetiredSwapchain{ .handle                   = m_Handle,
+                                  .imageViews               = std::move(m_ImageViews),
+                                  .renderFinishedSemaphores = std::move(m_RenderFinishedSemaphores),
+                                  .remainingFrames          = 0 });
+    }
+
+    [[nodiscard]] bool AcquireNextImage()
+    {
+        constexpr auto noTimeout = std::numeric_limits<std::uint64_t>::max();
+
+        auto & frame = m_Frames[m_FrameIndex];
+
+        // Blocks only when the CPU is a whole ring of frames ahead of the GPU, which bounds the latency
+        if (vkWaitForFences(m_Device, 1, &frame.inFlightFence, VK_TRUE, noTimeout) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to wait for a frame fence");
+        }
+
+        ReleaseRetiredSwapchains();
+
+        auto result = vkAcquireNextImageKHR(m_Device, m_Handle, noTimeout, frame.imageAvailableSemaphore,
+                                            VK_NULL_HANDLE, &m_ImageIndex);
+        if (result == VK_ERROR_OUT_OF_DATE_KHR)
+        {
+            return false;
+        }
+        if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR)
+        {
+            throw std::runtime_error("Failed to acquire a swapchain image");
+        }
+
+        // With more images than frames an image can still be owned by an older frame
+        auto & imageFence = m_ImagesInFlight[m_ImageIndex];
+        if (imageFence != VK_NULL_HANDLE && imageFence != frame.inFlightFence)
+        {
+            if (vkWaitForFences(m_Device, 1, &imageFence, VK_TRUE, noTimeout) != VK_SUCCESS)
+            {
+                throw std::runtime_error("Failed to wait for a swapchain image fence");
+            }
+        }
+        imageFence = frame.inFlightFence;
+
+        return true;
+    }
+
+    [[nodiscard]] bool Present(Queue & graphicsQueue, Queue & presentationQueue, QueueSubmission && submission,
+                               GpuProfiler * gpuProfiler)
+    {
+        auto & frame = m_Frames[m_FrameIndex];
+
+        RecordCommandBuffer(frame, gpuProfiler);
+
+        auto renderFinishedSemaphore = m_RenderFinishedSemaphores[m_ImageIndex];
+
+        submission.commandBuffers.push_back(frame.commandBuffer);
+        submission.waitSemaphores.push_back(frame.imageAvailableSemaphore);
+        submission.waitValues.push_back(0);
+        submission.waitStages.push_back(VK_PIPELINE_STAGE_TRANSFER_BIT);
+        submission.signalSemaphores.push_back(renderFinishedSemaphore);
+        submission.signalValues.push_back(0);
+
+        if (vkResetFences(m_Device, 1, &frame.inFlightFence) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to reset a frame fence");
+        }
+
+        try
+        {
+            graphicsQueue.Submit(submission, frame.inFlightFence);
+        }
+        catch (...)
+        {
+            // Otherwise the next wait on this frame would never return
+            graphicsQueue.SignalFence(frame.inFlightFence);
+            throw;
+        }
+
+        // Different graphics and presentation families are ordered by the semaphore only, images are shared
+        // concurrently, so no ownership transfer and no CPU wait is needed between the two queues
+        auto presentInfo = VkPresentInfoKHR{ .sType              = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR,
+                                             .pNext              = nullptr,
+                                             .waitSemaphoreCount = 1,
+                                             .pWaitSemaphores    = &renderFinishedSemaphore,
+                                             .swapchainCount     = 1,
+                                             .pSwapchains        = &m_Handle,
+                                             .pImageIndices      = &m_ImageIndex,
+                                             .pResults           = nullptr };
+
+        auto result  = vkQueuePresentKHR(presentationQueue.GetHandle(), &presentInfo);
+        m_FrameIndex = (m_FrameIndex + 1) % static_cast<std::uint32_t>(m_Frames.size());
+
+        if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR)
+        {
+            return false;
+        }
+        if (result != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to present a swapchain image");
+        }
+
+        return true;
+    }
+
+    // The frames move on to the replacement, which keeps their fences and so the pacing of the frames in flight
+    [[nodiscard]] std::vector<Frame> TakeFrames() noexcept
+    {
+        return std::move(m_Frames);
+    }
+
+    // Leaves this swapchain empty, the replacement destroys the handles once the queued presents are done
+    [[nodiscard]] std::vector<RetiredSwapchain> Retire(std::uint32_t framesInFlight)
+    {
+        auto retiredSwapchains = std::move(m_RetiredSwapchains);
+        retiredSwapchains.push_back(
+            RetiredSwapchain{ .handle                   = std::exchange(m_Handle, VK_NULL_HANDLE),
+                              .imageViews               = std::move(m_ImageViews),
+                              .renderFinishedSemaphores = std::move(m_RenderFinishedSemaphores),
+                              .remainingFrames          = framesInFlight + 1 });
+
+        m_Images.clear();
+        m_ImagesInFlight.clear();
+        m_Frames.clear();
+
+        return retiredSwapchains;
+    }
+
+    [[nodiscard]] PresentMode GetPresentMode() const noexcept
+    {
+        return m_PresentMode;
+    }
+
+    [[nodiscard]] std::uint32_t GetFramesInFlight() const noexcept
+    {
+        return static_cast<std::uint32_t>(m_Frames.size());
+    }
+
+    [[nodiscard]] std::uint32_t GetFrameIndex() const noexcept
+    {
+        return m_FrameIndex;
+    }
+
+    [[nodiscard]] std::uint32_t GetImageCount() const noexcept
+    {
+        return static_cast<std::uint32_t>(m_Images.size());
+    }
+
+    [[nodiscard]] std::uint32_t GetImageIndex() const noexcept
+    {
+        return m_ImageIndex;
+    }
+
+    void SetClearColor(float red, float green, float blue, float alpha) noexcept
+    {
+        m_ClearColor = { red, green, blue, alpha };
+    }
+
+    [[nodiscard]] VkSwapchainKHR GetHandle() const noexcept
+    {
+        return m_Handle;
+    }
+
+    [[nodiscard]] VkFormat GetFormat() const noexcept
+    {
+        return m_Format;
+    }
+
+    [[nodiscard]] VkExtent2D GetExtent() const noexcept
+    {
+        return VkExtent2D{ .width = m_Width, .height = m_Height };
+    }
+
+    [[nodiscard]] VkImage GetImage() const noexcept
+    {
+        return m_Images[m_ImageIndex];
+    }
+
+    [[nodiscard]] VkImageView GetImageView() const noexcept
+    {
+        return m_ImageViews[m_ImageIndex];
+    }
+
+private:
+    // Called right after a frame fence wait, so a whole ring of them plus one means the submissions that fed the
+    // old presents have finished and the presents queued behind them were taken by the presentation engine
+    void ReleaseRetiredSwapchains() noexcept
+    {
+        for (auto && retiredSwapchain : m_RetiredSwapchains)
+        {
+            if (--retiredSwapchain.remainingFrames == 0)
+            {
+                Destroy(retiredSwapchain);
+            }
+        }
+
+        std::erase_if(m_RetiredSwapchains,
+                      [](const RetiredSwapchain & retiredSwapchain)
+                      {
+                          return retiredSwapchain.remainingFrames == 0;
+                      });
+    }
+
+    void Destroy(const RetiredSwapchain & retiredSwapchain) const noexcept
+    {
+        for (auto && semaphore : retiredSwapchain.renderFinishedSemaphores)
+        {
+            vkDestroySemaphore(m_Device, semaphore, HostAllocator::GetCallbacks());
+        }
+
+        for (auto && imageView : retiredSwapchain.imageViews)
+        {
+            vkDestroyImageView(m_Device, imageView, HostAllocator::GetCallbacks());
+        }
+
+        vkDestroySwapchainKHR(m_Device, retiredSwapchain.handle, HostAllocator::GetCallbacks());
+    }
+
+    void RecordCommandBuffer(Frame & frame, GpuProfiler * gpuProfiler) const
+    {
+        // The frame fence is signaled at this point, so the whole pool can be recycled at once
+        if (vkResetCommandPool(m_Device, frame.commandPool, 0) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to reset a frame command pool");
+        }
+
+        auto beginInfo = VkCommandBufferBeginInfo{ .sType            = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+                                                   .pNext            = nullptr,
+                                                   .flags            = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+                                                   .pInheritanceInfo = nullptr };
+        if (vkBeginCommandBuffer(frame.commandBuffer, &beginInfo) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to begin a frame command buffer");
+        }
+
+        if (gpuProfiler != nullptr)
+        {
+            gpuProfiler->BeginFrame(frame.commandBuffer, m_FrameIndex);
+            gpuProfiler->BeginScope(frame.commandBuffer, "Frame");
+        }
+
+        auto image = m_Images[m_ImageIndex];
+        auto range = VkImageSubresourceRange{ .aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT,
+                                              .baseMipLevel   = 0,
+                                              .levelCount     = 1,
+                                              .baseArrayLayer = 0,
+                                              .layerCount     = 1 };
+
+        auto toTransfer = VkImageMemoryBarrier{ .sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+                                                .pNext               = nullptr,
+                                                .srcAccessMask       = 0,
+                                                .dstAccessMask       = VK_ACCESS_TRANSFER_WRITE_BIT,
+                                                .oldLayout           = VK_IMAGE_LAYOUT_UNDEFINED,
+                                                .newLayout           = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                                .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                                                .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                                                .image               = image,
+                                                .subresourceRange    = range };
+        vkCmdPipelineBarrier(frame.commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0,
+                             nullptr, 0, nullptr, 1, &toTransfer);
+
+        auto clearColor = VkClearColorValue{
+            .float32 = { m_ClearColor[0], m_ClearColor[1], m_ClearColor[2], m_ClearColor[3] }
+        };
+        vkCmdClearColorImage(frame.commandBuffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &clearColor, 1, &range);
+
+        auto toPresent = VkImageMemoryBarrier{ .sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+                                               .pNext               = nullptr,
+                                               .srcAccessMask       = VK_ACCESS_TRANSFER_WRITE_BIT,
+                                               .dstAccessMask       = 0,
+                                               .oldLayout           = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                               .newLayout           = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR,
+                                               .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                                               .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                                               .image               = image,
+                                               .subresourceRange    = range };
+        vkCmdPipelineBarrier(frame.commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 0, nullptr, 1, &toPresent);
+
+        if (gpuProfiler != nullptr)
+        {
+            gpuProfiler->EndScope(frame.commandBuffer);
+        }
+
+        if (vkEndCommandBuffer(frame.commandBuffer) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to end a frame command buffer");
+        }
+    }
+
+private:
+    VkDevice                      m_Device;
+    VkSwapchainKHR                m_Handle;
+    VkFormat                      m_Format;
+    std::uint32_t                 m_Width;
+    std::uint32_t                 m_Height;
+    PresentMode                   m_PresentMode;
+    std::uint32_t                 m_FrameIndex;
+    std::uint32_t                 m_ImageIndex;
+    std::array<float, 4>          m_ClearColor;
+    std::vector<VkImage>          m_Images;
+    std::vector<VkImageView>      m_ImageViews;
+    std::vector<VkSemaphore>      m_RenderFinishedSemaphores;
+    std::vector<VkFence>          m_ImagesInFlight;
+    std::vector<Frame>            m_Frames;
+    std::vector<RetiredSwapchain> m_RetiredSwapchains;
+};
+} // namespace CuEngine::Vulkan::Impl
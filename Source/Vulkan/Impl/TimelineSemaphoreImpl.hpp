@@ -0,0 +1,142 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include "DeviceImpl.hpp"
+#include "HostAllocatorImpl.hpp"
+#include "LoaderImpl.hpp"
+
+#include <CuEngine/Vulkan/TimelineSemaphore.hpp>
+
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace CuEngine::Vulkan::Impl
+{
+class TimelineSemaphore
+{
+public:
+    explicit TimelineSemaphore(VkDevice device, VkSemaphore semaphore) noexcept
+        : m_Device(device), m_Handle(semaphore)
+    {}
+
+    TimelineSemaphore(const TimelineSemaphore & other) = delete;
+
+    TimelineSemaphore(TimelineSemaphore && other) noexcept
+        : m_Device(std::exchange(other.m_Device, VK_NULL_HANDLE)),
+          m_Handle(std::exchange(other.m_Handle, VK_NULL_HANDLE))
+    {}
+
+    TimelineSemaphore & operator=(const TimelineSemaphore & other) = delete;
+
+    TimelineSemaphore & operator=(TimelineSemaphore && other) noexcept
+    {
+        if (this != &other)
+        {
+            std::swap(m_Device, other.m_Device);
+            std::swap(m_Handle, other.m_Handle);
+        }
+
+        return *this;
+    }
+
+    ~TimelineSemaphore() noexcept
+    {
+        if (m_Handle)
+        {
+            vkDestroySemaphore(m_Device, m_Handle, HostAllocator::GetCallbacks());
+        }
+    }
+
+    [[nodiscard]] std::uint64_t GetValue() const
+    {
+        auto value = std::uint64_t();
+        if (vkGetSemaphoreCounterValue(m_Device, m_Handle, &value) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to get a timeline semaphore value");
+        }
+
+        return value;
+    }
+
+    void Wait(std::uint64_t value) const
+    {
+        auto waitInfo = VkSemaphoreWaitInfo{ .sType          = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO,
+                                             .pNext          = nullptr,
+                                             .flags          = 0,
+                                             .semaphoreCount = 1,
+                                             .pSemaphores    = &m_Handle,
+                                             .pValues        = &value };
+
+        if (vkWaitSemaphores(m_Device, &waitInfo, std::numeric_limits<std::uint64_t>::max()) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to wait for a timeline semaphore");
+        }
+    }
+
+    void Signal(std::uint64_t value)
+    {
+        auto signalInfo = VkSemaphoreSignalInfo{ .sType     = VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO,
+                                                 .pNext     = nullptr,
+                                                 .semaphore = m_Handle,
+                                                 .value     = value };
+
+        if (vkSignalSemaphore(m_Device, &signalInfo) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to signal a timeline semaphore");
+        }
+    }
+
+    [[nodiscard]] VkSemaphore GetHandle() const noexcept
+    {
+        return m_Handle;
+    }
+
+    [[nodiscard]] static TimelineSemaphore Create(VkDevice device, std::uint64_t initialValue)
+    {
+        auto typeInfo = VkSemaphoreTypeCreateInfo{ .sType         = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO,
+                                                   .pNext         = nullptr,
+                                                   .semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE,
+                                                   .initialValue  = initialValue };
+
+        auto semaphoreInfo = VkSemaphoreCreateInfo{ .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+                                                    .pNext = &typeInfo,
+                                                    .flags = 0 };
+
+        auto semaphore = VkSemaphore(VK_NULL_HANDLE);
+        if (vkCreateSemaphore(device, &semaphoreInfo, HostAllocator::GetCallbacks(), &semaphore) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create a timeline semaphore");
+        }
+
+        return TimelineSemaphore(device, semaphore);
+    }
+
+private:
+    VkDevice    m_Device;
+    VkSemaphore m_Handle;
+};
+} // namespace CuEngine::Vulkan::Impl
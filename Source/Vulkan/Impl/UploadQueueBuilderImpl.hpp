@@ -0,0 +1,156 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include "BufferBuilderImpl.hpp"
+#include "DeviceImpl.hpp"
+#include "HostAllocatorImpl.hpp"
+#include "LoaderImpl.hpp"
+#include "QueueFamilyImpl.hpp"
+#include "QueueImpl.hpp"
+#include "TimelineSemaphoreImpl.hpp"
+#include "UploadQueueImpl.hpp"
+
+#include <CuEngine/Vulkan/UploadQueueBuilder.hpp>
+
+#include <stdexcept>
+#include <vector>
+
+namespace CuEngine::Vulkan::Impl
+{
+class UploadQueueBuilder
+{
+public:
+    explicit UploadQueueBuilder() noexcept
+        : m_Device(nullptr), m_Queue(VK_NULL_HANDLE), m_QueueFamilyIndex(0), m_StagingSize(16 * 1024 * 1024)
+    {}
+
+    UploadQueueBuilder(const UploadQueueBuilder & other) = default;
+
+    UploadQueueBuilder(UploadQueueBuilder && other) noexcept = default;
+
+    UploadQueueBuilder & operator=(const UploadQueueBuilder & other) = default;
+
+    UploadQueueBuilder & operator=(UploadQueueBuilder && other) noexcept = default;
+
+    ~UploadQueueBuilder() noexcept = default;
+
+    UploadQueueBuilder & SetDevice(Device & device) noexcept
+    {
+        m_Device = &device;
+
+        return *this;
+    }
+
+    UploadQueueBuilder & SetQueue(Queue & queue, const QueueFamily & queueFamily) noexcept
+    {
+        m_Queue            = queue.GetHandle();
+        m_QueueFamilyIndex = queueFamily.GetIndex();
+
+        return *this;
+    }
+
+    UploadQueueBuilder & SetStagingSize(VkDeviceSize stagingSize) noexcept
+    {
+        m_StagingSize = stagingSize;
+
+        return *this;
+    }
+
+    [[nodiscard]] UploadQueue Build() const
+    {
+        if (m_Device == nullptr || m_Queue == VK_NULL_HANDLE || m_StagingSize < UploadQueue::stagingAlignment * 2)
+        {
+            throw std::runtime_error("Failed to create an upload queue: invalid configuration");
+        }
+
+        auto device        = m_Device->GetHandle();
+        auto stagingBuffer = BufferBuilder()
+                                 .SetDevice(*m_Device)
+                                 .SetSize(m_StagingSize)
+                                 .SetUsage(BufferUsage::TransferSource)
+                                 .SetMemoryUsage(MemoryUsage::CpuToGpu)
+                                 .Build();
+
+        auto semaphore   = TimelineSemaphore::Create(device, 0);
+        auto submissions = std::vector<UploadQueue::Submission>();
+        try
+        {
+            for (auto index = 0u; index < UploadQueue::submissionCount; ++index)
+            {
+                submissions.push_back(CreateSubmission(device));
+            }
+        }
+        catch (...)
+        {
+            for (auto && submission : submissions)
+            {
+                vkDestroyCommandPool(device, submission.commandPool, HostAllocator::GetCallbacks());
+            }
+            throw;
+        }
+
+        return UploadQueue(device, m_Queue, std::move(semaphore), std::move(stagingBuffer), std::move(submissions));
+    }
+
+private:
+    [[nodiscard]] UploadQueue::Submission CreateSubmission(VkDevice device) const
+    {
+        auto poolInfo = VkCommandPoolCreateInfo{ .sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+                                                 .pNext            = nullptr,
+                                                 .flags            = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT,
+                                                 .queueFamilyIndex = m_QueueFamilyIndex };
+
+        auto submission =
+            UploadQueue::Submission{ .commandPool = VK_NULL_HANDLE, .commandBuffer = VK_NULL_HANDLE, .value = 0 };
+        if (vkCreateCommandPool(device, &poolInfo, HostAllocator::GetCallbacks(), &submission.commandPool)
+            != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create an upload command pool");
+        }
+
+        auto allocateInfo = VkCommandBufferAllocateInfo{
+            .sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+            .pNext              = nullptr,
+            .commandPool        = submission.commandPool,
+            .level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+            .commandBufferCount = 1,
+        };
+        if (vkAllocateCommandBuffers(device, &allocateInfo, &submission.commandBuffer) != VK_SUCCESS)
+        {
+            vkDestroyCommandPool(device, submission.commandPool, HostAllocator::GetCallbacks());
+            throw std::runtime_error("Failed to allocate an upload command buffer");
+        }
+
+        return submission;
+    }
+
+private:
+    Device *      m_Device;
+    VkQueue       m_Queue;
+    std::uint32_t m_QueueFamilyIndex;
+    VkDeviceSize  m_StagingSize;
+};
+} // namespace CuEngine::Vulkan::Impl
@@ -0,0 +1,333 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include "BufferImpl.hpp"
+#include "HostAllocatorImpl.hpp"
+#include "LoaderImpl.hpp"
+#include "TimelineSemaphoreImpl.hpp"
+
+#include <CuEngine/Vulkan/TimelineSemaphore.hpp>
+#include <CuEngine/Vulkan/UploadQueue.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace CuEngine::Vulkan::Impl
+{
+class UploadQueue
+{
+public:
+    static constexpr auto submissionCount  = 4u;
+    static constexpr auto stagingAlignment = VkDeviceSize(16);
+
+    struct Submission
+    {
+        VkCommandPool   commandPool;
+        VkCommandBuffer commandBuffer;
+        std::uint64_t   value;
+    };
+
+private:
+    struct PendingCopy
+    {
+        VkBuffer     destination;
+        VkBufferCopy region;
+    };
+
+    struct InFlightRange
+    {
+        std::uint64_t value;
+        VkDeviceSize  stagingEnd;
+    };
+
+    // Staging positions only ever grow, the ring offset is the position modulo the staging size
+    struct State
+    {
+        VkDevice                  device;
+        VkQueue                   queue;
+        Vulkan::TimelineSemaphore semaphore;
+        Buffer                    stagingBuffer;
+        std::byte *               stagingData;
+        VkDeviceSize              stagingSize;
+        VkDeviceSize              stagingHead;
+        VkDeviceSize              stagingTail;
+        std::uint64_t             nextValue;
+        std::vector<Submission>   submissions;
+        std::vector<PendingCopy>  pendingCopies;
+        std::deque<InFlightRange> inFlightRanges;
+        std::mutex                mutex;
+    };
+
+public:
+    explicit UploadQueue(VkDevice device, VkQueue queue, TimelineSemaphore && semaphore, Buffer && stagingBuffer,
+                         std::vector<Submission> && submissions)
+        : m_State(new State{ .device         = device,
+                             .queue          = queue,
+                             .semaphore      = Vulkan::TimelineSemaphore(std::move(semaphore)),
+                             .stagingBuffer  = std::move(stagingBuffer),
+                             .stagingData    = nullptr,
+                             .stagingSize    = 0,
+                             .stagingHead    = 0,
+                             .stagingTail    = 0,
+                             .nextValue      = 1,
+                             .submissions    = std::move(submissions),
+                             .pendingCopies  = {},
+                             .inFlightRanges = {},
+                             .mutex          = {} })
+    {
+        m_State->stagingData = static_cast<std::byte *>(m_State->stagingBuffer.GetMappedData());
+        m_State->stagingSize = m_State->stagingBuffer.GetSize();
+    }
+
+    UploadQueue(const UploadQueue & other) = delete;
+
+    UploadQueue(UploadQueue && other) noexcept = default;
+
+    UploadQueue & operator=(const UploadQueue & other) = delete;
+
+    UploadQueue & operator=(UploadQueue && other) noexcept
+    {
+        if (this != &other)
+        {
+            std::swap(m_State, other.m_State);
+        }
+
+        return *this;
+    }
+
+    ~UploadQueue() noexcept
+    {
+        if (!m_State)
+        {
+            return;
+        }
+
+        // Only submitted batches are waited for, copies that were never flushed are dropped
+        auto lastValue = m_State->nextValue - 1;
+        WaitValue(lastValue);
+
+        for (auto && submission : m_State->submissions)
+        {
+            vkDestroyCommandPool(m_State->device, submission.commandPool, HostAllocator::GetCallbacks());
+        }
+    }
+
+    [[nodiscard]] std::uint64_t Upload(VkBuffer destination, VkDeviceSize offset, const void * data, VkDeviceSize size)
+    {
+        auto lock = std::scoped_lock(m_State->mutex);
+
+        // Larger uploads are split so that a chunk always fits once older batches have retired
+        auto maxChunkSize = m_State->stagingSize / 2;
+        auto source       = static_cast<const std::byte *>(data);
+        for (auto copied = VkDeviceSize(0); copied < size;)
+        {
+            auto chunkSize     = std::min(size - copied, maxChunkSize);
+            auto stagingOffset = AllocateStaging(chunkSize);
+            std::memcpy(m_State->stagingData + stagingOffset, source + copied, chunkSize);
+
+            m_State->pendingCopies.push_back(PendingCopy{ .destination = destination,
+                                                          .region      = VkBufferCopy{ .srcOffset = stagingOffset,
+                                                                                       .dstOffset = offset + copied,
+                                                                                       .size      = chunkSize } });
+            copied += chunkSize;
+        }
+
+        return m_State->nextValue;
+    }
+
+    std::uint64_t Flush()
+    {
+        auto lock = std::scoped_lock(m_State->mutex);
+
+        return FlushLocked();
+    }
+
+    [[nodiscard]] bool IsComplete(std::uint64_t value) const
+    {
+        return GetCompletedValue() >= value;
+    }
+
+    void Wait(std::uint64_t value)
+    {
+        {
+            auto lock = std::scoped_lock(m_State->mutex);
+            if (value >= m_State->nextValue)
+            {
+                FlushLocked();
+            }
+        }
+
+        WaitValue(value);
+    }
+
+    [[nodiscard]] const Vulkan::TimelineSemaphore & GetSemaphore() const noexcept
+    {
+        return m_State->semaphore;
+    }
+
+private:
+    [[nodiscard]] std::uint64_t GetCompletedValue() const
+    {
+        return m_State->semaphore.GetValue();
+    }
+
+    void WaitValue(std::uint64_t value) const noexcept
+    {
+        auto semaphore = m_State->semaphore.GetImpl().GetHandle();
+        auto waitInfo = VkSemaphoreWaitInfo{ .sType          = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO,
+                                             .pNext          = nullptr,
+                                             .flags          = 0,
+                                             .semaphoreCount = 1,
+                                             .pSemaphores    = &semaphore,
+                                             .pValues        = &value };
+
+        static_cast<void>(vkWaitSemaphores(m_State->device, &waitInfo, std::numeric_limits<std::uint64_t>::max()));
+    }
+
+    [[nodiscard]] VkDeviceSize AllocateStaging(VkDeviceSize size)
+    {
+        auto & state = *m_State;
+
+        auto head = (state.stagingHead + stagingAlignment - 1) & ~(stagingAlignment - 1);
+        if (head % state.stagingSize + size > state.stagingSize)
+        {
+            // Never wrap inside a copy, the rest of the ring is skipped instead
+            head += state.stagingSize - head % state.stagingSize;
+        }
+
+        while (head + size - state.stagingTail > state.stagingSize)
+        {
+            if (state.inFlightRanges.empty() && state.pendingCopies.empty())
+            {
+                state.stagingTail = head;
+                continue;
+            }
+
+            if (state.inFlightRanges.empty())
+            {
+                FlushLocked();
+            }
+
+            auto oldest = state.inFlightRanges.front();
+            WaitValue(oldest.value);
+            state.stagingTail = oldest.stagingEnd;
+            state.inFlightRanges.pop_front();
+        }
+
+        state.stagingHead = head + size;
+
+        return head % state.stagingSize;
+    }
+
+    std::uint64_t FlushLocked()
+    {
+        auto & state = *m_State;
+        if (state.pendingCopies.empty())
+        {
+            return state.nextValue - 1;
+        }
+
+        auto   value      = state.nextValue;
+        auto & submission = state.submissions[value % submissionCount];
+        WaitValue(submission.value);
+
+        if (vkResetCommandPool(state.device, submission.commandPool, 0) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to reset an upload command pool");
+        }
+
+        auto beginInfo = VkCommandBufferBeginInfo{ .sType            = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+                                                   .pNext            = nullptr,
+                                                   .flags            = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+                                                   .pInheritanceInfo = nullptr };
+        if (vkBeginCommandBuffer(submission.commandBuffer, &beginInfo) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to begin an upload command buffer");
+        }
+
+        // One copy command per destination buffer
+        std::ranges::stable_sort(state.pendingCopies, {}, &PendingCopy::destination);
+        auto regions = std::vector<VkBufferCopy>();
+        for (auto copyIt = state.pendingCopies.begin(); copyIt != state.pendingCopies.end();)
+        {
+            auto destination = copyIt->destination;
+            regions.clear();
+            for (; copyIt != state.pendingCopies.end() && copyIt->destination == destination; ++copyIt)
+            {
+                regions.push_back(copyIt->region);
+            }
+
+            vkCmdCopyBuffer(submission.commandBuffer, state.stagingBuffer.GetHandle(), destination,
+                            static_cast<std::uint32_t>(regions.size()), regions.data());
+        }
+
+        if (vkEndCommandBuffer(submission.commandBuffer) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to end an upload command buffer");
+        }
+
+        auto timelineInfo = VkTimelineSemaphoreSubmitInfo{ .sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
+                                                           .pNext = nullptr,
+                                                           .waitSemaphoreValueCount   = 0,
+                                                           .pWaitSemaphoreValues      = nullptr,
+                                                           .signalSemaphoreValueCount = 1,
+                                                           .pSignalSemaphoreValues    = &value };
+
+        auto semaphore  = state.semaphore.GetImpl().GetHandle();
+        auto submitInfo = VkSubmitInfo{ .sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+                                        .pNext                = &timelineInfo,
+                                        .waitSemaphoreCount   = 0,
+                                        .pWaitSemaphores      = nullptr,
+                                        .pWaitDstStageMask    = nullptr,
+                                        .commandBufferCount   = 1,
+                                        .pCommandBuffers      = &submission.commandBuffer,
+                                        .signalSemaphoreCount = 1,
+                                        .pSignalSemaphores    = &semaphore };
+
+        if (vkQueueSubmit(state.queue, 1, &submitInfo, VK_NULL_HANDLE) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to submit uploads");
+        }
+
+        submission.value = value;
+        state.inFlightRanges.push_back(InFlightRange{ .value = value, .stagingEnd = state.stagingHead });
+        state.pendingCopies.clear();
+        ++state.nextValue;
+
+        return value;
+    }
+
+private:
+    std::unique_ptr<State> m_State;
+};
+} // namespace CuEngine::Vulkan::Impl
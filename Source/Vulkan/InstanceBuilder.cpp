@@ -37,6 +37,13 @@ InstanceBuilder & InstanceBuilder::operator=(InstanceBuilder && other) noexcept
 
 InstanceBuilder::~InstanceBuilder() noexcept = default;
 
+InstanceBuilder & InstanceBuilder::SetHeadless(bool isHeadless) noexcept
+{
+    m_Pimpl->SetHeadless(isHeadless);
+
+    return *this;
+}
+
 Instance InstanceBuilder::Build() const
 {
     return Instance(m_Pimpl->Build());
@@ -0,0 +1,107 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Impl/LoaderImpl.hpp"
+
+#include <mutex>
+#include <stdexcept>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+#define CU_VULKAN_DEFINE_FUNCTION(name) PFN_##name name = nullptr;
+
+PFN_vkGetInstanceProcAddr vkGetInstanceProcAddr = nullptr;
+CU_VULKAN_GLOBAL_FUNCTIONS(CU_VULKAN_DEFINE_FUNCTION)
+CU_VULKAN_INSTANCE_FUNCTIONS(CU_VULKAN_DEFINE_FUNCTION)
+CU_VULKAN_DEVICE_FUNCTIONS(CU_VULKAN_DEFINE_FUNCTION)
+
+#undef CU_VULKAN_DEFINE_FUNCTION
+
+namespace CuEngine::Vulkan::Impl
+{
+// The library stays loaded until the process exits, as the function pointers may be used until then
+static PFN_vkGetInstanceProcAddr LoadLibraryEntryPoint()
+{
+#if defined(_WIN32)
+    auto library = LoadLibraryA("vulkan-1.dll");
+    if (library == nullptr)
+    {
+        return nullptr;
+    }
+
+    return reinterpret_cast<PFN_vkGetInstanceProcAddr>(GetProcAddress(library, "vkGetInstanceProcAddr"));
+#else
+#if defined(__APPLE__)
+    constexpr const char * libraryNames[] = { "libvulkan.dylib", "libvulkan.1.dylib", "libMoltenVK.dylib" };
+#else
+    constexpr const char * libraryNames[] = { "libvulkan.so.1", "libvulkan.so" };
+#endif
+    for (auto libraryName : libraryNames)
+    {
+        if (auto library = dlopen(libraryName, RTLD_NOW | RTLD_LOCAL))
+        {
+            return reinterpret_cast<PFN_vkGetInstanceProcAddr>(dlsym(library, "vkGetInstanceProcAddr"));
+        }
+    }
+
+    return nullptr;
+#endif
+}
+
+void Loader::Initialize()
+{
+    static auto once = std::once_flag();
+    std::call_once(once,
+                   []()
+                   {
+                       vkGetInstanceProcAddr = LoadLibraryEntryPoint();
+                       if (vkGetInstanceProcAddr == nullptr)
+                       {
+                           throw std::runtime_error("Failed to load the Vulkan library");
+                       }
+
+#define CU_VULKAN_LOAD_FUNCTION(name) name = reinterpret_cast<PFN_##name>(vkGetInstanceProcAddr(nullptr, #name));
+                       CU_VULKAN_GLOBAL_FUNCTIONS(CU_VULKAN_LOAD_FUNCTION)
+#undef CU_VULKAN_LOAD_FUNCTION
+                   });
+}
+
+void Loader::LoadInstance(VkInstance instance)
+{
+#define CU_VULKAN_LOAD_FUNCTION(name) name = reinterpret_cast<PFN_##name>(vkGetInstanceProcAddr(instance, #name));
+    CU_VULKAN_INSTANCE_FUNCTIONS(CU_VULKAN_LOAD_FUNCTION)
+#undef CU_VULKAN_LOAD_FUNCTION
+}
+
+void Loader::LoadDevice(VkDevice device)
+{
+#define CU_VULKAN_LOAD_FUNCTION(name) name = reinterpret_cast<PFN_##name>(vkGetDeviceProcAddr(device, #name));
+    CU_VULKAN_DEVICE_FUNCTIONS(CU_VULKAN_LOAD_FUNCTION)
+#undef CU_VULKAN_LOAD_FUNCTION
+}
+} // namespace CuEngine::Vulkan::Impl
@@ -0,0 +1,74 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Impl/OffscreenTargetImpl.hpp"
+
+namespace CuEngine::Vulkan
+{
+
+OffscreenTarget::OffscreenTarget(Impl::OffscreenTarget && offscreenTarget) noexcept
+    : m_Pimpl(std::move(offscreenTarget))
+{}
+
+OffscreenTarget::OffscreenTarget(OffscreenTarget && other) noexcept = default;
+
+OffscreenTarget & OffscreenTarget::operator=(OffscreenTarget && other) noexcept = default;
+
+OffscreenTarget::~OffscreenTarget() noexcept = default;
+
+bool OffscreenTarget::AcquireNextImage()
+{
+    return m_Pimpl->AcquireNextImage();
+}
+
+void OffscreenTarget::Submit(Queue & graphicsQueue, const std::vector<TimelineWait> & waits, GpuProfiler * gpuProfiler)
+{
+    m_Pimpl->Submit(graphicsQueue.getImpl(), Impl::QueueSubmission::Create(waits, {}),
+                    gpuProfiler != nullptr ? &gpuProfiler->GetImpl() : nullptr);
+}
+
+void OffscreenTarget::WaitIdle()
+{
+    m_Pimpl->WaitIdle();
+}
+
+std::uint32_t OffscreenTarget::GetFramesInFlight() const noexcept
+{
+    return m_Pimpl->GetFramesInFlight();
+}
+
+std::uint32_t OffscreenTarget::GetFrameIndex() const noexcept
+{
+    return m_Pimpl->GetFrameIndex();
+}
+
+const Image & OffscreenTarget::GetImage() const noexcept
+{
+    return m_Pimpl->GetImage();
+}
+
+Impl::OffscreenTarget & OffscreenTarget::GetImpl() noexcept
+{
+    return *m_Pimpl;
+}
+
+} // namespace CuEngine::Vulkan
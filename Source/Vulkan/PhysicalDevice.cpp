@@ -22,6 +22,7 @@
 
 #include <iterator>
 
+#include "Impl/LoaderImpl.hpp"
 #include "Impl/PhysicalDeviceImpl.hpp"
 
 namespace CuEngine::Vulkan
@@ -45,6 +46,51 @@ std::string PhysicalDevice::GetName() const
     return m_Pimpl->GetName();
 }
 
+float PhysicalDevice::GetTimestampPeriod() const
+{
+    return m_Pimpl->GetTimestampPeriod();
+}
+
+PhysicalDeviceType PhysicalDevice::GetType() const noexcept
+{
+    return m_Pimpl->GetType();
+}
+
+std::string PhysicalDevice::GetUuid() const
+{
+    return m_Pimpl->GetUuid();
+}
+
+std::uint32_t PhysicalDevice::GetApiVersion() const noexcept
+{
+    return m_Pimpl->GetApiVersion();
+}
+
+std::uint64_t PhysicalDevice::GetDeviceLocalMemorySize() const noexcept
+{
+    return m_Pimpl->GetDeviceLocalMemorySize();
+}
+
+bool PhysicalDevice::HasExtension(std::string_view name) const noexcept
+{
+    return m_Pimpl->HasExtension(name);
+}
+
+bool PhysicalDevice::HasTimelineSemaphoreSupport() const noexcept
+{
+    return m_Pimpl->HasTimelineSemaphoreSupport();
+}
+
+bool PhysicalDevice::HasSynchronization2Support() const noexcept
+{
+    return m_Pimpl->HasSynchronization2Support();
+}
+
+bool PhysicalDevice::HasPipelineStatisticsSupport() const noexcept
+{
+    return m_Pimpl->HasPipelineStatisticsSupport();
+}
+
 Impl::PhysicalDevice & PhysicalDevice::GetImpl() noexcept
 {
     return *m_Pimpl;
@@ -64,12 +110,14 @@ std::vector<PhysicalDevice> PhysicalDevice::Enumerate(Instance & instance)
         throw std::runtime_error("No physical device found");
     }
 
+    // Each device is queried once here, every copy of it shares the same snapshot
     auto devices = std::vector<PhysicalDevice>();
     devices.reserve(count);
     std::ranges::transform(devicePointers, std::back_inserter(devices),
                            [](auto deviceHandle)
                            {
-                               return PhysicalDevice(Impl::PhysicalDevice(deviceHandle));
+                               auto info = Impl::PhysicalDeviceInfo::Create(deviceHandle);
+                               return PhysicalDevice(Impl::PhysicalDevice(std::move(info)));
                            });
 
     return devices;
@@ -20,6 +20,7 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+#include "Impl/CommandBufferImpl.hpp"
 #include "Impl/QueueImpl.hpp"
 
 namespace CuEngine::Vulkan
@@ -34,6 +35,18 @@ Queue & Queue::operator=(Queue && other) noexcept = default;
 
 Queue::~Queue() noexcept = default;
 
+void Queue::Submit(const std::vector<CommandBuffer> & commandBuffers, const std::vector<TimelineWait> & waits,
+                   const std::vector<TimelineSignal> & signals)
+{
+    auto submission = Impl::QueueSubmission::Create(waits, signals);
+    for (auto && commandBuffer : commandBuffers)
+    {
+        submission.commandBuffers.push_back(commandBuffer.GetImpl().GetHandle());
+    }
+
+    m_Pimpl->Submit(submission);
+}
+
 Impl::Queue & Queue::getImpl() noexcept
 {
     return *m_Pimpl;
@@ -20,8 +20,7 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
-#include <iterator>
-
+#include "Impl/PhysicalDeviceImpl.hpp"
 #include "Impl/QueueFamilyImpl.hpp"
 
 namespace CuEngine::Vulkan
@@ -45,11 +44,36 @@ bool QueueFamily::HasGraphicsSupport() const noexcept
     return m_Pimpl->HasGraphicsSupport();
 }
 
+bool QueueFamily::HasTransferSupport() const noexcept
+{
+    return m_Pimpl->HasTransferSupport();
+}
+
+bool QueueFamily::HasComputeSupport() const noexcept
+{
+    return m_Pimpl->HasComputeSupport();
+}
+
+bool QueueFamily::IsTransferOnly() const noexcept
+{
+    return m_Pimpl->IsTransferOnly();
+}
+
+bool QueueFamily::IsComputeOnly() const noexcept
+{
+    return m_Pimpl->IsComputeOnly();
+}
+
 [[nodiscard]] bool QueueFamily::HasSurfaceSupport(Surface & surface) const
 {
     return m_Pimpl->HasSurfaceSupport(surface.getImpl());
 }
 
+std::uint32_t QueueFamily::GetIndex() const noexcept
+{
+    return m_Pimpl->GetIndex();
+}
+
 Impl::QueueFamily & QueueFamily::GetImpl() noexcept
 {
     return *m_Pimpl;
@@ -67,20 +91,15 @@ bool QueueFamily::operator<(const QueueFamily & queueFamily) const noexcept
 
 std::vector<QueueFamily> QueueFamily::Enumerate(PhysicalDevice & device)
 {
-    auto count = std::uint32_t();
-    vkGetPhysicalDeviceQueueFamilyProperties(device.GetImpl().GetHandle(), &count, nullptr);
-
-    auto queueFamiliesPointers = std::vector<VkQueueFamilyProperties>(count);
-    vkGetPhysicalDeviceQueueFamilyProperties(device.GetImpl().GetHandle(), &count, queueFamiliesPointers.data());
+    const auto & info  = device.GetImpl().GetSharedInfo();
+    auto         count = static_cast<std::uint32_t>(info->GetQueueFamilies().size());
 
     auto queueFamilies = std::vector<QueueFamily>();
     queueFamilies.reserve(count);
-    std::ranges::transform(queueFamiliesPointers, std::back_inserter(queueFamilies),
-                           [&device, index = 0](auto queueFamiliesProperty) mutable
-                           {
-                               return QueueFamily(Impl::QueueFamily(device.GetImpl().GetHandle(),
-                                                                    queueFamiliesProperty.queueFlags, index));
-                           });
+    for (auto index = 0u; index < count; ++index)
+    {
+        queueFamilies.emplace_back(Impl::QueueFamily(info, index));
+    }
 
     return queueFamilies;
 }
@@ -0,0 +1,66 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "Impl/RenderGraphImpl.hpp"
+
+namespace CuEngine::Vulkan
+{
+
+RenderGraph::RenderGraph(Impl::RenderGraph && renderGraph) noexcept : m_Pimpl(std::move(renderGraph))
+{}
+
+RenderGraph::RenderGraph(RenderGraph && other) noexcept = default;
+
+RenderGraph & RenderGraph::operator=(RenderGraph && other) noexcept = default;
+
+RenderGraph::~RenderGraph() noexcept = default;
+
+void RenderGraph::Execute(CommandBuffer & commandBuffer) const
+{
+    m_Pimpl->Execute(commandBuffer, *this);
+}
+
+const Image & RenderGraph::GetImage(ImageHandle image) const noexcept
+{
+    return m_Pimpl->GetImage(image);
+}
+
+const Buffer & RenderGraph::GetBuffer(BufferHandle buffer) const noexcept
+{
+    return m_Pimpl->GetBuffer(buffer);
+}
+
+RenderGraphStatistics RenderGraph::GetStatistics() const noexcept
+{
+    return m_Pimpl->GetStatistics();
+}
+
+Impl::RenderGraph & RenderGraph::GetImpl() noexcept
+{
+    return *m_Pimpl;
+}
+
+const Impl::RenderGraph & RenderGraph::GetImpl() const noexcept
+{
+    return *m_Pimpl;
+}
+
+} // namespace CuEngine::Vulkan
@@ -0,0 +1,77 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "Impl/RenderGraphBuilderImpl.hpp"
+
+namespace CuEngine::Vulkan
+{
+RenderGraphBuilder::RenderGraphBuilder() = default;
+
+RenderGraphBuilder::RenderGraphBuilder(const RenderGraphBuilder & other) = default;
+
+RenderGraphBuilder::RenderGraphBuilder(RenderGraphBuilder && other) noexcept = default;
+
+RenderGraphBuilder & RenderGraphBuilder::operator=(const RenderGraphBuilder & other) = default;
+
+RenderGraphBuilder & RenderGraphBuilder::operator=(RenderGraphBuilder && other) noexcept = default;
+
+RenderGraphBuilder::~RenderGraphBuilder() noexcept = default;
+
+RenderGraphBuilder & RenderGraphBuilder::SetDevice(Device & device) noexcept
+{
+    m_Pimpl->SetDevice(device.getImpl());
+
+    return *this;
+}
+
+ImageHandle RenderGraphBuilder::CreateImage(const ImageDescription & description)
+{
+    return m_Pimpl->CreateImage(description);
+}
+
+ImageHandle RenderGraphBuilder::ImportImage(const Image & image, ImageAccess initialAccess, ImageAccess finalAccess)
+{
+    return m_Pimpl->ImportImage(image, initialAccess, finalAccess);
+}
+
+BufferHandle RenderGraphBuilder::ImportBuffer(const Buffer & buffer, BufferAccess initialAccess)
+{
+    return m_Pimpl->ImportBuffer(buffer, initialAccess);
+}
+
+RenderGraphBuilder & RenderGraphBuilder::AddPass(const RenderPassDescription & pass)
+{
+    m_Pimpl->AddPass(pass);
+
+    return *this;
+}
+
+RenderGraph RenderGraphBuilder::Build() const
+{
+    return RenderGraph(m_Pimpl->Build());
+}
+
+Impl::RenderGraphBuilder & RenderGraphBuilder::GetImpl() noexcept
+{
+    return *m_Pimpl;
+}
+
+} // namespace CuEngine::Vulkan
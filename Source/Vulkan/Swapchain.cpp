@@ -0,0 +1,95 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Impl/SwapchainImpl.hpp"
+
+namespace CuEngine::Vulkan
+{
+
+Swapchain::Swapchain(Impl::Swapchain && swapchain) noexcept : m_Pimpl(std::move(swapchain))
+{}
+
+Swapchain::Swapchain(Swapchain && other) noexcept = default;
+
+Swapchain & Swapchain::operator=(Swapchain && other) noexcept = default;
+
+Swapchain::~Swapchain() noexcept = default;
+
+bool Swapchain::AcquireNextImage()
+{
+    return m_Pimpl->AcquireNextImage();
+}
+
+bool Swapchain::Present(Queue & graphicsQueue, Queue & presentationQueue, const std::vector<TimelineWait> & waits,
+                        GpuProfiler * gpuProfiler)
+{
+    return m_Pimpl->Present(graphicsQueue.getImpl(), presentationQueue.getImpl(),
+                            Impl::QueueSubmission::Create(waits, {}),
+                            gpuProfiler != nullptr ? &gpuProfiler->GetImpl() : nullptr);
+}
+
+PresentMode Swapchain::GetPresentMode() const noexcept
+{
+    return m_Pimpl->GetPresentMode();
+}
+
+std::uint32_t Swapchain::GetFramesInFlight() const noexcept
+{
+    return m_Pimpl->GetFramesInFlight();
+}
+
+std::uint32_t Swapchain::GetFrameIndex() const noexcept
+{
+    return m_Pimpl->GetFrameIndex();
+}
+
+std::uint32_t Swapchain::GetImageCount() const noexcept
+{
+    return m_Pimpl->GetImageCount();
+}
+
+std::uint32_t Swapchain::GetImageIndex() const noexcept
+{
+    return m_Pimpl->GetImageIndex();
+}
+
+void Swapchain::SetClearColor(float red, float green, float blue, float alpha) noexcept
+{
+    m_Pimpl->SetClearColor(red, green, blue, alpha);
+}
+
+std::uint32_t Swapchain::GetWidth() const noexcept
+{
+    return m_Pimpl->GetExtent().width;
+}
+
+std::uint32_t Swapchain::GetHeight() const noexcept
+{
+    return m_Pimpl->GetExtent().height;
+}
+
+Impl::Swapchain & Swapchain::GetImpl() noexcept
+{
+    return *m_Pimpl;
+}
+
+} // namespace CuEngine::Vulkan
@@ -0,0 +1,105 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Impl/SwapchainBuilderImpl.hpp"
+
+namespace CuEngine::Vulkan
+{
+SwapchainBuilder::SwapchainBuilder() = default;
+
+SwapchainBuilder::SwapchainBuilder(const SwapchainBuilder & other) = default;
+
+SwapchainBuilder::SwapchainBuilder(SwapchainBuilder && other) noexcept = default;
+
+SwapchainBuilder & SwapchainBuilder::operator=(const SwapchainBuilder & other) = default;
+
+SwapchainBuilder & SwapchainBuilder::operator=(SwapchainBuilder && other) noexcept = default;
+
+SwapchainBuilder::~SwapchainBuilder() noexcept = default;
+
+SwapchainBuilder & SwapchainBuilder::SetPhysicalDevice(PhysicalDevice & physicalDevice) noexcept
+{
+    m_Pimpl->SetPhysicalDevice(physicalDevice.GetImpl());
+
+    return *this;
+}
+
+SwapchainBuilder & SwapchainBuilder::SetDevice(Device & device) noexcept
+{
+    m_Pimpl->SetDevice(device.getImpl());
+
+    return *this;
+}
+
+SwapchainBuilder & SwapchainBuilder::SetSurface(Surface & surface) noexcept
+{
+    m_Pimpl->SetSurface(surface.getImpl());
+
+    return *this;
+}
+
+SwapchainBuilder & SwapchainBuilder::SetWindow(Platform::Window & window) noexcept
+{
+    m_Pimpl->SetWindow(window.GetImpl());
+
+    return *this;
+}
+
+SwapchainBuilder & SwapchainBuilder::SetQueueFamilies(const QueueFamily & graphicsQueueFamily,
+                                                      const QueueFamily & presentationQueueFamily)
+{
+    m_Pimpl->SetQueueFamilies(graphicsQueueFamily.GetImpl(), presentationQueueFamily.GetImpl());
+
+    return *this;
+}
+
+SwapchainBuilder & SwapchainBuilder::SetPresentModes(const std::vector<PresentMode> & presentModes)
+{
+    m_Pimpl->SetPresentModes(presentModes);
+
+    return *this;
+}
+
+SwapchainBuilder & SwapchainBuilder::SetFramesInFlight(std::uint32_t framesInFlight) noexcept
+{
+    m_Pimpl->SetFramesInFlight(framesInFlight);
+
+    return *this;
+}
+
+SwapchainBuilder & SwapchainBuilder::SetOldSwapchain(Swapchain & swapchain) noexcept
+{
+    m_Pimpl->SetOldSwapchain(swapchain.GetImpl());
+
+    return *this;
+}
+
+Swapchain SwapchainBuilder::Build() const
+{
+    return Swapchain(m_Pimpl->Build());
+}
+
+Impl::SwapchainBuilder & SwapchainBuilder::GetImpl() noexcept
+{
+    return *m_Pimpl;
+}
+} // namespace CuEngine::Vulkan
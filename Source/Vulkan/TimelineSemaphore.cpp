@@ -0,0 +1,68 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Impl/TimelineSemaphoreImpl.hpp"
+
+namespace CuEngine::Vulkan
+{
+
+TimelineSemaphore::TimelineSemaphore(Impl::TimelineSemaphore && timelineSemaphore) noexcept
+    : m_Pimpl(std::move(timelineSemaphore))
+{}
+
+TimelineSemaphore::TimelineSemaphore(TimelineSemaphore && other) noexcept = default;
+
+TimelineSemaphore & TimelineSemaphore::operator=(TimelineSemaphore && other) noexcept = default;
+
+TimelineSemaphore::~TimelineSemaphore() noexcept = default;
+
+std::uint64_t TimelineSemaphore::GetValue() const
+{
+    return m_Pimpl->GetValue();
+}
+
+void TimelineSemaphore::Wait(std::uint64_t value) const
+{
+    m_Pimpl->Wait(value);
+}
+
+void TimelineSemaphore::Signal(std::uint64_t value)
+{
+    m_Pimpl->Signal(value);
+}
+
+Impl::TimelineSemaphore & TimelineSemaphore::GetImpl() noexcept
+{
+    return *m_Pimpl;
+}
+
+const Impl::TimelineSemaphore & TimelineSemaphore::GetImpl() const noexcept
+{
+    return *m_Pimpl;
+}
+
+TimelineSemaphore TimelineSemaphore::Create(Device & device, std::uint64_t initialValue)
+{
+    return TimelineSemaphore(Impl::TimelineSemaphore::Create(device.getImpl().GetHandle(), initialValue));
+}
+
+} // namespace CuEngine::Vulkan
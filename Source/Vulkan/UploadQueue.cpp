@@ -0,0 +1,67 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Impl/UploadQueueImpl.hpp"
+
+namespace CuEngine::Vulkan
+{
+
+UploadQueue::UploadQueue(Impl::UploadQueue && uploadQueue) noexcept : m_Pimpl(std::move(uploadQueue))
+{}
+
+UploadQueue::UploadQueue(UploadQueue && other) noexcept = default;
+
+UploadQueue & UploadQueue::operator=(UploadQueue && other) noexcept = default;
+
+UploadQueue::~UploadQueue() noexcept = default;
+
+std::uint64_t UploadQueue::Upload(Buffer & destination, std::uint64_t offset, const void * data, std::uint64_t size)
+{
+    return m_Pimpl->Upload(destination.GetImpl().GetHandle(), offset, data, size);
+}
+
+std::uint64_t UploadQueue::Flush()
+{
+    return m_Pimpl->Flush();
+}
+
+bool UploadQueue::IsComplete(std::uint64_t value) const
+{
+    return m_Pimpl->IsComplete(value);
+}
+
+void UploadQueue::Wait(std::uint64_t value)
+{
+    m_Pimpl->Wait(value);
+}
+
+const TimelineSemaphore & UploadQueue::GetSemaphore() const noexcept
+{
+    return m_Pimpl->GetSemaphore();
+}
+
+Impl::UploadQueue & UploadQueue::GetImpl() noexcept
+{
+    return *m_Pimpl;
+}
+
+} // namespace CuEngine::Vulkan
@@ -0,0 +1,70 @@
+// MIT License
+//
+// Copyright (c) 2022 Egor Kupaev
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Impl/UploadQueueBuilderImpl.hpp"
+
+namespace CuEngine::Vulkan
+{
+UploadQueueBuilder::UploadQueueBuilder() = default;
+
+UploadQueueBuilder::UploadQueueBuilder(const UploadQueueBuilder & other) = default;
+
+UploadQueueBuilder::UploadQueueBuilder(UploadQueueBuilder && other) noexcept = default;
+
+UploadQueueBuilder & UploadQueueBuilder::operator=(const UploadQueueBuilder & other) = default;
+
+UploadQueueBuilder & UploadQueueBuilder::operator=(UploadQueueBuilder && other) noexcept = default;
+
+UploadQueueBuilder::~UploadQueueBuilder() noexcept = default;
+
+UploadQueueBuilder & UploadQueueBuilder::SetDevice(Device & device) noexcept
+{
+    m_Pimpl->SetDevice(device.getImpl());
+
+    return *this;
+}
+
+UploadQueueBuilder & UploadQueueBuilder::SetQueue(Queue & queue, const QueueFamily & queueFamily) noexcept
+{
+    m_Pimpl->SetQueue(queue.getImpl(), queueFamily.GetImpl());
+
+    return *this;
+}
+
+UploadQueueBuilder & UploadQueueBuilder::SetStagingSize(std::uint64_t stagingSize) noexcept
+{
+    m_Pimpl->SetStagingSize(stagingSize);
+
+    return *this;
+}
+
+UploadQueue UploadQueueBuilder::Build() const
+{
+    return UploadQueue(m_Pimpl->Build());
+}
+
+Impl::UploadQueueBuilder & UploadQueueBuilder::GetImpl() noexcept
+{
+    return *m_Pimpl;
+}
+
+} // namespace CuEngine::Vulkan
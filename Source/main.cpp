@@ -22,7 +22,119 @@
 
 #include <CuEngine/CuEngine.hpp>
 
-int main()
+#include <charconv>
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <string_view>
+
+static std::optional<CuEngine::ApplicationOptions> ParseOptions(int argc, char ** argv)
 {
-    return CuEngine::Application::Run();
+    // A headless run has no window to close, so it stops after a fixed number of frames unless told otherwise
+    constexpr auto defaultHeadlessFrameCount = 1000u;
+
+    auto options       = CuEngine::ApplicationOptions{
+        .isHeadless         = false,
+        .frameCount         = 0,
+        .preferredDevice    = {},
+        .framePacing        = CuEngine::Platform::FramePacingMode::Uncapped,
+        .targetFrameRate    = 0.0,
+        .simulationTickRate = 0.0
+    };
+    auto hasFrameCount = false;
+    auto hasPacing     = false;
+    for (auto index = 1; index < argc; ++index)
+    {
+        auto argument = std::string_view(argv[index]);
+        if (argument == "--headless")
+        {
+            options.isHeadless = true;
+        }
+        else if (argument == "--frames" && index + 1 < argc)
+        {
+            auto value  = std::string_view(argv[++index]);
+            auto result = std::from_chars(value.data(), value.data() + value.size(), options.frameCount);
+            if (result.ec != std::errc() || result.ptr != value.data() + value.size())
+            {
+                return std::nullopt;
+            }
+            hasFrameCount = true;
+        }
+        else if (argument == "--device" && index + 1 < argc)
+        {
+            options.preferredDevice = argv[++index];
+        }
+        else if (argument == "--pacing" && index + 1 < argc)
+        {
+            auto value = std::string_view(argv[++index]);
+            if (value == "uncapped")
+            {
+                options.framePacing = CuEngine::Platform::FramePacingMode::Uncapped;
+            }
+            else if (value == "fixed")
+            {
+                options.framePacing = CuEngine::Platform::FramePacingMode::FixedRate;
+            }
+            else if (value == "on-demand")
+            {
+                options.framePacing = CuEngine::Platform::FramePacingMode::OnDemand;
+            }
+            else
+            {
+                return std::nullopt;
+            }
+            hasPacing = true;
+        }
+        else if (argument == "--fps" && index + 1 < argc)
+        {
+            auto value  = std::string_view(argv[++index]);
+            auto result = std::from_chars(value.data(), value.data() + value.size(), options.targetFrameRate);
+            if (result.ec != std::errc() || result.ptr != value.data() + value.size() || options.targetFrameRate <= 0.0)
+            {
+                return std::nullopt;
+            }
+        }
+        else if (argument == "--tick-rate" && index + 1 < argc)
+        {
+            auto value  = std::string_view(argv[++index]);
+            auto result = std::from_chars(value.data(), value.data() + value.size(), options.simulationTickRate);
+            if (result.ec != std::errc() || result.ptr != value.data() + value.size()
+                || options.simulationTickRate <= 0.0)
+            {
+                return std::nullopt;
+            }
+        }
+        else
+        {
+            return std::nullopt;
+        }
+    }
+
+    if (options.isHeadless && !hasFrameCount)
+    {
+        options.frameCount = defaultHeadlessFrameCount;
+    }
+
+    // A frame rate on its own asks for a fixed rate
+    if (options.targetFrameRate > 0.0 && !hasPacing)
+    {
+        options.framePacing = CuEngine::Platform::FramePacingMode::FixedRate;
+    }
+
+    return options;
+}
+
+int main(int argc, char ** argv)
+{
+    auto options = ParseOptions(argc, argv);
+    if (!options)
+    {
+        std::cerr << "Usage: " << argv[0]
+                  << " [--headless] [--frames <count>] [--device <name|uuid>] [--pacing <uncapped|fixed|on-demand>]"
+                     " [--fps <rate>] [--tick-rate <rate>]"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return CuEngine::Application::Run(*options);
 }